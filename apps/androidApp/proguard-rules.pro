@@ -64,3 +64,8 @@
 -keep class com.google.protobuf.** { *; }
 -keep class com.google.common.flogger.** { *; }
 -dontwarn com.google.mediapipe.proto.**
+
+# Native MediaPipe bridge (libmediapipe_jni.so): JNI binds MediaPipeJni's natives and
+# its callback interfaces by name.
+-keep class org.balch.orpheus.core.mediapipe.MediaPipeJni { native <methods>; }
+-keep class org.balch.orpheus.core.mediapipe.MediaPipeJni$* { *; }
@@ -29,6 +29,8 @@ class TestAudioEngine : AudioEngine {
     override fun setUnitEnabled(unit: AudioUnit, enabled: Boolean) {}
     override fun getCpuLoad(): Float = 0f
     override fun getCurrentTime(): Double = 0.0
+    override fun addControlListener(listener: ControlListener, intervalFrames: Int) {}
+    override fun removeControlListener(listener: ControlListener) {}
     override val lineOutLeft: AudioInput = TestAudioInput()
     override val lineOutRight: AudioInput = TestAudioInput()
 }
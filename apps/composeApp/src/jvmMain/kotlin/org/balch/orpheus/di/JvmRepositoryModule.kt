@@ -6,10 +6,12 @@ import dev.zacsweers.metro.Provides
 import dev.zacsweers.metro.SingleIn
 import org.balch.orpheus.core.mediapipe.DesktopHandTracker
 import org.balch.orpheus.core.mediapipe.HandTracker
+import org.balch.orpheus.core.mediapipe.ReplayHandTracker
 import org.balch.orpheus.core.preferences.AppPreferencesRepository
 import org.balch.orpheus.core.preferences.JvmAppPreferencesRepository
 import org.balch.orpheus.core.presets.JvmSynthPresetRepository
 import org.balch.orpheus.core.presets.SynthPresetRepository
+import java.io.File
 
 /**
  * JVM-specific module providing repository implementations.
@@ -27,6 +29,12 @@ interface JvmRepositoryModule {
 
         @Provides
         @SingleIn(AppScope::class)
-        fun provideHandTracker(): HandTracker = DesktopHandTracker()
+        fun provideHandTracker(): HandTracker {
+            // -Dorpheus.tracker.replay=<log> plays a recorded session instead of the camera.
+            val replay = System.getProperty("orpheus.tracker.replay")
+                ?: return DesktopHandTracker()
+            val speed = System.getProperty("orpheus.tracker.replaySpeed")?.toDoubleOrNull() ?: 1.0
+            return ReplayHandTracker(File(replay), speed)
+        }
     }
 }
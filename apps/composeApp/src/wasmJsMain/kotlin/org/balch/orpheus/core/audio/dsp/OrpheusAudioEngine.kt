@@ -64,6 +64,11 @@ class OrpheusAudioEngine @Inject constructor() : AudioEngine {
 
     override fun setUnitEnabled(unit: AudioUnit, enabled: Boolean) { }
 
+    // Web Audio runs no Kotlin on its rendering thread, so listeners are never called.
+    override fun addControlListener(listener: ControlListener, intervalFrames: Int) { }
+
+    override fun removeControlListener(listener: ControlListener) { }
+
 
     
     override val lineOutLeft: AudioInput
@@ -1,7 +1,8 @@
 #!/usr/bin/env bash
 #
-# build-native-mediapipe.sh — Build the MediaPipe JNI dylib for desktop
-# (macOS ARM64).
+# build-native-mediapipe.sh — Build the MediaPipe JNI library for desktop
+# (macOS ARM64 dylib, Linux x86_64 .so, Windows x86_64 .dll — whichever
+# platform this runs on), or with --android for arm64-v8a phones.
 #
 # This is the single entry point for both initial setup and rebuilds.
 #
@@ -15,10 +16,46 @@
 #      library that statically links MediaPipe HandLandmarker + OpenCV + TBB.
 #      All internal symbols (including OpenCV) are hidden via
 #      -exported_symbols_list to prevent collisions with JavaCV.
-#      Only 7 JNI entry points are exported.
+#      Only the JNI entry points in exported_symbols.txt are exported.
+#      On Linux/Windows the same sources build libmediapipe_jni.so /
+#      mediapipe_jni.dll, exporting the same list through a generated
+#      version script / .def file.  They link OpenCV from MediaPipe's
+#      stock linux_opencv / windows_opencv repositories.
 #
-#   3. Copies the dylib into the Orpheus resource directory and ad-hoc
-#      signs it for Apple Silicon (macOS requires code-signed dylibs).
+#   3. Copies the library into the Orpheus resource directory for the
+#      platform string MediaPipeJni.initialize() looks up, and on macOS
+#      ad-hoc signs it for Apple Silicon (macOS requires code-signed dylibs).
+#
+# ── x86_64 CPU dispatch ──────────────────────────────────────────────
+#
+#   The .so/.dll are compiled for the baseline x86_64 ISA so one binary
+#   runs on every stage PC.  frame_kernels.cc compiles its SSSE3, AVX2 and
+#   AVX-512 row kernels with per-function target attributes and picks the
+#   widest one CPUID and XGETBV allow at first use (TFLite's XNNPACK does
+#   its own dispatch).  Set ORPHEUS_FRAME_KERNELS=scalar|ssse3|avx2 to cap
+#   it; MediaPipeJni logs the choice when it loads.
+#
+# ── GPU variant ──────────────────────────────────────────────────────
+#
+#   --gpu builds libmediapipe_jni_gpu.{dylib,so} instead: the same bridge
+#   without MEDIAPIPE_DISABLE_GPU, so the VIDEO-mode GestureRecognizer (and
+#   the skip-frame landmarker) can run on Metal (macOS) or EGL/OpenGL ES
+#   (Linux, headless: no X11).  MediaPipeJni.initialize() loads it when a
+#   tracker asks for InferenceDelegate.GPU and it is bundled; the bridge
+#   falls back to CPU per handle if GPU task creation fails.  The CPU
+#   library stays the default, and there is no Windows GPU variant.
+#
+# ── Android ──────────────────────────────────────────────────────────
+#
+#   --android cross-builds the same libmediapipe_jni.so (or, with --gpu,
+#   libmediapipe_jni_gpu.so) for arm64-v8a with MediaPipe's android_arm64
+#   config and copies it into the app's jniLibs, where AndroidHandTracker
+#   loads it through MediaPipeJni.  It is the desktop bridge unchanged
+#   except that native capture is a stub (CameraX frames come in through
+#   nativePreprocessYuvFrame) and diagnostics go to logcat.  Without the
+#   library in the APK, AndroidHandTracker keeps the MediaPipe Tasks AAR.
+#   Needs ANDROID_HOME and ANDROID_NDK_HOME (NDK r21+ as MediaPipe's
+#   WORKSPACE expects); runs on a macOS or Linux host.
 #
 # ── GestureRecognizer fixes ──────────────────────────────────────────
 #
@@ -62,8 +99,11 @@
 #       - third_party/opencv_macos.BUILD: OpenCV 4.13 static libs + TBB
 #         + macOS framework linkopts (was OpenCV 3 dynamic)
 #       - mediapipe/tasks/c/vision/hand_landmarker/BUILD: adds the
-#         combined libmediapipe_jni.dylib cc_binary target with
-#         exported_symbols_list for symbol hiding
+#         JNI-free mediapipe_native_core, the combined mediapipe_jni_lib
+#         and its libmediapipe_jni.{dylib,so} and mediapipe_jni.dll
+#         cc_binary targets (the .so also for Android arm64-v8a), with the
+#         export list applied per platform for symbol hiding, and the
+#         mediapipe_bench binary
 #       - mediapipe/tasks/cc/vision/gesture_recognizer/calculators/:
 #         LandmarksToMatrixCalculator and HandednessToMatrixCalculator
 #         changed from Send(unique_ptr<Matrix>) to Send(Matrix&&) to
@@ -71,22 +111,93 @@
 #
 #   build-scripts/mediapipe-patches/mediapipe_jni.cc
 #       Combined JNI bridge wrapping HandLandmarker and GestureRecognizer
-#       C APIs for the JVM.
+#       for the JVM (C API; pooled_tasks for the VIDEO-mode graphs).
 #       Kotlin side: org.balch.orpheus.core.mediapipe.MediaPipeJni
 #
+#   build-scripts/mediapipe-patches/frame_kernels.{h,cc}
+#       Frame preprocessing (mirror + letterbox + ARGB->RGB) in one pass,
+#       plus the BGR24 and YUV 4:2:0 (NV12/NV21/I420, strided) camera
+#       frame -> BGRA preview conversions,
+#       NEON on ARM64, SSSE3/AVX2/AVX-512 on x86_64 (runtime dispatch).
+#       No JNI/MediaPipe deps.
+#
+#   build-scripts/mediapipe-patches/asl_classifier.{h,cc}
+#       Optional custom ASL classifier (TFLite, trained by
+#       tools/train-asl-model/train_landmark_classifier.py). No JNI deps.
+#
+#   build-scripts/mediapipe-patches/gesture_schedule.{h,cc}
+#       Skip-frame scheduling of full gesture recognition vs tracking-only
+#       frames. No JNI/MediaPipe deps.
+#
+#   build-scripts/mediapipe-patches/hand_features.{h,cc}
+#       Per-hand geometric feature vector appended to packed results.
+#       No JNI/MediaPipe deps.
+#
+#   build-scripts/mediapipe-patches/hand_snapshot.{h,cc}
+#       Seqlock-published copy of each tracker's latest packed result for
+#       lock-free reads from realtime threads. No JNI/MediaPipe deps.
+#
+#   build-scripts/mediapipe-patches/landmark_filter.{h,cc}
+#       One-Euro landmark smoothing over a structure-of-arrays hand state.
+#       No JNI/MediaPipe deps.
+#
+#   build-scripts/mediapipe-patches/landmark_predictor.{h,cc}
+#       Least-squares velocity fit and extrapolation of recent landmarks.
+#       No JNI/MediaPipe deps.
+#
+#   build-scripts/mediapipe-patches/native_capture.{h,cc}
+#       Optional camera capture through OpenCV VideoCapture (AVFoundation
+#       on macOS) for the native capture thread; a stub that always fails
+#       to open on Android, where CameraX owns the camera. No JNI deps.
+#
+#   build-scripts/mediapipe-patches/pooled_tasks.{h,cc}
+#       VIDEO-mode GestureRecognizer / HandLandmarker on the C++ task API
+#       with pooled input images and fixed result storage, returning the
+#       C API result structs. No JNI deps.
+#
+#   build-scripts/mediapipe-patches/result_log.{h,cc}
+#       Memory-mapped binary log of delivered results, replayed on the
+#       JVM by ReplayHandTracker. No JNI/MediaPipe deps.
+#
+#   build-scripts/mediapipe-patches/mediapipe_bench.cc
+#       Standalone benchmark (no JVM): records camera frames, replays them
+#       through the native frame path and reports fps, per-stage latency
+#       percentiles, allocations per frame and peak RSS.  Built by --bench.
+#
 #   build-scripts/mediapipe-patches/exported_symbols.txt
-#       Linker symbol export list — only 7 JNI entry points are visible.
+#       Linker symbol export list — only the JNI entry points are visible.
 #       All other symbols (OpenCV, protobuf, Eigen, etc.) are hidden to
 #       prevent collisions with JavaCV loaded in the same JVM process.
 #
 # ── Output ────────────────────────────────────────────────────────────
 #
 #   core/mediapipe/src/jvmMain/resources/native/darwin-aarch64/
-#       libmediapipe_jni.dylib  (~14MB, 7 exported symbols)
+#       libmediapipe_jni.dylib  (~14MB, JNI entry points only)
+#       libmediapipe_jni.dylib.sha256  (content key for the runtime cache)
+#   core/mediapipe/src/jvmMain/resources/native/linux-x86_64/
+#       libmediapipe_jni.so (+ .sha256)
+#   --gpu: libmediapipe_jni_gpu.dylib / libmediapipe_jni_gpu.so (+ .sha256)
+#       next to the CPU library
+#   core/mediapipe/src/jvmMain/resources/native/windows-x86_64/
+#       mediapipe_jni.dll (+ .sha256)
+#   --android: apps/androidApp/src/main/jniLibs/arm64-v8a/
+#       libmediapipe_jni.so or libmediapipe_jni_gpu.so (no .sha256: the
+#       APK installer extracts it, nothing is cached)
+#
+#   Only the darwin-aarch64 CPU library is committed. The Linux, Windows,
+#   GPU and Android targets are built locally; until CI builds and commits
+#   them, those platforms have no native hand tracking.
 #
 # ── Prerequisites ─────────────────────────────────────────────────────
 #
-#   brew install opencv tbb bazelisk
+#   macOS:   brew install opencv tbb bazelisk
+#   Linux:   bazelisk, a C++17 toolchain, and
+#            apt install libopencv-core-dev libopencv-imgproc-dev \
+#              libopencv-video-dev libopencv-videoio-dev
+#            (the same OpenCV runtime packages on the stage PCs)
+#   Windows: bazelisk, MSVC 2022, Git Bash (run this script from it), and
+#            OpenCV at the path windows_opencv in MediaPipe's WORKSPACE
+#            expects; ship its opencv_world DLL next to the app
 #   JDK 17+ with JAVA_HOME set (for JNI headers)
 #   Python 3.12 (for Bazel hermetic python)
 #   MediaPipe source: git clone https://github.com/google-ai-edge/mediapipe.git
@@ -99,6 +210,20 @@
 #   Subsequent rebuilds:
 #     ./build-scripts/build-native-mediapipe.sh
 #
+#   GPU variant (macOS / Linux; Linux needs libegl-dev libgles-dev):
+#     ./build-scripts/build-native-mediapipe.sh --gpu
+#
+#   Android arm64-v8a (after --setup; combine with --gpu or --bench):
+#     ./build-scripts/build-native-mediapipe.sh --android
+#
+#   Benchmark binary instead of the library (same flags), then e.g.:
+#     ./build-scripts/build-native-mediapipe.sh --bench
+#     mediapipe_bench record 0 300 hands.frames
+#     mediapipe_bench run gesture_recognizer.task hands.frames --loops 5
+#   Compare runs before and after bumping the MediaPipe base commit or
+#   EIGEN_MAX_ALIGN_BYTES.  --gpu --bench builds it against the GPU
+#   variant; add --gpu to `run` to measure the GPU delegate.
+#
 #   Custom MediaPipe location:
 #     MEDIAPIPE_DIR=/path/to/mediapipe ./build-scripts/build-native-mediapipe.sh
 #
@@ -114,7 +239,59 @@ set -euo pipefail
 ORPHIC_DIR="$(cd "$(dirname "$0")/.." && pwd)"
 MEDIAPIPE_DIR="${MEDIAPIPE_DIR:-$HOME/Source/mediapipe}"
 PATCHES_DIR="$(cd "$(dirname "$0")/mediapipe-patches" && pwd)"
-TARGET_DIR="$ORPHIC_DIR/core/mediapipe/src/jvmMain/resources/native/darwin-aarch64"
+
+# Platform string and library name as MediaPipeJni.initialize() computes them.
+case "$(uname -s)" in
+    Darwin)
+        PLATFORM="darwin-aarch64"
+        LIB_NAME="libmediapipe_jni.dylib"
+        GPU_LIB_NAME="libmediapipe_jni_gpu.dylib"
+        GPU_FLAGS=()
+        BAZEL_CONFIG=(--config darwin_arm64)
+        ;;
+    Linux)
+        PLATFORM="linux-x86_64"
+        LIB_NAME="libmediapipe_jni.so"
+        GPU_LIB_NAME="libmediapipe_jni_gpu.so"
+        GPU_FLAGS=(--copt=-DMESA_EGL_NO_X11_HEADERS --copt=-DEGL_NO_X11)
+        BAZEL_CONFIG=()
+        ;;
+    MINGW*|MSYS*|CYGWIN*)
+        PLATFORM="windows-x86_64"
+        LIB_NAME="mediapipe_jni.dll"
+        GPU_LIB_NAME=""
+        GPU_FLAGS=()
+        BAZEL_CONFIG=()
+        ;;
+    *)
+        echo "Error: unsupported platform $(uname -s)"
+        exit 1
+        ;;
+esac
+TARGET_DIR="$ORPHIC_DIR/core/mediapipe/src/jvmMain/resources/native/$PLATFORM"
+
+android_target() {
+    PLATFORM="android-arm64-v8a"
+    LIB_NAME="libmediapipe_jni.so"
+    GPU_LIB_NAME="libmediapipe_jni_gpu.so"
+    # EGL and GLES come with the NDK sysroot.
+    GPU_FLAGS=()
+    BAZEL_CONFIG=(--config android_arm64)
+    TARGET_DIR="$ORPHIC_DIR/apps/androidApp/src/main/jniLibs/arm64-v8a"
+    if [[ -z "${ANDROID_HOME:-}" || -z "${ANDROID_NDK_HOME:-}" ]]; then
+        echo "Error: --android needs ANDROID_HOME and ANDROID_NDK_HOME"
+        exit 1
+    fi
+}
+
+# Flags shared by the library and the benchmark, so the benchmark measures
+# the code that ships.  VARIANT_FLAGS become GPU_FLAGS with --gpu.
+BAZEL_FLAGS=(
+    -c opt
+    --repo_env=HERMETIC_PYTHON_VERSION=3.12
+    --copt=-DEIGEN_MAX_ALIGN_BYTES=16
+)
+VARIANT_FLAGS=(--define MEDIAPIPE_DISABLE_GPU=1)
 
 # ── Setup (patch + copy sources) ─────────────────────────────────────
 
@@ -141,10 +318,10 @@ do_setup() {
     cd "$MEDIAPIPE_DIR"
     git apply "$PATCHES_DIR/mediapipe.patch"
 
-    # Copy JNI bridge source and symbol export list
-    echo "    Copying mediapipe_jni.cc and exported_symbols.txt..."
-    cp "$PATCHES_DIR/mediapipe_jni.cc" \
-       mediapipe/tasks/c/vision/hand_landmarker/mediapipe_jni.cc
+    # Copy JNI bridge sources and symbol export list
+    echo "    Copying bridge sources and exported_symbols.txt..."
+    cp "$PATCHES_DIR"/*.cc "$PATCHES_DIR"/*.h \
+       mediapipe/tasks/c/vision/hand_landmarker/
     cp "$PATCHES_DIR/exported_symbols.txt" \
        mediapipe/tasks/c/vision/hand_landmarker/exported_symbols.txt
 
@@ -158,8 +335,12 @@ do_setup() {
         ln -sf "$JAVA_HOME/include/darwin/jni_md.h" "$jni_dir/jni_md.h"
     elif [[ -f "$JAVA_HOME/include/linux/jni_md.h" ]]; then
         ln -sf "$JAVA_HOME/include/linux/jni_md.h" "$jni_dir/jni_md.h"
+    elif [[ -f "$JAVA_HOME/include/win32/jni_md.h" ]]; then
+        # Symlinks need developer mode on Windows; a copy works everywhere.
+        cp "$JAVA_HOME/include/jni.h" "$jni_dir/jni.h"
+        cp "$JAVA_HOME/include/win32/jni_md.h" "$jni_dir/jni_md.h"
     else
-        echo "Warning: jni_md.h not found in $JAVA_HOME/include/{darwin,linux}/"
+        echo "Warning: jni_md.h not found in $JAVA_HOME/include/{darwin,linux,win32}/"
     fi
 
     echo "==> Setup complete"
@@ -168,25 +349,56 @@ do_setup() {
 # ── Build ─────────────────────────────────────────────────────────────
 
 do_build() {
-    echo "==> Building combined MediaPipe JNI dylib in $MEDIAPIPE_DIR"
+    echo "==> Building $LIB_NAME ($PLATFORM) in $MEDIAPIPE_DIR"
 
+    # No -march/-mavx flags: the x86_64 kernels dispatch at runtime (see
+    # "x86_64 CPU dispatch" above), so the baseline build stays portable.
     cd "$MEDIAPIPE_DIR"
-    bazelisk build --config darwin_arm64 -c opt --strip always \
-        --define MEDIAPIPE_DISABLE_GPU=1 \
-        --repo_env=HERMETIC_PYTHON_VERSION=3.12 \
-        --copt=-DEIGEN_MAX_ALIGN_BYTES=16 \
-        //mediapipe/tasks/c/vision/hand_landmarker:libmediapipe_jni.dylib
+    bazelisk build ${BAZEL_CONFIG[@]+"${BAZEL_CONFIG[@]}"} "${BAZEL_FLAGS[@]}" \
+        ${VARIANT_FLAGS[@]+"${VARIANT_FLAGS[@]}"} --strip always \
+        "//mediapipe/tasks/c/vision/hand_landmarker:$LIB_NAME"
 
     mkdir -p "$TARGET_DIR"
-    cp bazel-bin/mediapipe/tasks/c/vision/hand_landmarker/libmediapipe_jni.dylib \
+    cp "bazel-bin/mediapipe/tasks/c/vision/hand_landmarker/$LIB_NAME" \
        "$TARGET_DIR/"
 
-    # Ad-hoc sign for Apple Silicon (macOS kills unsigned dylibs with SIGKILL).
-    # Note: MediaPipeJni.kt also re-signs after extracting from the JAR at runtime,
-    # since the JAR extraction loses the signature.
-    codesign -s - "$TARGET_DIR/libmediapipe_jni.dylib"
+    if [[ "$PLATFORM" == darwin-* ]]; then
+        # Ad-hoc sign for Apple Silicon (macOS kills unsigned dylibs with SIGKILL).
+        # Note: MediaPipeJni.kt also re-signs when it first caches the library,
+        # since the JAR extraction loses the signature.
+        codesign -s - "$TARGET_DIR/$LIB_NAME"
+        echo "==> Copied and signed $TARGET_DIR/$LIB_NAME"
+    else
+        echo "==> Copied $TARGET_DIR/$LIB_NAME"
+    fi
+
+    if [[ "$PLATFORM" != android-* ]]; then
+        write_cache_key "$TARGET_DIR/$LIB_NAME"
+    fi
+}
+
+# ── Benchmark ─────────────────────────────────────────────────────────
+
+do_bench() {
+    echo "==> Building mediapipe_bench ($PLATFORM) in $MEDIAPIPE_DIR"
+    cd "$MEDIAPIPE_DIR"
+    bazelisk build ${BAZEL_CONFIG[@]+"${BAZEL_CONFIG[@]}"} "${BAZEL_FLAGS[@]}" \
+        ${VARIANT_FLAGS[@]+"${VARIANT_FLAGS[@]}"} \
+        //mediapipe/tasks/c/vision/hand_landmarker:mediapipe_bench
+    echo "==> Built $MEDIAPIPE_DIR/bazel-bin/mediapipe/tasks/c/vision/hand_landmarker/mediapipe_bench"
+}
 
-    echo "==> Copied and signed $TARGET_DIR/libmediapipe_jni.dylib"
+# Sidecar "<sha256> <bytes>" that NativeCache keys the runtime cache on, so
+# launches don't hash the library. Written after signing: it covers the
+# bytes that ship.
+write_cache_key() {
+    local file="$1" hash
+    if command -v sha256sum >/dev/null; then
+        hash="$(sha256sum "$file" | cut -d' ' -f1)"
+    else
+        hash="$(shasum -a 256 "$file" | cut -d' ' -f1)"
+    fi
+    echo "$hash $(wc -c < "$file" | tr -d ' ')" > "$file.sha256"
 }
 
 # ── Main ──────────────────────────────────────────────────────────────
@@ -196,4 +408,23 @@ if [[ "${1:-}" == "--setup" ]]; then
     shift
 fi
 
-do_build
+if [[ "${1:-}" == "--android" ]]; then
+    android_target
+    shift
+fi
+
+if [[ "${1:-}" == "--gpu" ]]; then
+    if [[ -z "$GPU_LIB_NAME" ]]; then
+        echo "Error: no GPU variant for $PLATFORM"
+        exit 1
+    fi
+    LIB_NAME="$GPU_LIB_NAME"
+    VARIANT_FLAGS=(${GPU_FLAGS[@]+"${GPU_FLAGS[@]}"})
+    shift
+fi
+
+if [[ "${1:-}" == "--bench" ]]; then
+    do_bench
+else
+    do_build
+fi
@@ -0,0 +1,112 @@
+#include "asl_classifier.h"
+
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <memory>
+
+#include "tensorflow/lite/interpreter.h"
+#include "tensorflow/lite/kernels/register.h"
+#include "tensorflow/lite/model_builder.h"
+
+struct AslClassifier {
+    std::unique_ptr<tflite::FlatBufferModel> model;
+    std::unique_ptr<tflite::Interpreter> interpreter;
+    int class_count;
+};
+
+/* First landmark of each finger chain (thumb CMC, then the MCPs). */
+static const int kFingerBase[5] = {1, 5, 9, 13, 17};
+
+static float bone_angle(const float* v, int a0, int a1, int b0, int b1) {
+    float ax = v[a1 * 3] - v[a0 * 3], ay = v[a1 * 3 + 1] - v[a0 * 3 + 1];
+    float az = v[a1 * 3 + 2] - v[a0 * 3 + 2];
+    float bx = v[b1 * 3] - v[b0 * 3], by = v[b1 * 3 + 1] - v[b0 * 3 + 1];
+    float bz = v[b1 * 3 + 2] - v[b0 * 3 + 2];
+    float denom = sqrtf((ax * ax + ay * ay + az * az) * (bx * bx + by * by + bz * bz));
+    if (denom <= 1e-12f) return 0.0f;
+    float c = (ax * bx + ay * by + az * bz) / denom;
+    if (c > 1.0f) c = 1.0f;
+    if (c < -1.0f) c = -1.0f;
+    return acosf(c);
+}
+
+void asl_classifier_input(const float* xyz, bool right, float kx, float ky, float* input) {
+    const float sx = right ? kx : -kx;
+    float extent = 0.0f;
+    for (int i = 0; i < 21; i++) {
+        float dx = (xyz[i * 3] - xyz[0]) * sx;
+        float dy = (xyz[i * 3 + 1] - xyz[1]) * ky;
+        input[i * 3] = dx;
+        input[i * 3 + 1] = dy;
+        input[i * 3 + 2] = xyz[i * 3 + 2] - xyz[2];
+        float d = sqrtf(dx * dx + dy * dy);
+        if (d > extent) extent = d;
+    }
+    float inv = extent > 1e-6f ? 1.0f / extent : 1.0f;
+    for (int i = 0; i < 63; i++) input[i] *= inv;
+
+    for (int f = 0; f < 5; f++) {
+        int base = kFingerBase[f];
+        input[63 + f] = bone_angle(input, base, base + 1, base + 2, base + 3);
+    }
+}
+
+AslClassifier* asl_classifier_create(const char* model_path, char* error, size_t error_size) {
+    std::unique_ptr<AslClassifier> c(new AslClassifier());
+    c->model = tflite::FlatBufferModel::BuildFromFile(model_path);
+    if (!c->model) {
+        snprintf(error, error_size, "cannot load ASL model %s", model_path);
+        return nullptr;
+    }
+
+    tflite::ops::builtin::BuiltinOpResolver resolver;
+    if (tflite::InterpreterBuilder(*c->model, resolver)(&c->interpreter) != kTfLiteOk ||
+        !c->interpreter) {
+        snprintf(error, error_size, "cannot build ASL interpreter");
+        return nullptr;
+    }
+    /* One hand is a few thousand MACs; extra threads only add wakeups. */
+    c->interpreter->SetNumThreads(1);
+    if (c->interpreter->AllocateTensors() != kTfLiteOk) {
+        snprintf(error, error_size, "cannot allocate ASL tensors");
+        return nullptr;
+    }
+
+    if (c->interpreter->inputs().size() != 1 || c->interpreter->outputs().size() != 1) {
+        snprintf(error, error_size, "ASL model must have one input and one output");
+        return nullptr;
+    }
+    const TfLiteTensor* in = c->interpreter->input_tensor(0);
+    const TfLiteTensor* out = c->interpreter->output_tensor(0);
+    if (in->type != kTfLiteFloat32 || in->bytes != sizeof(float) * ASL_INPUT_SIZE) {
+        snprintf(error, error_size, "ASL model input must be %d float32", ASL_INPUT_SIZE);
+        return nullptr;
+    }
+    if (out->type != kTfLiteFloat32 || out->bytes < sizeof(float)) {
+        snprintf(error, error_size, "ASL model output must be float32 scores");
+        return nullptr;
+    }
+    c->class_count = (int)(out->bytes / sizeof(float));
+    return c.release();
+}
+
+void asl_classifier_destroy(AslClassifier* c) {
+    delete c;
+}
+
+bool asl_classifier_run(AslClassifier* c, const float* xyz, bool right, float kx, float ky,
+                        int* class_id, float* score) {
+    float* in = c->interpreter->typed_input_tensor<float>(0);
+    asl_classifier_input(xyz, right, kx, ky, in);
+    if (c->interpreter->Invoke() != kTfLiteOk) return false;
+
+    const float* out = c->interpreter->typed_output_tensor<float>(0);
+    int best = 0;
+    for (int i = 1; i < c->class_count; i++) {
+        if (out[i] > out[best]) best = i;
+    }
+    *class_id = best;
+    *score = out[best];
+    return true;
+}
@@ -0,0 +1,38 @@
+#ifndef ORPHEUS_MEDIAPIPE_ASL_CLASSIFIER_H_
+#define ORPHEUS_MEDIAPIPE_ASL_CLASSIFIER_H_
+
+#include <cstddef>
+
+/*
+ * Custom ASL sign classifier for the MediaPipe JNI bridge: a small TFLite
+ * model (tools/train-asl-model/train_landmark_classifier.py) run on one
+ * canonical landmark vector per hand.  No JNI or MediaPipe task
+ * dependencies — only the TFLite interpreter MediaPipe already links.
+ *
+ * Model contract: one float32 input of ASL_INPUT_SIZE elements (see
+ * asl_classifier_input), one float32 output of per-class scores.  Class
+ * IDs index the labels file shipped next to the model.
+ */
+
+#define ASL_INPUT_SIZE 68   /* 21 * xyz canonical landmarks + 5 finger curls */
+
+struct AslClassifier;
+
+/* Load a model.  Returns nullptr and fills error on failure. */
+AslClassifier* asl_classifier_create(const char* model_path, char* error, size_t error_size);
+
+void asl_classifier_destroy(AslClassifier* c);
+
+/* Build the model input from one hand's output-space landmarks (21*xyz):
+ *   - wrist-relative, x/y scaled by kx/ky back to isotropic square units,
+ *   - x negated for left hands so the model only sees right hands,
+ *   - divided by the largest wrist-to-landmark x/y distance,
+ * followed by the angle between the first and last bone of each finger
+ * (thumb..pinky) in those units.  Kept in step with the training script. */
+void asl_classifier_input(const float* xyz, bool right, float kx, float ky, float* input);
+
+/* Classify one hand.  Returns false if inference failed. */
+bool asl_classifier_run(AslClassifier* c, const float* xyz, bool right, float kx, float ky,
+                        int* class_id, float* score);
+
+#endif  // ORPHEUS_MEDIAPIPE_ASL_CLASSIFIER_H_
@@ -0,0 +1,835 @@
+#include "frame_kernels.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+
+/* ARM64 always has NEON, so those kernels are compiled in directly.  On
+ * x86_64 the binary targets the baseline ISA and every SIMD kernel is
+ * compiled for its own ISA via the target attribute (MSVC needs none);
+ * frame_kernels() picks the widest one the CPU and OS support.  The
+ * AVX-512 kernels use the zero-masked intrinsic forms: GCC 12's unmasked
+ * ones trip -Wmaybe-uninitialized. */
+#if defined(__ARM_NEON) || defined(__aarch64__)
+#include <arm_neon.h>
+#define FRAME_KERNELS_NEON 1
+#elif defined(__x86_64__) || defined(_M_X64)
+#include <immintrin.h>
+#define FRAME_KERNELS_X86 1
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#define FRAME_KERNELS_TARGET(isa)
+#else
+#include <cpuid.h>
+#define FRAME_KERNELS_TARGET(isa) __attribute__((target(isa)))
+#endif
+#endif
+
+/* ========================================================================
+ * ARGB -> RGB row kernels
+ *
+ * With mirror set, output column x reads source column width - 1 - x.
+ * With rgba set the source bytes are R,G,B,A (an Android Bitmap) instead
+ * of B,G,R,A, so the kernels drop alpha without swapping B and R.
+ * The SIMD kernels convert whole blocks from column 0 and return the
+ * number of pixels handled; the scalar loop finishes the remainder.
+ * ======================================================================== */
+
+static void argb_row_scalar(const uint32_t* src, int width, bool mirror, bool rgba,
+                            int x0, int x1, uint8_t* dst) {
+    const int r_shift = rgba ? 0 : 16;
+    for (int x = x0; x < x1; x++) {
+        uint32_t p = mirror ? src[width - 1 - x] : src[x];
+        dst[x * 3]     = (uint8_t)(p >> r_shift);         // R
+        dst[x * 3 + 1] = (uint8_t)(p >> 8);               // G
+        dst[x * 3 + 2] = (uint8_t)(p >> (16 - r_shift));  // B
+    }
+}
+
+#if defined(FRAME_KERNELS_NEON)
+
+/* 16 pixels per iteration: vld4q de-interleaves B,G,R,A planes, vst3q
+ * re-interleaves as R,G,B.  Mirroring reverses each 16-lane plane. */
+static inline uint8x16_t reverse_u8x16(uint8x16_t v) {
+    uint8x16_t r = vrev64q_u8(v);
+    return vcombine_u8(vget_high_u8(r), vget_low_u8(r));
+}
+
+static int argb_row_neon(const uint32_t* src, int width, bool mirror, bool rgba, uint8_t* dst) {
+    const int r_at = rgba ? 0 : 2;
+    int x = 0;
+    if (mirror) {
+        for (; x + 16 <= width; x += 16) {
+            uint8x16x4_t bgra = vld4q_u8(
+                reinterpret_cast<const uint8_t*>(src + width - 16 - x));
+            uint8x16x3_t rgb;
+            rgb.val[0] = reverse_u8x16(bgra.val[r_at]);
+            rgb.val[1] = reverse_u8x16(bgra.val[1]);
+            rgb.val[2] = reverse_u8x16(bgra.val[2 - r_at]);
+            vst3q_u8(dst + x * 3, rgb);
+        }
+    } else {
+        for (; x + 16 <= width; x += 16) {
+            uint8x16x4_t bgra = vld4q_u8(reinterpret_cast<const uint8_t*>(src + x));
+            uint8x16x3_t rgb;
+            rgb.val[0] = bgra.val[r_at];
+            rgb.val[1] = bgra.val[1];
+            rgb.val[2] = bgra.val[2 - r_at];
+            vst3q_u8(dst + x * 3, rgb);
+        }
+    }
+    return x;
+}
+
+#elif defined(FRAME_KERNELS_X86)
+
+/* 16 pixels per iteration: optional dword reverse, per-lane pshufb down to
+ * 12 RGB bytes, a dword permute packs the four 12-byte quarters and a
+ * masked store writes exactly 48 bytes. */
+FRAME_KERNELS_TARGET("avx512f,avx512bw")
+static int argb_row_avx512(const uint32_t* src, int width, bool mirror, bool rgba, uint8_t* dst) {
+    const __m512i shuffle = _mm512_maskz_broadcast_i32x4(0xFFFF, rgba
+        ? _mm_setr_epi8(0, 1, 2, 4, 5, 6, 8, 9, 10, 12, 13, 14, -1, -1, -1, -1)
+        : _mm_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1));
+    const __m512i pack = _mm512_setr_epi32(0, 1, 2, 4, 5, 6, 8, 9, 10, 12, 13, 14, 0, 0, 0, 0);
+    const __m512i reverse = _mm512_setr_epi32(15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0);
+
+    int x = 0;
+    for (; x + 16 <= width; x += 16) {
+        __m512i v;
+        if (mirror) {
+            v = _mm512_loadu_si512(src + width - 16 - x);
+            v = _mm512_maskz_permutexvar_epi32(0xFFFF, reverse, v);
+        } else {
+            v = _mm512_loadu_si512(src + x);
+        }
+        v = _mm512_maskz_permutexvar_epi32(0xFFFF, pack, _mm512_shuffle_epi8(v, shuffle));
+        _mm512_mask_storeu_epi32(dst + x * 3, 0x0FFF, v);
+    }
+    return x;
+}
+
+/* 8 pixels per iteration: optional dword reverse, per-lane pshufb down to
+ * 12 RGB bytes, then a cross-lane permute packs the two 12-byte halves
+ * into 24 contiguous bytes. */
+FRAME_KERNELS_TARGET("avx2")
+static int argb_row_avx2(const uint32_t* src, int width, bool mirror, bool rgba, uint8_t* dst) {
+    const __m256i shuffle = rgba
+        ? _mm256_setr_epi8(
+            0, 1, 2, 4, 5, 6, 8, 9, 10, 12, 13, 14, -1, -1, -1, -1,
+            0, 1, 2, 4, 5, 6, 8, 9, 10, 12, 13, 14, -1, -1, -1, -1)
+        : _mm256_setr_epi8(
+            2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1,
+            2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1);
+    const __m256i pack = _mm256_setr_epi32(0, 1, 2, 4, 5, 6, 3, 7);
+    const __m256i reverse = _mm256_setr_epi32(7, 6, 5, 4, 3, 2, 1, 0);
+
+    int x = 0;
+    for (; x + 8 <= width; x += 8) {
+        __m256i v;
+        if (mirror) {
+            v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + width - 8 - x));
+            v = _mm256_permutevar8x32_epi32(v, reverse);
+        } else {
+            v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + x));
+        }
+        v = _mm256_permutevar8x32_epi32(_mm256_shuffle_epi8(v, shuffle), pack);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + x * 3),
+                         _mm256_castsi256_si128(v));
+        _mm_storel_epi64(reinterpret_cast<__m128i*>(dst + x * 3 + 16),
+                         _mm256_extracti128_si256(v, 1));
+    }
+    return x;
+}
+
+/* 16 pixels per iteration: four pshufb compactions to 12 bytes each,
+ * stitched into three full 16-byte stores. */
+FRAME_KERNELS_TARGET("ssse3")
+static inline __m128i load_px4(const uint32_t* p, bool mirror) {
+    __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+    return mirror ? _mm_shuffle_epi32(v, _MM_SHUFFLE(0, 1, 2, 3)) : v;
+}
+
+FRAME_KERNELS_TARGET("ssse3")
+static int argb_row_ssse3(const uint32_t* src, int width, bool mirror, bool rgba, uint8_t* dst) {
+    const __m128i shuffle = rgba
+        ? _mm_setr_epi8(0, 1, 2, 4, 5, 6, 8, 9, 10, 12, 13, 14, -1, -1, -1, -1)
+        : _mm_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1);
+
+    int x = 0;
+    for (; x + 16 <= width; x += 16) {
+        __m128i a, b, c, d;
+        if (mirror) {
+            const uint32_t* p = src + width - 16 - x;
+            a = load_px4(p + 12, true);
+            b = load_px4(p + 8, true);
+            c = load_px4(p + 4, true);
+            d = load_px4(p, true);
+        } else {
+            const uint32_t* p = src + x;
+            a = load_px4(p, false);
+            b = load_px4(p + 4, false);
+            c = load_px4(p + 8, false);
+            d = load_px4(p + 12, false);
+        }
+        a = _mm_shuffle_epi8(a, shuffle);
+        b = _mm_shuffle_epi8(b, shuffle);
+        c = _mm_shuffle_epi8(c, shuffle);
+        d = _mm_shuffle_epi8(d, shuffle);
+
+        __m128i* out = reinterpret_cast<__m128i*>(dst + x * 3);
+        _mm_storeu_si128(out,     _mm_or_si128(a, _mm_slli_si128(b, 12)));
+        _mm_storeu_si128(out + 1, _mm_or_si128(_mm_srli_si128(b, 4), _mm_slli_si128(c, 8)));
+        _mm_storeu_si128(out + 2, _mm_or_si128(_mm_srli_si128(c, 8), _mm_slli_si128(d, 4)));
+    }
+    return x;
+}
+
+#endif
+
+/* ========================================================================
+ * BGR -> BGRA row kernels (camera frame -> preview surface)
+ *
+ * Same contract as the ARGB kernels above: output column x reads source
+ * pixel width - 1 - x when mirroring, the SIMD kernels return how many
+ * pixels they converted and the scalar loop finishes the row.
+ * ======================================================================== */
+
+static void bgr_row_scalar(const uint8_t* src, int width, bool mirror,
+                           int x0, int x1, uint8_t* dst) {
+    for (int x = x0; x < x1; x++) {
+        const uint8_t* p = src + (mirror ? width - 1 - x : x) * 3;
+        dst[x * 4]     = p[0];   // B
+        dst[x * 4 + 1] = p[1];   // G
+        dst[x * 4 + 2] = p[2];   // R
+        dst[x * 4 + 3] = 0xFF;   // A
+    }
+}
+
+#if defined(FRAME_KERNELS_NEON)
+
+/* 16 pixels per iteration: vld3q de-interleaves B,G,R planes, vst4q adds
+ * an opaque alpha plane. */
+static int bgr_row_neon(const uint8_t* src, int width, bool mirror, uint8_t* dst) {
+    const uint8x16_t alpha = vdupq_n_u8(0xFF);
+    int x = 0;
+    for (; x + 16 <= width; x += 16) {
+        uint8x16x3_t bgr = vld3q_u8(src + (mirror ? width - 16 - x : x) * 3);
+        uint8x16x4_t bgra;
+        if (mirror) {
+            bgra.val[0] = reverse_u8x16(bgr.val[0]);
+            bgra.val[1] = reverse_u8x16(bgr.val[1]);
+            bgra.val[2] = reverse_u8x16(bgr.val[2]);
+        } else {
+            bgra.val[0] = bgr.val[0];
+            bgra.val[1] = bgr.val[1];
+            bgra.val[2] = bgr.val[2];
+        }
+        bgra.val[3] = alpha;
+        vst4q_u8(dst + x * 4, bgra);
+    }
+    return x;
+}
+
+#elif defined(FRAME_KERNELS_X86)
+
+/* The wide kernels gather each 4-pixel group's 12 bytes into its own
+ * 16-byte lane with a masked load and dword permute (mirrored blocks take
+ * the groups in reverse), then spread them to BGRA per lane like the
+ * SSSE3 kernel.  The masked loads never read past the block. */
+
+/* 16 pixels per iteration. */
+FRAME_KERNELS_TARGET("avx512f,avx512bw")
+static int bgr_row_avx512(const uint8_t* src, int width, bool mirror, uint8_t* dst) {
+    const __m512i forward = _mm512_maskz_broadcast_i32x4(0xFFFF, _mm_setr_epi8(
+        0, 1, 2, -1, 3, 4, 5, -1, 6, 7, 8, -1, 9, 10, 11, -1));
+    const __m512i reverse = _mm512_maskz_broadcast_i32x4(0xFFFF, _mm_setr_epi8(
+        9, 10, 11, -1, 6, 7, 8, -1, 3, 4, 5, -1, 0, 1, 2, -1));
+    const __m512i groups = _mm512_setr_epi32(0, 1, 2, 0, 3, 4, 5, 0, 6, 7, 8, 0, 9, 10, 11, 0);
+    const __m512i groups_reversed = _mm512_setr_epi32(
+        9, 10, 11, 0, 6, 7, 8, 0, 3, 4, 5, 0, 0, 1, 2, 0);
+    const __m512i alpha = _mm512_set1_epi32((int)0xFF000000u);
+
+    int x = 0;
+    for (; x + 16 <= width; x += 16) {
+        __m512i v = _mm512_maskz_loadu_epi32(0x0FFF, src + (mirror ? width - 16 - x : x) * 3);
+        if (mirror) {
+            v = _mm512_shuffle_epi8(_mm512_maskz_permutexvar_epi32(0xFFFF, groups_reversed, v), reverse);
+        } else {
+            v = _mm512_shuffle_epi8(_mm512_maskz_permutexvar_epi32(0xFFFF, groups, v), forward);
+        }
+        _mm512_storeu_si512(dst + x * 4, _mm512_or_si512(v, alpha));
+    }
+    return x;
+}
+
+/* 8 pixels per iteration. */
+FRAME_KERNELS_TARGET("avx2")
+static int bgr_row_avx2(const uint8_t* src, int width, bool mirror, uint8_t* dst) {
+    const __m256i forward = _mm256_setr_epi8(
+        0, 1, 2, -1, 3, 4, 5, -1, 6, 7, 8, -1, 9, 10, 11, -1,
+        0, 1, 2, -1, 3, 4, 5, -1, 6, 7, 8, -1, 9, 10, 11, -1);
+    const __m256i reverse = _mm256_setr_epi8(
+        9, 10, 11, -1, 6, 7, 8, -1, 3, 4, 5, -1, 0, 1, 2, -1,
+        9, 10, 11, -1, 6, 7, 8, -1, 3, 4, 5, -1, 0, 1, 2, -1);
+    const __m256i groups = _mm256_setr_epi32(0, 1, 2, 0, 3, 4, 5, 0);
+    const __m256i groups_reversed = _mm256_setr_epi32(3, 4, 5, 0, 0, 1, 2, 0);
+    const __m256i load_mask = _mm256_setr_epi32(-1, -1, -1, -1, -1, -1, 0, 0);
+    const __m256i alpha = _mm256_set1_epi32((int)0xFF000000u);
+
+    int x = 0;
+    for (; x + 8 <= width; x += 8) {
+        __m256i v = _mm256_maskload_epi32(
+            reinterpret_cast<const int*>(src + (mirror ? width - 8 - x : x) * 3), load_mask);
+        if (mirror) {
+            v = _mm256_shuffle_epi8(_mm256_permutevar8x32_epi32(v, groups_reversed), reverse);
+        } else {
+            v = _mm256_shuffle_epi8(_mm256_permutevar8x32_epi32(v, groups), forward);
+        }
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + x * 4), _mm256_or_si256(v, alpha));
+    }
+    return x;
+}
+
+/* 4 pixels per pshufb: 12 of the 16 loaded bytes spread to BGRA with the
+ * alpha bytes OR-ed in.  Mirrored blocks load 4 bytes early so the load
+ * never crosses the row start, and the shuffle reverses pixel order. */
+FRAME_KERNELS_TARGET("ssse3")
+static int bgr_row_ssse3(const uint8_t* src, int width, bool mirror, uint8_t* dst) {
+    const __m128i forward = _mm_setr_epi8(
+        0, 1, 2, -1, 3, 4, 5, -1, 6, 7, 8, -1, 9, 10, 11, -1);
+    const __m128i reverse = _mm_setr_epi8(
+        13, 14, 15, -1, 10, 11, 12, -1, 7, 8, 9, -1, 4, 5, 6, -1);
+    const __m128i alpha = _mm_set1_epi32((int)0xFF000000u);
+
+    int x = 0;
+    /* Both loads read 16 bytes; stop while a full 16 remain in the row. */
+    for (; x + 6 <= width; x += 4) {
+        __m128i v;
+        if (mirror) {
+            v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(
+                src + (width - 4 - x) * 3 - 4));
+            v = _mm_shuffle_epi8(v, reverse);
+        } else {
+            v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + x * 3));
+            v = _mm_shuffle_epi8(v, forward);
+        }
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + x * 4), _mm_or_si128(v, alpha));
+    }
+    return x;
+}
+
+#endif
+
+/* ========================================================================
+ * YUV 4:2:0 -> BGRA row kernels (camera frame -> preview surface)
+ *
+ * BT.601 limited range in 6-bit fixed point, evaluated in 16-bit lanes:
+ *   Y' = 75 * (Y - 16) + 32   (32 rounds the final >> 6)
+ *   R = (Y' + 102 * V') >> 6, G = (Y' - 25 * U' - 52 * V') >> 6,
+ *   B = (Y' + 129 * U') >> 6  with U' = U - 128, V' = V - 128,
+ * clamped to 0..255.  Only B can leave int16 range, and the SIMD kernels'
+ * saturating adds clip it to the same 255 the scalar loop does, so every
+ * kernel produces identical output.
+ *
+ * The SIMD kernels handle uv_pixel_stride 1 (planar) and 2 (interleaved)
+ * and convert forward from column 0; mirroring reverses the finished row.
+ * With rgba set they swap the B and R planes before interleaving.
+ * They stop while a full chroma load still fits in the row, which for
+ * interleaved chroma is one sample earlier: its 16-byte load of the
+ * second plane ends one byte past the first plane's last sample.
+ * ======================================================================== */
+
+#define YUV_Y_GAIN 75
+#define YUV_Y_BIAS (32 - 16 * YUV_Y_GAIN)
+#define YUV_RV 102
+#define YUV_GU 25
+#define YUV_GV 52
+#define YUV_BU 129
+
+static inline uint8_t yuv_clamp(int value) {
+    return (uint8_t)(value < 0 ? 0 : value > 255 ? 255 : value);
+}
+
+static void yuv_row_scalar(const uint8_t* y, const uint8_t* u, const uint8_t* v,
+                           int uv_pixel_stride, bool rgba, int x0, int x1, uint8_t* dst) {
+    const int b_at = rgba ? 2 : 0;
+    for (int x = x0; x < x1; x++) {
+        int luma = YUV_Y_GAIN * y[x] + YUV_Y_BIAS;
+        int cu = u[(x >> 1) * uv_pixel_stride] - 128;
+        int cv = v[(x >> 1) * uv_pixel_stride] - 128;
+        dst[x * 4 + b_at]     = yuv_clamp((luma + YUV_BU * cu) >> 6);                // B
+        dst[x * 4 + 1]        = yuv_clamp((luma - YUV_GU * cu - YUV_GV * cv) >> 6);  // G
+        dst[x * 4 + 2 - b_at] = yuv_clamp((luma + YUV_RV * cv) >> 6);                // R
+        dst[x * 4 + 3]        = 0xFF;                                               // A
+    }
+}
+
+/* Chroma samples a SIMD iteration of 16 pixels reads from each plane,
+ * counting the interleaved plane's extra sample. */
+static inline int yuv_chroma_lookahead(int uv_pixel_stride) {
+    return uv_pixel_stride == 2 ? 9 : 8;
+}
+
+#if defined(FRAME_KERNELS_NEON)
+
+/* 16 pixels per iteration: 8 chroma samples (vld2 drops the other plane's
+ * bytes when interleaved), terms zipped to pixel pairs, vst4q writes BGRA. */
+static int yuv_row_neon(const uint8_t* y, const uint8_t* u, const uint8_t* v,
+                        int uv_pixel_stride, bool rgba, int width, int chroma_width,
+                        uint8_t* dst) {
+    const int lookahead = yuv_chroma_lookahead(uv_pixel_stride);
+    const int16x8_t bias = vdupq_n_s16(YUV_Y_BIAS);
+    const int16x8_t chroma_offset = vdupq_n_s16(128);
+
+    int x = 0;
+    for (; x + 16 <= width && x / 2 + lookahead <= chroma_width; x += 16) {
+        uint8x8_t u8, v8;
+        if (uv_pixel_stride == 2) {
+            u8 = vld2_u8(u + x).val[0];
+            v8 = vld2_u8(v + x).val[0];
+        } else {
+            u8 = vld1_u8(u + x / 2);
+            v8 = vld1_u8(v + x / 2);
+        }
+        int16x8_t cu = vsubq_s16(vreinterpretq_s16_u16(vmovl_u8(u8)), chroma_offset);
+        int16x8_t cv = vsubq_s16(vreinterpretq_s16_u16(vmovl_u8(v8)), chroma_offset);
+        int16x8x2_t r_c = vzipq_s16(vmulq_n_s16(cv, YUV_RV), vmulq_n_s16(cv, YUV_RV));
+        int16x8_t g_term = vmlaq_n_s16(vmulq_n_s16(cu, YUV_GU), cv, YUV_GV);
+        int16x8x2_t g_c = vzipq_s16(g_term, g_term);
+        int16x8x2_t b_c = vzipq_s16(vmulq_n_s16(cu, YUV_BU), vmulq_n_s16(cu, YUV_BU));
+
+        uint8x16_t luma = vld1q_u8(y + x);
+        int16x8_t y_lo = vmlaq_n_s16(bias, vreinterpretq_s16_u16(vmovl_u8(vget_low_u8(luma))), YUV_Y_GAIN);
+        int16x8_t y_hi = vmlaq_n_s16(bias, vreinterpretq_s16_u16(vmovl_u8(vget_high_u8(luma))), YUV_Y_GAIN);
+
+        uint8x16_t b = vcombine_u8(vqshrun_n_s16(vqaddq_s16(y_lo, b_c.val[0]), 6),
+                                   vqshrun_n_s16(vqaddq_s16(y_hi, b_c.val[1]), 6));
+        uint8x16_t r = vcombine_u8(vqshrun_n_s16(vqaddq_s16(y_lo, r_c.val[0]), 6),
+                                   vqshrun_n_s16(vqaddq_s16(y_hi, r_c.val[1]), 6));
+        uint8x16x4_t bgra;
+        bgra.val[0] = rgba ? r : b;
+        bgra.val[1] = vcombine_u8(vqshrun_n_s16(vqsubq_s16(y_lo, g_c.val[0]), 6),
+                                  vqshrun_n_s16(vqsubq_s16(y_hi, g_c.val[1]), 6));
+        bgra.val[2] = rgba ? b : r;
+        bgra.val[3] = vdupq_n_u8(0xFF);
+        vst4q_u8(dst + x * 4, bgra);
+    }
+    return x;
+}
+
+#elif defined(FRAME_KERNELS_X86)
+
+/* 16 pixels per iteration in one register of 16-bit lanes: pshufb
+ * duplicates each chroma byte for its pixel pair (dropping the other
+ * plane's bytes when interleaved), packus narrows B,G and R,A per lane, a
+ * pshufb and unpack interleave them to BGRA and two lane permutes put the
+ * four 4-pixel groups back in order.  The AVX-512 level uses this kernel
+ * too. */
+FRAME_KERNELS_TARGET("avx2")
+static int yuv_row_avx2(const uint8_t* y, const uint8_t* u, const uint8_t* v,
+                        int uv_pixel_stride, bool rgba, int width, int chroma_width,
+                        uint8_t* dst) {
+    const int lookahead = yuv_chroma_lookahead(uv_pixel_stride);
+    const __m128i pair_planar = _mm_setr_epi8(0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6, 7, 7);
+    const __m128i pair_interleaved = _mm_setr_epi8(
+        0, 0, 2, 2, 4, 4, 6, 6, 8, 8, 10, 10, 12, 12, 14, 14);
+    const __m256i interleave = _mm256_setr_epi8(
+        0, 8, 1, 9, 2, 10, 3, 11, 4, 12, 5, 13, 6, 14, 7, 15,
+        0, 8, 1, 9, 2, 10, 3, 11, 4, 12, 5, 13, 6, 14, 7, 15);
+    const __m256i bias = _mm256_set1_epi16(YUV_Y_BIAS);
+    const __m256i chroma_offset = _mm256_set1_epi16(128);
+    const __m256i alpha = _mm256_set1_epi16(0xFF);
+
+    int x = 0;
+    for (; x + 16 <= width && x / 2 + lookahead <= chroma_width; x += 16) {
+        __m128i u8, v8;
+        if (uv_pixel_stride == 2) {
+            u8 = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(u + x)),
+                                  pair_interleaved);
+            v8 = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(v + x)),
+                                  pair_interleaved);
+        } else {
+            u8 = _mm_shuffle_epi8(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(u + x / 2)),
+                                  pair_planar);
+            v8 = _mm_shuffle_epi8(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(v + x / 2)),
+                                  pair_planar);
+        }
+        __m256i cu = _mm256_sub_epi16(_mm256_cvtepu8_epi16(u8), chroma_offset);
+        __m256i cv = _mm256_sub_epi16(_mm256_cvtepu8_epi16(v8), chroma_offset);
+        __m256i luma = _mm256_add_epi16(
+            _mm256_mullo_epi16(_mm256_cvtepu8_epi16(
+                _mm_loadu_si128(reinterpret_cast<const __m128i*>(y + x))),
+                _mm256_set1_epi16(YUV_Y_GAIN)),
+            bias);
+
+        __m256i b = _mm256_srai_epi16(_mm256_adds_epi16(
+            luma, _mm256_mullo_epi16(cu, _mm256_set1_epi16(YUV_BU))), 6);
+        __m256i g = _mm256_srai_epi16(_mm256_subs_epi16(luma, _mm256_add_epi16(
+            _mm256_mullo_epi16(cu, _mm256_set1_epi16(YUV_GU)),
+            _mm256_mullo_epi16(cv, _mm256_set1_epi16(YUV_GV)))), 6);
+        __m256i r = _mm256_srai_epi16(_mm256_adds_epi16(
+            luma, _mm256_mullo_epi16(cv, _mm256_set1_epi16(YUV_RV))), 6);
+
+        if (rgba) std::swap(b, r);
+
+        /* Per lane: b0-7 g0-7 -> b0 g0 b1 g1 ..., likewise r and alpha. */
+        __m256i bg = _mm256_shuffle_epi8(_mm256_packus_epi16(b, g), interleave);
+        __m256i ra = _mm256_shuffle_epi8(_mm256_packus_epi16(r, alpha), interleave);
+        __m256i lo = _mm256_unpacklo_epi16(bg, ra);   /* pixels 0-3 | 8-11 */
+        __m256i hi = _mm256_unpackhi_epi16(bg, ra);   /* pixels 4-7 | 12-15 */
+        __m256i* out = reinterpret_cast<__m256i*>(dst + x * 4);
+        _mm256_storeu_si256(out, _mm256_permute2x128_si256(lo, hi, 0x20));
+        _mm256_storeu_si256(out + 1, _mm256_permute2x128_si256(lo, hi, 0x31));
+    }
+    return x;
+}
+
+/* 16 pixels per iteration as two halves of 8 16-bit lanes; chroma terms
+ * are computed once per sample and unpacked to pixel pairs. */
+FRAME_KERNELS_TARGET("ssse3")
+static int yuv_row_ssse3(const uint8_t* y, const uint8_t* u, const uint8_t* v,
+                         int uv_pixel_stride, bool rgba, int width, int chroma_width,
+                         uint8_t* dst) {
+    const int lookahead = yuv_chroma_lookahead(uv_pixel_stride);
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i low_bytes = _mm_set1_epi16(0xFF);
+    const __m128i bias = _mm_set1_epi16(YUV_Y_BIAS);
+    const __m128i gain = _mm_set1_epi16(YUV_Y_GAIN);
+    const __m128i chroma_offset = _mm_set1_epi16(128);
+    const __m128i alpha = _mm_set1_epi8((char)0xFF);
+
+    int x = 0;
+    for (; x + 16 <= width && x / 2 + lookahead <= chroma_width; x += 16) {
+        __m128i cu, cv;
+        if (uv_pixel_stride == 2) {
+            cu = _mm_and_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(u + x)), low_bytes);
+            cv = _mm_and_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(v + x)), low_bytes);
+        } else {
+            cu = _mm_unpacklo_epi8(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(u + x / 2)), zero);
+            cv = _mm_unpacklo_epi8(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(v + x / 2)), zero);
+        }
+        cu = _mm_sub_epi16(cu, chroma_offset);
+        cv = _mm_sub_epi16(cv, chroma_offset);
+        __m128i r_c = _mm_mullo_epi16(cv, _mm_set1_epi16(YUV_RV));
+        __m128i g_c = _mm_add_epi16(_mm_mullo_epi16(cu, _mm_set1_epi16(YUV_GU)),
+                                    _mm_mullo_epi16(cv, _mm_set1_epi16(YUV_GV)));
+        __m128i b_c = _mm_mullo_epi16(cu, _mm_set1_epi16(YUV_BU));
+
+        __m128i luma = _mm_loadu_si128(reinterpret_cast<const __m128i*>(y + x));
+        __m128i y_lo = _mm_add_epi16(_mm_mullo_epi16(_mm_unpacklo_epi8(luma, zero), gain), bias);
+        __m128i y_hi = _mm_add_epi16(_mm_mullo_epi16(_mm_unpackhi_epi8(luma, zero), gain), bias);
+
+        __m128i b = _mm_packus_epi16(
+            _mm_srai_epi16(_mm_adds_epi16(y_lo, _mm_unpacklo_epi16(b_c, b_c)), 6),
+            _mm_srai_epi16(_mm_adds_epi16(y_hi, _mm_unpackhi_epi16(b_c, b_c)), 6));
+        __m128i g = _mm_packus_epi16(
+            _mm_srai_epi16(_mm_subs_epi16(y_lo, _mm_unpacklo_epi16(g_c, g_c)), 6),
+            _mm_srai_epi16(_mm_subs_epi16(y_hi, _mm_unpackhi_epi16(g_c, g_c)), 6));
+        __m128i r = _mm_packus_epi16(
+            _mm_srai_epi16(_mm_adds_epi16(y_lo, _mm_unpacklo_epi16(r_c, r_c)), 6),
+            _mm_srai_epi16(_mm_adds_epi16(y_hi, _mm_unpackhi_epi16(r_c, r_c)), 6));
+        if (rgba) std::swap(b, r);
+
+        __m128i bg_lo = _mm_unpacklo_epi8(b, g), bg_hi = _mm_unpackhi_epi8(b, g);
+        __m128i ra_lo = _mm_unpacklo_epi8(r, alpha), ra_hi = _mm_unpackhi_epi8(r, alpha);
+        __m128i* out = reinterpret_cast<__m128i*>(dst + x * 4);
+        _mm_storeu_si128(out,     _mm_unpacklo_epi16(bg_lo, ra_lo));
+        _mm_storeu_si128(out + 1, _mm_unpackhi_epi16(bg_lo, ra_lo));
+        _mm_storeu_si128(out + 2, _mm_unpacklo_epi16(bg_hi, ra_hi));
+        _mm_storeu_si128(out + 3, _mm_unpackhi_epi16(bg_hi, ra_hi));
+    }
+    return x;
+}
+
+#endif
+
+/* ========================================================================
+ * Kernel selection
+ * ======================================================================== */
+
+typedef int (*ArgbRowFn)(const uint32_t* src, int width, bool mirror, bool rgba, uint8_t* dst);
+typedef int (*BgrRowFn)(const uint8_t* src, int width, bool mirror, uint8_t* dst);
+typedef int (*YuvRowFn)(const uint8_t* y, const uint8_t* u, const uint8_t* v,
+                        int uv_pixel_stride, bool rgba, int width, int chroma_width,
+                        uint8_t* dst);
+
+struct FrameKernels {
+    const char* isa;
+    ArgbRowFn argb_row;
+    BgrRowFn bgr_row;
+    YuvRowFn yuv_row;
+};
+
+static int argb_row_none(const uint32_t*, int, bool, bool, uint8_t*) {
+    return 0;
+}
+
+static int bgr_row_none(const uint8_t*, int, bool, uint8_t*) {
+    return 0;
+}
+
+static int yuv_row_none(const uint8_t*, const uint8_t*, const uint8_t*, int, bool, int, int,
+                        uint8_t*) {
+    return 0;
+}
+
+#if defined(FRAME_KERNELS_X86)
+
+static void cpuid(unsigned leaf, unsigned subleaf, unsigned regs[4]) {
+#if defined(_MSC_VER) && !defined(__clang__)
+    __cpuidex(reinterpret_cast<int*>(regs), (int)leaf, (int)subleaf);
+#else
+    __cpuid_count(leaf, subleaf, regs[0], regs[1], regs[2], regs[3]);
+#endif
+}
+
+/* XCR0: which register states the OS saves across context switches. */
+static uint64_t xcr0() {
+#if defined(_MSC_VER) && !defined(__clang__)
+    return _xgetbv(0);
+#else
+    uint32_t lo, hi;
+    __asm__ volatile("xgetbv" : "=a"(lo), "=d"(hi) : "c"(0));
+    return ((uint64_t)hi << 32) | lo;
+#endif
+}
+
+enum X86Level { X86_BASELINE, X86_SSSE3, X86_AVX2, X86_AVX512 };
+
+static X86Level x86_level() {
+    unsigned r[4];
+    cpuid(0, 0, r);
+    const unsigned max_leaf = r[0];
+    cpuid(1, 0, r);
+    const bool ssse3 = (r[2] >> 9) & 1;
+    const bool osxsave = (r[2] >> 27) & 1;
+    if (!ssse3) return X86_BASELINE;
+    if (!osxsave || max_leaf < 7) return X86_SSSE3;
+
+    const uint64_t xcr = xcr0();
+    cpuid(7, 0, r);
+    const bool avx2 = ((r[1] >> 5) & 1) && (xcr & 0x6) == 0x6;
+    const bool avx512 = ((r[1] >> 16) & 1) && ((r[1] >> 30) & 1) && (xcr & 0xE6) == 0xE6;
+    if (avx512 && avx2) return X86_AVX512;
+    if (avx2) return X86_AVX2;
+    return X86_SSSE3;
+}
+
+#endif
+
+/* ORPHEUS_FRAME_KERNELS=scalar|ssse3|avx2 caps the choice, for comparing
+ * the variants on one machine. */
+static FrameKernels select_frame_kernels() {
+    const char* cap = getenv("ORPHEUS_FRAME_KERNELS");
+    if (cap != nullptr && strcmp(cap, "scalar") == 0) {
+        return {"scalar", argb_row_none, bgr_row_none, yuv_row_none};
+    }
+#if defined(FRAME_KERNELS_NEON)
+    return {"neon", argb_row_neon, bgr_row_neon, yuv_row_neon};
+#elif defined(FRAME_KERNELS_X86)
+    X86Level level = x86_level();
+    if (cap != nullptr && strcmp(cap, "ssse3") == 0 && level > X86_SSSE3) level = X86_SSSE3;
+    if (cap != nullptr && strcmp(cap, "avx2") == 0 && level > X86_AVX2) level = X86_AVX2;
+    switch (level) {
+        case X86_AVX512: return {"avx512", argb_row_avx512, bgr_row_avx512, yuv_row_avx2};
+        case X86_AVX2:   return {"avx2", argb_row_avx2, bgr_row_avx2, yuv_row_avx2};
+        case X86_SSSE3:  return {"ssse3", argb_row_ssse3, bgr_row_ssse3, yuv_row_ssse3};
+        default:         break;
+    }
+#endif
+    return {"scalar", argb_row_none, bgr_row_none, yuv_row_none};
+}
+
+static const FrameKernels& frame_kernels() {
+    static const FrameKernels kernels = select_frame_kernels();
+    return kernels;
+}
+
+/* ========================================================================
+ * Public entry points
+ * ======================================================================== */
+
+const char* frame_kernels_isa() {
+    return frame_kernels().isa;
+}
+
+void frame_bgr_to_bgra(const uint8_t* src, int width, int height,
+                       int src_stride, bool mirror, uint8_t* dst) {
+    const BgrRowFn bgr_row = frame_kernels().bgr_row;
+    for (int y = 0; y < height; y++) {
+        const uint8_t* src_row = src + static_cast<size_t>(y) * src_stride;
+        uint8_t* dst_row = dst + static_cast<size_t>(y) * width * 4;
+        int done = bgr_row(src_row, width, mirror, dst_row);
+        bgr_row_scalar(src_row, width, mirror, done, width, dst_row);
+    }
+}
+
+static void yuv420_convert(const uint8_t* y, int y_stride,
+                           const uint8_t* u, const uint8_t* v,
+                           int uv_stride, int uv_pixel_stride,
+                           int width, int height, bool mirror, bool rgba, uint8_t* dst) {
+    const YuvRowFn yuv_row = (uv_pixel_stride == 1 || uv_pixel_stride == 2)
+        ? frame_kernels().yuv_row : yuv_row_none;
+    const int chroma_width = (width + 1) / 2;
+    for (int row = 0; row < height; row++) {
+        const uint8_t* y_row = y + static_cast<size_t>(row) * y_stride;
+        const size_t uv_offset = static_cast<size_t>(row / 2) * uv_stride;
+        uint8_t* dst_row = dst + static_cast<size_t>(row) * width * 4;
+        int done = yuv_row(y_row, u + uv_offset, v + uv_offset, uv_pixel_stride, rgba,
+                           width, chroma_width, dst_row);
+        yuv_row_scalar(y_row, u + uv_offset, v + uv_offset, uv_pixel_stride, rgba,
+                       done, width, dst_row);
+        if (mirror) {
+            uint32_t* pixels = reinterpret_cast<uint32_t*>(dst_row);
+            std::reverse(pixels, pixels + width);
+        }
+    }
+}
+
+void frame_yuv420_to_bgra(const uint8_t* y, int y_stride,
+                          const uint8_t* u, const uint8_t* v,
+                          int uv_stride, int uv_pixel_stride,
+                          int width, int height, bool mirror, uint8_t* dst) {
+    yuv420_convert(y, y_stride, u, v, uv_stride, uv_pixel_stride, width, height,
+                   mirror, false, dst);
+}
+
+void frame_yuv420_to_rgba(const uint8_t* y, int y_stride,
+                          const uint8_t* u, const uint8_t* v,
+                          int uv_stride, int uv_pixel_stride,
+                          int width, int height, bool mirror, uint8_t* dst) {
+    yuv420_convert(y, y_stride, u, v, uv_stride, uv_pixel_stride, width, height,
+                   mirror, true, dst);
+}
+
+static void to_rgb_square(const uint32_t* src, int width, int height,
+                          int src_stride, bool mirror, bool rgba, uint8_t* dst) {
+    const int size = frame_square_size(width, height);
+    const int pad_x = (size - width) / 2;
+    const int pad_y = (size - height) / 2;
+    const size_t row_bytes = static_cast<size_t>(size) * 3;
+    const ArgbRowFn argb_row = frame_kernels().argb_row;
+
+    // Top and bottom letterbox bands.
+    memset(dst, 0, row_bytes * pad_y);
+    memset(dst + row_bytes * (pad_y + height), 0,
+           row_bytes * (size - pad_y - height));
+
+    for (int y = 0; y < height; y++) {
+        const uint32_t* src_row = src + static_cast<size_t>(y) * src_stride;
+        uint8_t* dst_row = dst + row_bytes * (pad_y + y);
+
+        // Left and right letterbox bands.
+        memset(dst_row, 0, static_cast<size_t>(pad_x) * 3);
+        memset(dst_row + static_cast<size_t>(pad_x + width) * 3, 0,
+               static_cast<size_t>(size - pad_x - width) * 3);
+
+        uint8_t* out = dst_row + static_cast<size_t>(pad_x) * 3;
+        int done = argb_row(src_row, width, mirror, rgba, out);
+        argb_row_scalar(src_row, width, mirror, rgba, done, width, out);
+    }
+}
+
+void frame_argb_to_rgb_square(const uint32_t* src, int width, int height,
+                              int src_stride, bool mirror, uint8_t* dst) {
+    to_rgb_square(src, width, height, src_stride, mirror, false, dst);
+}
+
+void frame_rgba_to_rgb_square(const uint32_t* src, int width, int height,
+                              int src_stride, bool mirror, uint8_t* dst) {
+    to_rgb_square(src, width, height, src_stride, mirror, true, dst);
+}
+
+/* Bilinear taps are precomputed once per output column / row: the source
+ * index of the left (top) tap and an 8-bit weight for the right (bottom)
+ * one.  Taps outside the image read as black. */
+struct CropTap {
+    int index;        /* image column/row of the first tap, may be out of range */
+    uint32_t weight;  /* 0..256 weight of the second tap */
+};
+
+static void crop_taps(float start, float step, int count, CropTap* taps) {
+    for (int i = 0; i < count; i++) {
+        float pos = start + (static_cast<float>(i) + 0.5f) * step - 0.5f;
+        float base = pos < 0.0f ? static_cast<float>(static_cast<int>(pos) - 1)
+                                : static_cast<float>(static_cast<int>(pos));
+        taps[i].index = static_cast<int>(base);
+        taps[i].weight = static_cast<uint32_t>((pos - base) * 256.0f + 0.5f);
+    }
+}
+
+static inline uint32_t crop_fetch(const uint32_t* row, int width, int x) {
+    return (row != nullptr && x >= 0 && x < width) ? row[x] : 0u;
+}
+
+/* Blend one 8-bit channel of four taps; weights are 0..256. */
+static inline uint8_t crop_blend(uint32_t p00, uint32_t p01, uint32_t p10, uint32_t p11,
+                                 int shift, uint32_t wx, uint32_t wy) {
+    uint32_t c00 = (p00 >> shift) & 0xFF, c01 = (p01 >> shift) & 0xFF;
+    uint32_t c10 = (p10 >> shift) & 0xFF, c11 = (p11 >> shift) & 0xFF;
+    uint32_t top = c00 * (256 - wx) + c01 * wx;
+    uint32_t bottom = c10 * (256 - wx) + c11 * wx;
+    return static_cast<uint8_t>((top * (256 - wy) + bottom * wy + (1u << 15)) >> 16);
+}
+
+static void crop_to_rgb(const uint32_t* src, int width, int height,
+                        int src_stride, bool mirror, bool rgba,
+                        float crop_x, float crop_y, float crop_size,
+                        int out_size, uint8_t* dst) {
+    const int r_shift = rgba ? 0 : 16;
+    const int size = frame_square_size(width, height);
+    const float pad_x = static_cast<float>((size - width) / 2);
+    const float pad_y = static_cast<float>((size - height) / 2);
+    const float step = crop_size / static_cast<float>(out_size);
+
+    CropTap cols[FRAME_CROP_MAX_SIZE];
+    CropTap rows[FRAME_CROP_MAX_SIZE];
+    crop_taps(crop_x - pad_x, step, out_size, cols);
+    crop_taps(crop_y - pad_y, step, out_size, rows);
+    if (mirror) {
+        /* Mirrored column c reads image column width - 1 - c: flip the tap
+         * pair so index stays the left-hand source column. */
+        for (int x = 0; x < out_size; x++) {
+            int right = width - 1 - cols[x].index;
+            cols[x].index = right - (cols[x].weight > 0 ? 1 : 0);
+            cols[x].weight = cols[x].weight > 0 ? 256 - cols[x].weight : 0;
+        }
+    }
+
+    for (int y = 0; y < out_size; y++) {
+        int iy = rows[y].index;
+        const uint32_t* row0 = (iy >= 0 && iy < height)
+            ? src + static_cast<size_t>(iy) * src_stride : nullptr;
+        const uint32_t* row1 = (iy + 1 >= 0 && iy + 1 < height)
+            ? src + static_cast<size_t>(iy + 1) * src_stride : nullptr;
+        uint32_t wy = rows[y].weight;
+        uint8_t* out = dst + static_cast<size_t>(y) * out_size * 3;
+
+        for (int x = 0; x < out_size; x++) {
+            int ix = cols[x].index;
+            uint32_t wx = cols[x].weight;
+            uint32_t p00 = crop_fetch(row0, width, ix), p01 = crop_fetch(row0, width, ix + 1);
+            uint32_t p10 = crop_fetch(row1, width, ix), p11 = crop_fetch(row1, width, ix + 1);
+            out[x * 3]     = crop_blend(p00, p01, p10, p11, r_shift, wx, wy);       // R
+            out[x * 3 + 1] = crop_blend(p00, p01, p10, p11, 8, wx, wy);             // G
+            out[x * 3 + 2] = crop_blend(p00, p01, p10, p11, 16 - r_shift, wx, wy);  // B
+        }
+    }
+}
+
+void frame_argb_crop_to_rgb(const uint32_t* src, int width, int height,
+                            int src_stride, bool mirror,
+                            float crop_x, float crop_y, float crop_size,
+                            int out_size, uint8_t* dst) {
+    crop_to_rgb(src, width, height, src_stride, mirror, false,
+                crop_x, crop_y, crop_size, out_size, dst);
+}
+
+void frame_rgba_crop_to_rgb(const uint32_t* src, int width, int height,
+                            int src_stride, bool mirror,
+                            float crop_x, float crop_y, float crop_size,
+                            int out_size, uint8_t* dst) {
+    crop_to_rgb(src, width, height, src_stride, mirror, true,
+                crop_x, crop_y, crop_size, out_size, dst);
+}
@@ -0,0 +1,94 @@
+#ifndef ORPHEUS_MEDIAPIPE_FRAME_KERNELS_H_
+#define ORPHEUS_MEDIAPIPE_FRAME_KERNELS_H_
+
+#include <cstdint>
+
+/*
+ * Frame preprocessing kernels for the MediaPipe JNI bridge.
+ * No JNI or MediaPipe dependencies — plain pixel loops, vectorized with
+ * NEON on ARM64 and with SSSE3, AVX2 or AVX-512 on x86_64, whichever is
+ * the widest the CPU supports at runtime.
+ */
+
+/* Instruction set of the row kernels in use: "neon", "avx512", "avx2",
+ * "ssse3" or "scalar". */
+const char* frame_kernels_isa();
+
+/* Side length of the letterboxed square for a width x height frame. */
+static inline int frame_square_size(int width, int height) {
+    return width > height ? width : height;
+}
+
+/* Convert an ARGB frame (Java int-packed pixels, i.e. B,G,R,A bytes in
+ * little-endian memory) into a packed RGB square of side
+ * frame_square_size(width, height), in a single pass:
+ *   - optional horizontal flip (mirror),
+ *   - centered black letterbox padding,
+ *   - ARGB -> RGB channel swizzle.
+ *
+ * src_stride is the source row length in pixels (>= width).
+ * dst must hold size*size*3 bytes. */
+void frame_argb_to_rgb_square(const uint32_t* src, int width, int height,
+                              int src_stride, bool mirror, uint8_t* dst);
+
+/* frame_argb_to_rgb_square for R,G,B,A source bytes, e.g. the output of
+ * frame_yuv420_to_rgba. */
+void frame_rgba_to_rgb_square(const uint32_t* src, int width, int height,
+                              int src_stride, bool mirror, uint8_t* dst);
+
+/* Convert a packed BGR24 camera frame (src_stride bytes per row) into a
+ * tightly packed BGRA frame with opaque alpha, optionally mirrored.  The
+ * result is both a Skia BGRA_8888 surface and, read as uint32_t, an ARGB
+ * frame for the kernels below (with mirror false — it already is).
+ * dst must hold width*height*4 bytes. */
+void frame_bgr_to_bgra(const uint8_t* src, int width, int height,
+                       int src_stride, bool mirror, uint8_t* dst);
+
+/* Convert a YUV 4:2:0 camera frame into a tightly packed BGRA frame with
+ * opaque alpha, optionally mirrored — the same output as
+ * frame_bgr_to_bgra, so it serves as both preview surface and ARGB source.
+ * Uses BT.601 limited range, like CameraX's own YUV_420_888 -> RGB path and
+ * most webcam NV12 streams.
+ *
+ * The planes are described the way Android's YUV_420_888 does it, which
+ * covers the common layouts:
+ *   I420 (planar):      u, v separate, uv_pixel_stride 1
+ *   NV12 (interleaved): v = u + 1,     uv_pixel_stride 2
+ *   NV21 (interleaved): u = v + 1,     uv_pixel_stride 2
+ * y_stride and uv_stride are row lengths in bytes (>= the row's pixels, so
+ * padded rows work).  Chroma covers (width+1)/2 x (height+1)/2 samples.
+ * dst must hold width*height*4 bytes. */
+void frame_yuv420_to_bgra(const uint8_t* y, int y_stride,
+                          const uint8_t* u, const uint8_t* v,
+                          int uv_stride, int uv_pixel_stride,
+                          int width, int height, bool mirror, uint8_t* dst);
+
+/* frame_yuv420_to_bgra with R,G,B,A byte order: the memory layout of an
+ * Android ARGB_8888 Bitmap, for previews shown there. */
+void frame_yuv420_to_rgba(const uint8_t* y, int y_stride,
+                          const uint8_t* u, const uint8_t* v,
+                          int uv_stride, int uv_pixel_stride,
+                          int width, int height, bool mirror, uint8_t* dst);
+
+/* Crop a square window out of the letterboxed (and optionally mirrored)
+ * RGB square that frame_argb_to_rgb_square would produce, and resample it
+ * bilinearly to out_size x out_size packed RGB — without materializing the
+ * full square.
+ *
+ * crop_x, crop_y (top-left) and crop_size are in square pixels and may
+ * extend past the square; anything outside the camera image is black.
+ * dst must hold out_size*out_size*3 bytes; out_size <= FRAME_CROP_MAX_SIZE. */
+#define FRAME_CROP_MAX_SIZE 1024
+
+void frame_argb_crop_to_rgb(const uint32_t* src, int width, int height,
+                            int src_stride, bool mirror,
+                            float crop_x, float crop_y, float crop_size,
+                            int out_size, uint8_t* dst);
+
+/* frame_argb_crop_to_rgb for R,G,B,A source bytes. */
+void frame_rgba_crop_to_rgb(const uint32_t* src, int width, int height,
+                            int src_stride, bool mirror,
+                            float crop_x, float crop_y, float crop_size,
+                            int out_size, uint8_t* dst);
+
+#endif  // ORPHEUS_MEDIAPIPE_FRAME_KERNELS_H_
@@ -0,0 +1,95 @@
+#include "gesture_schedule.h"
+
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+
+/* Below this hand scale the pose is noise; treat it as unnormalizable. */
+static const float kMinScale = 0.001f;
+
+/* Wrist-relative x/y of all 21 landmarks, divided by wrist-to-middle-MCP. */
+static void normalize_pose(const float* xyz, float* pose) {
+    const float wx = xyz[0];
+    const float wy = xyz[1];
+    const float mx = xyz[9 * 3] - wx;
+    const float my = xyz[9 * 3 + 1] - wy;
+    float scale = sqrtf(mx * mx + my * my);
+    const float inv = 1.0f / (scale > kMinScale ? scale : kMinScale);
+    for (int i = 0; i < 21; i++) {
+        pose[i * 2]     = (xyz[i * 3] - wx) * inv;
+        pose[i * 2 + 1] = (xyz[i * 3 + 1] - wy) * inv;
+    }
+}
+
+static float pose_distance(const float* a, const float* b) {
+    float sum = 0.0f;
+    for (int i = 0; i < 21; i++) {
+        const float dx = a[i * 2] - b[i * 2];
+        const float dy = a[i * 2 + 1] - b[i * 2 + 1];
+        sum += sqrtf(dx * dx + dy * dy);
+    }
+    return sum / 21.0f;
+}
+
+void gesture_schedule_init(GestureSchedule* s, int interval, float motion_threshold) {
+    memset(s, 0, sizeof(*s));
+    s->interval = interval;
+    s->motion_threshold = motion_threshold;
+    s->force_full = true;
+}
+
+bool gesture_schedule_due(const GestureSchedule* s) {
+    return s->interval <= 1 || s->force_full;
+}
+
+void gesture_schedule_on_full(GestureSchedule* s, const float* const* xyz,
+                              const char* const* label, const float* score) {
+    s->since_full = 0;
+    s->force_full = false;
+    s->present = 0;
+    for (int slot = 0; slot < GESTURE_SCHEDULE_MAX_HANDS; slot++) {
+        s->label[slot][0] = '\0';
+        s->score[slot] = 0.0f;
+        if (xyz[slot] == nullptr) continue;
+        s->present |= 1u << slot;
+        normalize_pose(xyz[slot], s->pose[slot]);
+        if (label[slot] != nullptr) {
+            snprintf(s->label[slot], GESTURE_SCHEDULE_NAME_LEN, "%s", label[slot]);
+            s->score[slot] = score[slot];
+        }
+    }
+}
+
+void gesture_schedule_on_tracking(GestureSchedule* s, const float* const* xyz) {
+    s->since_full++;
+    if (s->since_full + 1 >= s->interval) s->force_full = true;
+
+    unsigned present = 0;
+    for (int slot = 0; slot < GESTURE_SCHEDULE_MAX_HANDS; slot++) {
+        if (xyz[slot] == nullptr) continue;
+        present |= 1u << slot;
+        if (!(s->present & (1u << slot))) continue;
+        float pose[21 * 2];
+        normalize_pose(xyz[slot], pose);
+        if (pose_distance(pose, s->pose[slot]) > s->motion_threshold) s->force_full = true;
+    }
+    if (present != s->present) s->force_full = true;
+}
+
+void gesture_schedule_invalidate(GestureSchedule* s) {
+    s->force_full = true;
+}
+
+const char* gesture_schedule_label(const GestureSchedule* s, int slot, float* score) {
+    if (!(s->present & (1u << slot)) || s->label[slot][0] == '\0') return nullptr;
+    *score = s->score[slot];
+    return s->label[slot];
+}
+
+float gesture_schedule_pose_distance(const float* a_xyz, const float* b_xyz) {
+    float a[21 * 2];
+    float b[21 * 2];
+    normalize_pose(a_xyz, a);
+    normalize_pose(b_xyz, b);
+    return pose_distance(a, b);
+}
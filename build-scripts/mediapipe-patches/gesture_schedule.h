@@ -0,0 +1,60 @@
+#ifndef ORPHEUS_MEDIAPIPE_GESTURE_SCHEDULE_H_
+#define ORPHEUS_MEDIAPIPE_GESTURE_SCHEDULE_H_
+
+/*
+ * Skip-frame scheduling of gesture recognition for the MediaPipe JNI bridge.
+ * No JNI or MediaPipe dependencies.  Decides per frame whether the
+ * recognizer runs the full graph (landmarks + gesture classification) or
+ * whether landmarks alone are enough and the previous label can be kept.
+ *
+ * A full recognition is due every `interval` frames, and early when a
+ * tracked hand's pose has drifted from the pose last classified or the set
+ * of hands has changed.  Pose drift is the mean wrist-relative landmark
+ * displacement in units of hand scale (wrist to middle MCP), so moving a
+ * held pose around the frame or towards the camera does not count.
+ *
+ * Hands are addressed by the bridge's handedness slots; landmarks are
+ * 21*xyz in any space that is uniformly scaled on x/y (only x/y are read).
+ */
+
+#define GESTURE_SCHEDULE_MAX_HANDS 2
+#define GESTURE_SCHEDULE_NAME_LEN 48
+
+struct GestureSchedule {
+    int interval;              /* full recognition at least every N frames; <= 1 = always */
+    float motion_threshold;    /* pose drift that forces a full recognition */
+    int since_full;            /* frames since the last full recognition */
+    bool force_full;           /* next frame must be a full recognition */
+    unsigned present;          /* bitmask of slots present at the last full recognition */
+    float pose[GESTURE_SCHEDULE_MAX_HANDS][21 * 2];   /* normalized pose per slot */
+    char label[GESTURE_SCHEDULE_MAX_HANDS][GESTURE_SCHEDULE_NAME_LEN];   /* "" = none */
+    float score[GESTURE_SCHEDULE_MAX_HANDS];
+};
+
+/* Set the cadence and make the next frame a full recognition. */
+void gesture_schedule_init(GestureSchedule* s, int interval, float motion_threshold);
+
+/* Whether the next frame needs the full recognizer. */
+bool gesture_schedule_due(const GestureSchedule* s);
+
+/* Record a full recognition: xyz[slot] is the hand's 21*xyz, or nullptr if
+ * the slot is empty; label[slot] may be nullptr for no gesture. */
+void gesture_schedule_on_full(GestureSchedule* s, const float* const* xyz,
+                              const char* const* label, const float* score);
+
+/* Record a landmarks-only frame.  Schedules a full recognition for the next
+ * frame when the interval is up, a pose drifted past the threshold, or a
+ * hand appeared or left. */
+void gesture_schedule_on_tracking(GestureSchedule* s, const float* const* xyz);
+
+/* Force a full recognition on the next frame (e.g. after a failed frame). */
+void gesture_schedule_invalidate(GestureSchedule* s);
+
+/* Label kept for slot from the last full recognition, or nullptr. */
+const char* gesture_schedule_label(const GestureSchedule* s, int slot, float* score);
+
+/* Pose drift between two hands: mean x/y landmark distance once each is
+ * made wrist-relative and divided by its own hand scale. */
+float gesture_schedule_pose_distance(const float* a_xyz, const float* b_xyz);
+
+#endif  // ORPHEUS_MEDIAPIPE_GESTURE_SCHEDULE_H_
@@ -0,0 +1,71 @@
+#include "hand_features.h"
+
+#include <cmath>
+
+/* Landmark indices (MediaPipe 21-point hand model). */
+static const int kWrist = 0;
+static const int kThumbTip = 4;
+static const int kIndexMcp = 5;
+static const int kMiddleMcp = 9;
+static const int kPinkyMcp = 17;
+
+/* First landmark of each finger's chain: thumb CMC, then the four MCPs.
+ * Each chain is four consecutive landmarks ending at the tip. */
+static const int kFingerBase[5] = {1, 5, 9, 13, 17};
+
+static inline float dist2d(const float* xyz, int a, int b) {
+    float dx = xyz[a * 3] - xyz[b * 3];
+    float dy = xyz[a * 3 + 1] - xyz[b * 3 + 1];
+    return sqrtf(dx * dx + dy * dy);
+}
+
+static inline void sub3(const float* xyz, int to, int from, float* v) {
+    v[0] = xyz[to * 3] - xyz[from * 3];
+    v[1] = xyz[to * 3 + 1] - xyz[from * 3 + 1];
+    v[2] = xyz[to * 3 + 2] - xyz[from * 3 + 2];
+}
+
+/* Angle between two vectors, 0 if either is degenerate. */
+static float angle3(const float* a, const float* b) {
+    float na = a[0] * a[0] + a[1] * a[1] + a[2] * a[2];
+    float nb = b[0] * b[0] + b[1] * b[1] + b[2] * b[2];
+    float denom = sqrtf(na * nb);
+    if (denom <= 1e-12f) return 0.0f;
+    float c = (a[0] * b[0] + a[1] * b[1] + a[2] * b[2]) / denom;
+    if (c > 1.0f) c = 1.0f;
+    if (c < -1.0f) c = -1.0f;
+    return acosf(c);
+}
+
+void hand_features_compute(const float* xyz, float* features) {
+    float scale = dist2d(xyz, kWrist, kMiddleMcp);
+    features[HAND_FEATURE_SCALE] = scale;
+    float inv_scale = 1.0f / (scale > HAND_FEATURE_MIN_SCALE ? scale : HAND_FEATURE_MIN_SCALE);
+
+    for (int f = 0; f < 5; f++) {
+        int base = kFingerBase[f];
+        int tip = base + 3;
+        features[HAND_FEATURE_TIP_TO_WRIST + f] = dist2d(xyz, tip, kWrist) * inv_scale;
+
+        float first[3], last[3];
+        sub3(xyz, base + 1, base, first);
+        sub3(xyz, tip, base + 2, last);
+        features[HAND_FEATURE_CURL + f] = angle3(first, last);
+    }
+
+    float a[3], b[3];
+    sub3(xyz, kIndexMcp, kWrist, a);
+    sub3(xyz, kPinkyMcp, kWrist, b);
+    float n[3] = {
+        a[1] * b[2] - a[2] * b[1],
+        a[2] * b[0] - a[0] * b[2],
+        a[0] * b[1] - a[1] * b[0],
+    };
+    float len = sqrtf(n[0] * n[0] + n[1] * n[1] + n[2] * n[2]);
+    float inv_len = len > 1e-12f ? 1.0f / len : 0.0f;
+    for (int i = 0; i < 3; i++) features[HAND_FEATURE_PALM_NORMAL + i] = n[i] * inv_len;
+
+    for (int f = 1; f < 5; f++) {
+        features[HAND_FEATURE_PINCH + f - 1] = dist2d(xyz, kThumbTip, kFingerBase[f] + 3);
+    }
+}
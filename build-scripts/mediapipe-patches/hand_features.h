@@ -0,0 +1,32 @@
+#ifndef ORPHEUS_MEDIAPIPE_HAND_FEATURES_H_
+#define ORPHEUS_MEDIAPIPE_HAND_FEATURES_H_
+
+/*
+ * Per-hand geometric features for the MediaPipe JNI bridge.
+ * No JNI or MediaPipe dependencies.  Computed once per result from the
+ * output-space landmarks (21*xyz, landmark_filter.h layout) so Kotlin
+ * consumers share one vector instead of recomputing distances and angles.
+ *
+ * Layout (keep in sync with org.balch.orpheus.core.gestures.HandFeatures):
+ *   [0]      hand scale: wrist to middle MCP, x/y only
+ *   [1..5]   fingertip to wrist, x/y only, divided by hand scale
+ *   [6..10]  finger curl: angle in radians between the first and last bone
+ *            of each finger (0 straight, pi folded back), 3D
+ *   [11..13] palm normal: unit (index MCP - wrist) x (pinky MCP - wrist), 3D
+ *   [14..17] thumb tip to index/middle/ring/pinky tip, x/y only
+ * Fingers are ordered thumb, index, middle, ring, pinky.
+ */
+
+#define HAND_FEATURE_SCALE 0
+#define HAND_FEATURE_TIP_TO_WRIST 1
+#define HAND_FEATURE_CURL 6
+#define HAND_FEATURE_PALM_NORMAL 11
+#define HAND_FEATURE_PINCH 14
+#define HAND_FEATURE_COUNT 18
+
+/* Hand scale floor for the normalized distances. */
+#define HAND_FEATURE_MIN_SCALE 0.001f
+
+void hand_features_compute(const float* xyz, float* features);
+
+#endif  // ORPHEUS_MEDIAPIPE_HAND_FEATURES_H_
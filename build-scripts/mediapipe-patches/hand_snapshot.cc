@@ -0,0 +1,67 @@
+#include "hand_snapshot.h"
+
+#include <cstdio>
+#include <cstring>
+
+void hand_snapshot_init(HandSnapshot* s, int float_count) {
+    s->sequence.store(0, std::memory_order_relaxed);
+    for (int i = 0; i < HAND_SNAPSHOT_MAX_FLOATS; i++) {
+        s->words[i].store(0, std::memory_order_relaxed);
+    }
+    s->float_count = float_count < HAND_SNAPSHOT_MAX_FLOATS ? float_count
+                                                             : HAND_SNAPSHOT_MAX_FLOATS;
+    s->gesture_count.store(0, std::memory_order_relaxed);
+    memset(s->gesture_names, 0, sizeof(s->gesture_names));
+}
+
+int hand_snapshot_intern(HandSnapshot* s, const char* name) {
+    if (name == nullptr || name[0] == '\0') return -1;
+    int count = s->gesture_count.load(std::memory_order_relaxed);
+    for (int i = 0; i < count; i++) {
+        if (strncmp(s->gesture_names[i], name, HAND_SNAPSHOT_NAME_LEN - 1) == 0) return i;
+    }
+    if (count >= HAND_SNAPSHOT_MAX_GESTURES) return -1;
+
+    snprintf(s->gesture_names[count], HAND_SNAPSHOT_NAME_LEN, "%s", name);
+    /* Name first, then the count that makes it visible to readers. */
+    s->gesture_count.store(count + 1, std::memory_order_release);
+    return count;
+}
+
+const char* hand_snapshot_gesture_name(const HandSnapshot* s, int id) {
+    if (id < 0 || id >= s->gesture_count.load(std::memory_order_acquire)) return nullptr;
+    return s->gesture_names[id];
+}
+
+void hand_snapshot_write(HandSnapshot* s, const float* block) {
+    uint32_t seq = s->sequence.load(std::memory_order_relaxed);
+    s->sequence.store(seq + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+
+    for (int i = 0; i < s->float_count; i++) {
+        uint32_t bits;
+        memcpy(&bits, &block[i], sizeof(bits));
+        s->words[i].store(bits, std::memory_order_relaxed);
+    }
+
+    s->sequence.store(seq + 2, std::memory_order_release);
+}
+
+int64_t hand_snapshot_read(const HandSnapshot* s, float* out) {
+    uint32_t copy[HAND_SNAPSHOT_MAX_FLOATS];
+    for (int attempt = 0; attempt < HAND_SNAPSHOT_READ_ATTEMPTS; attempt++) {
+        uint32_t before = s->sequence.load(std::memory_order_acquire);
+        if (before == 0) return 0;
+        if (before & 1u) continue;
+
+        for (int i = 0; i < s->float_count; i++) {
+            copy[i] = s->words[i].load(std::memory_order_relaxed);
+        }
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (s->sequence.load(std::memory_order_relaxed) != before) continue;
+
+        memcpy(out, copy, sizeof(float) * (size_t)s->float_count);
+        return (int64_t)(before / 2);
+    }
+    return -1;
+}
@@ -0,0 +1,57 @@
+#ifndef ORPHEUS_MEDIAPIPE_HAND_SNAPSHOT_H_
+#define ORPHEUS_MEDIAPIPE_HAND_SNAPSHOT_H_
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+/*
+ * Latest-result snapshot for the MediaPipe JNI bridge: a seqlock over one
+ * fixed block of floats, so realtime threads (audio, control rate) can read
+ * the newest packed hands without locks, allocation or JNI callbacks.
+ * No JNI or MediaPipe dependencies.
+ *
+ * One writer (the result thread) never waits.  Readers copy the block and
+ * retry if a write overlapped, at most HAND_SNAPSHOT_READ_ATTEMPTS times,
+ * so a read takes bounded time; a write lasts well under a microsecond
+ * and comes every camera frame, so giving up is rare and the reader just
+ * keeps its previous copy.  Any number of readers may run at once.
+ *
+ * Gesture names are interned into a table next to the block; IDs are
+ * stable for the snapshot's lifetime.
+ */
+
+#define HAND_SNAPSHOT_MAX_FLOATS 192
+#define HAND_SNAPSHOT_READ_ATTEMPTS 64
+#define HAND_SNAPSHOT_MAX_GESTURES 32
+#define HAND_SNAPSHOT_NAME_LEN 48
+
+struct HandSnapshot {
+    std::atomic<uint32_t> sequence;         /* odd while a write is in progress */
+    std::atomic<uint32_t> words[HAND_SNAPSHOT_MAX_FLOATS];   /* float bits */
+    int float_count;
+    std::atomic<int> gesture_count;
+    char gesture_names[HAND_SNAPSHOT_MAX_GESTURES][HAND_SNAPSHOT_NAME_LEN];
+};
+
+/* Reset to "nothing published" with blocks of float_count floats
+ * (<= HAND_SNAPSHOT_MAX_FLOATS).  Not concurrent with anything else. */
+void hand_snapshot_init(HandSnapshot* s, int float_count);
+
+/* Map a gesture name to its ID, adding it if new.  -1 for nullptr / "" or
+ * a full table.  Writer thread only. */
+int hand_snapshot_intern(HandSnapshot* s, const char* name);
+
+/* Name for an interned ID, or nullptr.  Any thread. */
+const char* hand_snapshot_gesture_name(const HandSnapshot* s, int id);
+
+/* Publish float_count floats from block.  Writer thread only. */
+void hand_snapshot_write(HandSnapshot* s, const float* block);
+
+/* Copy the newest block into out (float_count floats).  Returns how many
+ * blocks have been published (the newest one's number, from 1), 0 if none
+ * yet or -1 if every attempt overlapped a write; out is only written when
+ * the result is positive. */
+int64_t hand_snapshot_read(const HandSnapshot* s, float* out);
+
+#endif  // ORPHEUS_MEDIAPIPE_HAND_SNAPSHOT_H_
@@ -0,0 +1,59 @@
+#include "landmark_filter.h"
+
+#include <cstring>
+
+/* Smoothing factor of a first-order low-pass at cutoff fc for step dt:
+ * alpha = 1 / (1 + tau / dt) with tau = 1 / (2 pi fc), i.e. r / (1 + r)
+ * for r = 2 pi fc dt. */
+static const float kTwoPi = 6.28318530718f;
+
+/* Samples closer together than this are treated as this far apart, so a
+ * duplicate timestamp cannot blow up the speed estimate. */
+static const float kMinDtSeconds = 1e-4f;
+
+void landmark_filter_init(LandmarkFilter* f, const LandmarkFilterParams& params) {
+    memset(f, 0, sizeof(*f));
+    f->params = params;
+}
+
+void landmark_filter_forget(LandmarkFilter* f, int hand) {
+    f->last_ns[hand] = 0;
+}
+
+/* One filter step over a hand's block.  Separate restrict-qualified
+ * arguments let the compiler vectorize without aliasing checks. */
+static void one_euro_step(float* __restrict value, float* __restrict deriv,
+                          float* __restrict x, float inv_dt, float alpha_d,
+                          float k_min, float k_beta) {
+    for (int i = 0; i < LANDMARK_FILTER_HAND_STRIDE; i++) {
+        float dx = (x[i] - value[i]) * inv_dt;
+        float edx = deriv[i] + alpha_d * (dx - deriv[i]);
+        float speed = edx < 0.0f ? -edx : edx;
+        float r = k_min + k_beta * speed;
+        float alpha = r / (1.0f + r);
+        float filtered = value[i] + alpha * (x[i] - value[i]);
+        deriv[i] = edx;
+        value[i] = filtered;
+        x[i] = filtered;
+    }
+}
+
+void landmark_filter_apply(LandmarkFilter* f, int hand, int64_t t_ns, float* xyz) {
+    float* value = f->value + hand * LANDMARK_FILTER_HAND_STRIDE;
+    float* deriv = f->deriv + hand * LANDMARK_FILTER_HAND_STRIDE;
+
+    if (f->last_ns[hand] == 0) {
+        memcpy(value, xyz, sizeof(float) * LANDMARK_FILTER_HAND_STRIDE);
+        memset(deriv, 0, sizeof(float) * LANDMARK_FILTER_HAND_STRIDE);
+        f->last_ns[hand] = t_ns;
+        return;
+    }
+
+    float dt = static_cast<float>(t_ns - f->last_ns[hand]) * 1e-9f;
+    if (dt < kMinDtSeconds) dt = kMinDtSeconds;
+    f->last_ns[hand] = t_ns;
+
+    const float rd = kTwoPi * f->params.d_cutoff * dt;
+    one_euro_step(value, deriv, xyz, 1.0f / dt, rd / (1.0f + rd),
+                  kTwoPi * f->params.min_cutoff * dt, kTwoPi * f->params.beta * dt);
+}
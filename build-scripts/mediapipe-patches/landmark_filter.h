@@ -0,0 +1,44 @@
+#ifndef ORPHEUS_MEDIAPIPE_LANDMARK_FILTER_H_
+#define ORPHEUS_MEDIAPIPE_LANDMARK_FILTER_H_
+
+#include <cstdint>
+
+/*
+ * One-Euro landmark smoothing for the MediaPipe JNI bridge.
+ * No JNI or MediaPipe dependencies.  State for every coordinate of every
+ * hand lives in one structure-of-arrays block, so each step is a handful
+ * of straight-line loops over 64 floats that the compiler vectorizes.
+ *
+ * Casiez et al., "1€ Filter: A Simple Speed-based Low-pass Filter for
+ * Noisy Input in Interactive Systems" (CHI 2012).
+ */
+
+#define LANDMARK_FILTER_MAX_HANDS 2
+#define LANDMARK_FILTER_HAND_FLOATS 63   /* 21 * xyz */
+#define LANDMARK_FILTER_HAND_STRIDE 64   /* padded to a whole vector count */
+
+struct LandmarkFilterParams {
+    float min_cutoff;   /* Hz; lower = smoother at rest */
+    float beta;         /* cutoff gain per unit/s of speed; higher = less lag */
+    float d_cutoff;     /* Hz; low-pass on the speed estimate */
+};
+
+struct LandmarkFilter {
+    LandmarkFilterParams params;
+    float value[LANDMARK_FILTER_MAX_HANDS * LANDMARK_FILTER_HAND_STRIDE];
+    float deriv[LANDMARK_FILTER_MAX_HANDS * LANDMARK_FILTER_HAND_STRIDE];
+    int64_t last_ns[LANDMARK_FILTER_MAX_HANDS];   /* 0 = no history */
+};
+
+/* Reset all hands and set the parameters. */
+void landmark_filter_init(LandmarkFilter* f, const LandmarkFilterParams& params);
+
+/* Drop hand's history; its next sample passes through unfiltered. */
+void landmark_filter_forget(LandmarkFilter* f, int hand);
+
+/* Filter one hand's LANDMARK_FILTER_HAND_STRIDE floats (21*xyz plus one
+ * padding lane) in place.  hand picks the state slot and must identify the
+ * same physical hand from frame to frame; t_ns is a monotonic timestamp. */
+void landmark_filter_apply(LandmarkFilter* f, int hand, int64_t t_ns, float* xyz);
+
+#endif  // ORPHEUS_MEDIAPIPE_LANDMARK_FILTER_H_
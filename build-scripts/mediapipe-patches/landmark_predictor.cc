@@ -0,0 +1,89 @@
+#include "landmark_predictor.h"
+
+#include <cstring>
+
+/* Results further apart than this don't share a trajectory: the history
+ * restarts rather than fitting a velocity across the gap. */
+static const int64_t kMaxGapNs = 250000000;
+
+void landmark_predictor_init(LandmarkPredictor* p, int64_t max_horizon_ns) {
+    memset(p, 0, sizeof(*p));
+    p->max_horizon_ns = max_horizon_ns;
+}
+
+void landmark_predictor_forget(LandmarkPredictor* p, int hand) {
+    p->hands[hand].count = 0;
+}
+
+/* velocity = sum_k w[k] * history[k]; the weights already hold the
+ * least-squares slope terms, so this is one multiply-add pass per entry. */
+static void predictor_fit(const float (*history)[LANDMARK_FILTER_HAND_STRIDE],
+                          const float* w, int count, float* __restrict velocity) {
+    memset(velocity, 0, sizeof(float) * LANDMARK_FILTER_HAND_STRIDE);
+    for (int k = 0; k < count; k++) {
+        const float* __restrict x = history[k];
+        const float wk = w[k];
+        for (int i = 0; i < LANDMARK_FILTER_HAND_STRIDE; i++) {
+            velocity[i] += wk * x[i];
+        }
+    }
+}
+
+void landmark_predictor_push(LandmarkPredictor* p, int hand, float handedness,
+                             int64_t t_ns, const float* xyz) {
+    LandmarkPredictorHand* h = &p->hands[hand];
+    if (h->count > 0) {
+        int64_t newest = h->history_ns[h->head];
+        if (t_ns <= newest) return;   /* out of order or duplicate */
+        if (t_ns - newest > kMaxGapNs) h->count = 0;
+    }
+
+    h->head = h->count == 0 ? 0 : (h->head + 1) % LANDMARK_PREDICTOR_HISTORY;
+    memcpy(h->history[h->head], xyz, sizeof(float) * LANDMARK_FILTER_HAND_STRIDE);
+    h->history_ns[h->head] = t_ns;
+    if (h->count < LANDMARK_PREDICTOR_HISTORY) h->count++;
+    h->handedness = handedness;
+
+    if (h->count < 2) {
+        memset(h->velocity, 0, sizeof(h->velocity));
+        return;
+    }
+
+    /* Slope of x over t: sum((t - t_mean) * x) / sum((t - t_mean)^2).
+     * Times are seconds relative to the newest entry to keep floats small. */
+    float t[LANDMARK_PREDICTOR_HISTORY];
+    float w[LANDMARK_PREDICTOR_HISTORY];
+    float t_mean = 0.0f;
+    for (int k = 0; k < h->count; k++) {
+        t[k] = static_cast<float>(h->history_ns[k] - t_ns) * 1e-9f;
+        t_mean += t[k];
+    }
+    t_mean /= static_cast<float>(h->count);
+    float var = 0.0f;
+    for (int k = 0; k < h->count; k++) {
+        w[k] = t[k] - t_mean;
+        var += w[k] * w[k];
+    }
+    for (int k = 0; k < h->count; k++) w[k] /= var;
+
+    predictor_fit(h->history, w, h->count, h->velocity);
+}
+
+bool landmark_predictor_sample(const LandmarkPredictor* p, int hand, int64_t now_ns,
+                               float* xyz) {
+    const LandmarkPredictorHand* h = &p->hands[hand];
+    if (h->count == 0) return false;
+
+    int64_t ahead = now_ns - h->history_ns[h->head];
+    if (ahead < 0) ahead = 0;
+    if (ahead > p->max_horizon_ns) ahead = p->max_horizon_ns;
+    const float dt = static_cast<float>(ahead) * 1e-9f;
+
+    const float* __restrict newest = h->history[h->head];
+    const float* __restrict velocity = h->velocity;
+    float* __restrict out = xyz;
+    for (int i = 0; i < LANDMARK_FILTER_HAND_STRIDE; i++) {
+        out[i] = newest[i] + velocity[i] * dt;
+    }
+    return true;
+}
@@ -0,0 +1,47 @@
+#ifndef ORPHEUS_MEDIAPIPE_LANDMARK_PREDICTOR_H_
+#define ORPHEUS_MEDIAPIPE_LANDMARK_PREDICTOR_H_
+
+#include <cstdint>
+
+#include "landmark_filter.h"
+
+/*
+ * Landmark extrapolation for the MediaPipe JNI bridge.
+ * No JNI or MediaPipe dependencies.  Each hand slot keeps its last few
+ * results; a least-squares fit over them gives per-coordinate velocity,
+ * and sampling projects the newest result forward to the requested time.
+ * Blocks use the landmark_filter.h layout (21*xyz padded to 64 floats).
+ */
+
+#define LANDMARK_PREDICTOR_HISTORY 4
+
+struct LandmarkPredictorHand {
+    float history[LANDMARK_PREDICTOR_HISTORY][LANDMARK_FILTER_HAND_STRIDE];
+    int64_t history_ns[LANDMARK_PREDICTOR_HISTORY];
+    int count;          /* valid history entries, 0 = hand absent */
+    int head;           /* index of the newest entry */
+    float velocity[LANDMARK_FILTER_HAND_STRIDE];   /* units per second */
+    float handedness;
+};
+
+struct LandmarkPredictor {
+    LandmarkPredictorHand hands[LANDMARK_FILTER_MAX_HANDS];
+    int64_t max_horizon_ns;   /* extrapolation cap; later samples hold */
+};
+
+/* Clear every hand and set the extrapolation cap. */
+void landmark_predictor_init(LandmarkPredictor* p, int64_t max_horizon_ns);
+
+/* Record one hand result captured at t_ns (monotonic). */
+void landmark_predictor_push(LandmarkPredictor* p, int hand, float handedness,
+                             int64_t t_ns, const float* xyz);
+
+/* Mark hand absent; sampling skips it until the next push. */
+void landmark_predictor_forget(LandmarkPredictor* p, int hand);
+
+/* Write hand's landmarks extrapolated to now_ns into xyz.  Returns false
+ * (xyz untouched) if the hand is absent. */
+bool landmark_predictor_sample(const LandmarkPredictor* p, int hand, int64_t now_ns,
+                               float* xyz);
+
+#endif  // ORPHEUS_MEDIAPIPE_LANDMARK_PREDICTOR_H_
@@ -0,0 +1,620 @@
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include <vector>
+#if defined(_WIN32)
+#include <windows.h>
+#include <psapi.h>
+#include <malloc.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/resource.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "mediapipe/tasks/c/core/base_options.h"
+#include "mediapipe/tasks/c/vision/hand_landmarker/frame_kernels.h"
+#include "mediapipe/tasks/c/vision/hand_landmarker/hand_features.h"
+#include "mediapipe/tasks/c/vision/hand_landmarker/landmark_filter.h"
+#include "mediapipe/tasks/c/vision/hand_landmarker/native_capture.h"
+#include "mediapipe/tasks/c/vision/hand_landmarker/pooled_tasks.h"
+
+/*
+ * Standalone benchmark for the bridge's native frame path — no JVM.
+ *
+ *   mediapipe_bench record <device> <frames> <out.frames> [width height fps]
+ *   mediapipe_bench run <model.task> <in.frames> [options]
+ *     --landmarker      hand_landmarker.task instead of gesture_recognizer.task
+ *     --hands N         hand limit (default 2)
+ *     --loops N         replay the recording N times (default 1)
+ *     --warmup N        untimed frames before measuring (default 10)
+ *     --smoothing       One-Euro filter with MediaPipeJni's default parameters
+ *     --no-mirror       skip the preview mirror
+ *     --gpu             GPU delegate (needs a build-native-mediapipe.sh --gpu
+ *                       build; fails instead of falling back to CPU)
+ *     --nv12            feed the frames as NV12 (converted once, untimed)
+ *                       through the YUV kernel instead of BGR24
+ *
+ * `record` writes frames from the native capture path (native_capture.cc);
+ * `run` replays them the way the capture thread does: BGR24 -> BGRA,
+ * letterbox to RGB, stage into the image pool, VIDEO-mode inference on
+ * the pooled task, then the bridge's staging (capture coordinates,
+ * smoothing, hand features) into a ring-format slot.  The staging mirrors
+ * stage_hands and pack_slot in mediapipe_jni.cc without its JNI, ROI and
+ * predictor state; keep them in step.
+ *
+ * Reports throughput, p50/p95/p99/max per stage, operator new calls per
+ * timed frame (Eigen's own aligned allocations bypass it) and peak RSS.
+ * Build it with the same flags as the library, in particular
+ * EIGEN_MAX_ALIGN_BYTES, or the numbers say nothing about what ships.
+ *
+ * Recording format (little-endian): a 32-byte header
+ *   "ORPHFRM1", uint32 width, height, frame count, 0, uint64 0
+ * followed per frame by int64 timestamp_ms and height * width * 3 bytes
+ * of packed BGR24.  Replays mmap the file.
+ */
+
+#define BENCH_MAX_HANDS POOLED_MAX_HANDS
+#define BENCH_HAND_FLOATS (3 + LANDMARK_FILTER_HAND_FLOATS + HAND_FEATURE_COUNT + 2)
+#define BENCH_SLOT_FLOATS (1 + BENCH_MAX_HANDS * BENCH_HAND_FLOATS)
+
+static const char kFrameMagic[8] = {'O', 'R', 'P', 'H', 'F', 'R', 'M', '1'};
+
+struct FrameFileHeader {
+    char magic[8];
+    uint32_t width;
+    uint32_t height;
+    uint32_t frame_count;
+    uint32_t reserved0;
+    uint64_t reserved1;
+};
+
+static_assert(sizeof(FrameFileHeader) == 32, "recording header layout");
+
+static int64_t now_ns() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+/* ========================================================================
+ * Allocation counting
+ *
+ * MediaPipe, protobuf and TFLite are linked statically, so replacing the
+ * global operator new sees their C++ allocations too.  malloc from C code
+ * and Eigen's aligned_malloc are not counted.
+ * ======================================================================== */
+
+static std::atomic<uint64_t> g_allocations{0};
+
+static void* counted_alloc(size_t size) {
+    g_allocations.fetch_add(1, std::memory_order_relaxed);
+    void* p = malloc(size == 0 ? 1 : size);
+    if (p == nullptr) throw std::bad_alloc();
+    return p;
+}
+
+static void* counted_aligned_alloc(size_t size, size_t alignment) {
+    g_allocations.fetch_add(1, std::memory_order_relaxed);
+    if (size == 0) size = 1;
+#if defined(_WIN32)
+    void* p = _aligned_malloc(size, alignment);
+#else
+    void* p = nullptr;
+    if (posix_memalign(&p, alignment < sizeof(void*) ? sizeof(void*) : alignment, size) != 0) {
+        p = nullptr;
+    }
+#endif
+    if (p == nullptr) throw std::bad_alloc();
+    return p;
+}
+
+static void aligned_release(void* p) {
+#if defined(_WIN32)
+    _aligned_free(p);
+#else
+    free(p);
+#endif
+}
+
+void* operator new(size_t size) { return counted_alloc(size); }
+void* operator new[](size_t size) { return counted_alloc(size); }
+void* operator new(size_t size, const std::nothrow_t&) noexcept {
+    try { return counted_alloc(size); } catch (...) { return nullptr; }
+}
+void* operator new[](size_t size, const std::nothrow_t&) noexcept {
+    try { return counted_alloc(size); } catch (...) { return nullptr; }
+}
+void* operator new(size_t size, std::align_val_t al) {
+    return counted_aligned_alloc(size, static_cast<size_t>(al));
+}
+void* operator new[](size_t size, std::align_val_t al) {
+    return counted_aligned_alloc(size, static_cast<size_t>(al));
+}
+void operator delete(void* p) noexcept { free(p); }
+void operator delete[](void* p) noexcept { free(p); }
+void operator delete(void* p, size_t) noexcept { free(p); }
+void operator delete[](void* p, size_t) noexcept { free(p); }
+void operator delete(void* p, std::align_val_t) noexcept { aligned_release(p); }
+void operator delete[](void* p, std::align_val_t) noexcept { aligned_release(p); }
+void operator delete(void* p, size_t, std::align_val_t) noexcept { aligned_release(p); }
+void operator delete[](void* p, size_t, std::align_val_t) noexcept { aligned_release(p); }
+
+/* Peak resident set size in bytes, or 0 if unknown. */
+static uint64_t peak_rss_bytes() {
+#if defined(_WIN32)
+    PROCESS_MEMORY_COUNTERS counters;
+    if (!GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters))) return 0;
+    return (uint64_t)counters.PeakWorkingSetSize;
+#else
+    struct rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) != 0) return 0;
+#if defined(__APPLE__)
+    return (uint64_t)usage.ru_maxrss;           /* bytes */
+#else
+    return (uint64_t)usage.ru_maxrss * 1024;    /* KiB */
+#endif
+#endif
+}
+
+/* ========================================================================
+ * Recordings
+ * ======================================================================== */
+
+struct Recording {
+    const uint8_t* data;
+    size_t size;
+    int width;
+    int height;
+    int frame_count;
+    size_t frame_bytes;        /* pixels per frame */
+    std::vector<uint8_t> copy; /* backing store where mmap is unavailable */
+};
+
+static size_t record_stride(const Recording& r) {
+    return sizeof(int64_t) + r.frame_bytes;
+}
+
+static int64_t recording_timestamp(const Recording& r, int frame) {
+    int64_t ts;
+    memcpy(&ts, r.data + sizeof(FrameFileHeader) + (size_t)frame * record_stride(r), sizeof(ts));
+    return ts;
+}
+
+static const uint8_t* recording_pixels(const Recording& r, int frame) {
+    return r.data + sizeof(FrameFileHeader) + (size_t)frame * record_stride(r) + sizeof(int64_t);
+}
+
+static bool recording_open(const char* path, Recording* r) {
+#if defined(_WIN32)
+    FILE* f = fopen(path, "rb");
+    if (f == nullptr) return false;
+    fseek(f, 0, SEEK_END);
+    long size = ftell(f);
+    fseek(f, 0, SEEK_SET);
+    r->copy.resize(size > 0 ? (size_t)size : 0);
+    bool read = size > 0 && fread(r->copy.data(), 1, r->copy.size(), f) == r->copy.size();
+    fclose(f);
+    if (!read) return false;
+    r->data = r->copy.data();
+    r->size = r->copy.size();
+#else
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) return false;
+    struct stat st;
+    if (fstat(fd, &st) != 0 || st.st_size <= 0) {
+        close(fd);
+        return false;
+    }
+    void* map = mmap(nullptr, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (map == MAP_FAILED) return false;
+    r->data = static_cast<const uint8_t*>(map);
+    r->size = (size_t)st.st_size;
+#endif
+
+    FrameFileHeader header;
+    if (r->size < sizeof(header)) return false;
+    memcpy(&header, r->data, sizeof(header));
+    if (memcmp(header.magic, kFrameMagic, sizeof(kFrameMagic)) != 0 ||
+        header.width == 0 || header.height == 0 || header.frame_count == 0) {
+        return false;
+    }
+    r->width = (int)header.width;
+    r->height = (int)header.height;
+    r->frame_count = (int)header.frame_count;
+    r->frame_bytes = (size_t)r->width * r->height * 3;
+    return r->size >= sizeof(header) + (size_t)r->frame_count * record_stride(*r);
+}
+
+static int record(int device, int frames, const char* out, int width, int height, int fps) {
+    char error[256];
+    NativeCapture* camera = native_capture_open(device, width, height, fps, error, sizeof(error));
+    if (camera == nullptr) {
+        fprintf(stderr, "record: %s\n", error);
+        return 1;
+    }
+    native_capture_size(camera, &width, &height);
+
+    FILE* f = fopen(out, "wb");
+    if (f == nullptr) {
+        fprintf(stderr, "record: cannot write %s\n", out);
+        native_capture_close(camera);
+        return 1;
+    }
+    FrameFileHeader header;
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, kFrameMagic, sizeof(kFrameMagic));
+    header.width = (uint32_t)width;
+    header.height = (uint32_t)height;
+    fwrite(&header, sizeof(header), 1, f);
+
+    int64_t start_ns = now_ns();
+    int written = 0;
+    while (written < frames) {
+        const uint8_t* bgr = nullptr;
+        int stride = 0;
+        if (!native_capture_read(camera, &bgr, &stride)) break;
+        int64_t ts = (now_ns() - start_ns) / 1000000;
+        fwrite(&ts, sizeof(ts), 1, f);
+        for (int y = 0; y < height; y++) fwrite(bgr + (size_t)y * stride, 1, (size_t)width * 3, f);
+        written++;
+    }
+    native_capture_close(camera);
+
+    header.frame_count = (uint32_t)written;
+    fseek(f, 0, SEEK_SET);
+    fwrite(&header, sizeof(header), 1, f);
+    fclose(f);
+    printf("recorded %d frames of %dx%d to %s\n", written, width, height, out);
+    return written > 0 ? 0 : 1;
+}
+
+/* ========================================================================
+ * Replay
+ * ======================================================================== */
+
+enum BenchStage {
+    BENCH_PREPROCESS,   /* BGR24 -> BGRA -> letterboxed RGB */
+    BENCH_IMAGE,        /* image_pool_stage */
+    BENCH_INFERENCE,
+    BENCH_PACK,         /* coordinates, smoothing, features, slot */
+    BENCH_STAGE_COUNT
+};
+
+static const char* const kStageNames[BENCH_STAGE_COUNT] = {
+    "preprocess", "image stage", "inference", "pack",
+};
+
+struct BenchOptions {
+    bool landmarker;
+    int num_hands;
+    int loops;
+    int warmup;
+    bool smoothing;
+    bool mirror;
+    bool gpu;
+    bool nv12;
+};
+
+/* BT.601 limited-range BGR24 -> NV12, chroma averaged over each 2x2 block:
+ * the inverse of frame_yuv420_to_bgra, for --nv12.  Odd edges repeat the
+ * last row / column.  out holds width*height luma bytes, then the
+ * interleaved UV rows, chroma_width*2 bytes each. */
+static void bgr_to_nv12(const uint8_t* bgr, int width, int height, uint8_t* out) {
+    const int chroma_width = (width + 1) / 2;
+    uint8_t* uv = out + (size_t)width * height;
+    for (int y = 0; y < height; y++) {
+        for (int x = 0; x < width; x++) {
+            const uint8_t* p = bgr + ((size_t)y * width + x) * 3;
+            out[(size_t)y * width + x] =
+                (uint8_t)(((66 * p[2] + 129 * p[1] + 25 * p[0] + 128) >> 8) + 16);
+        }
+    }
+    for (int cy = 0; cy < (height + 1) / 2; cy++) {
+        for (int cx = 0; cx < chroma_width; cx++) {
+            int b = 0, g = 0, r = 0;
+            for (int dy = 0; dy < 2; dy++) {
+                for (int dx = 0; dx < 2; dx++) {
+                    int y = std::min(cy * 2 + dy, height - 1);
+                    int x = std::min(cx * 2 + dx, width - 1);
+                    const uint8_t* p = bgr + ((size_t)y * width + x) * 3;
+                    b += p[0];
+                    g += p[1];
+                    r += p[2];
+                }
+            }
+            uint8_t* c = uv + ((size_t)cy * chroma_width + cx) * 2;
+            c[0] = (uint8_t)(((-38 * r - 74 * g + 112 * b + 512) >> 10) + 128);
+            c[1] = (uint8_t)(((112 * r - 94 * g - 18 * b + 512) >> 10) + 128);
+        }
+    }
+}
+
+/* Like stage_hands + pack_slot: capture-normalized landmarks (letterbox
+ * undone), user handedness, optional smoothing, hand features. */
+static int pack_result(const BenchOptions& options, int width, int height,
+                       const struct Categories* handedness, uint32_t handedness_count,
+                       const struct NormalizedLandmarks* landmarks, uint32_t landmarks_count,
+                       const struct Categories* gestures, uint32_t gestures_count,
+                       LandmarkFilter* filter, int64_t frame_ns, float* slot) {
+    int size = frame_square_size(width, height);
+    float kx = (float)size / (float)width;
+    float ky = (float)size / (float)height;
+    float ox = -(float)((size - width) / 2) / (float)width;
+    float oy = -(float)((size - height) / 2) / (float)height;
+
+    int hands = (int)landmarks_count < BENCH_MAX_HANDS ? (int)landmarks_count : BENCH_MAX_HANDS;
+    slot[0] = (float)hands;
+    bool used[BENCH_MAX_HANDS] = {false, false};
+    for (int h = 0; h < hands; h++) {
+        float* hand = slot + 1 + h * BENCH_HAND_FLOATS;
+        bool right = false;
+        if (h < (int)handedness_count && handedness[h].categories_count > 0) {
+            const char* name = handedness[h].categories[0].category_name;
+            right = name != nullptr && name[0] == 'R';
+        }
+        hand[0] = right != options.mirror ? 1.0f : 0.0f;
+        hand[1] = -1.0f;
+        hand[2] = 0.0f;
+        if (gestures != nullptr && h < (int)gestures_count && gestures[h].categories_count > 0) {
+            hand[1] = (float)gestures[h].categories[0].index;
+            hand[2] = gestures[h].categories[0].score;
+        }
+
+        float xyz[LANDMARK_FILTER_HAND_STRIDE];
+        memset(xyz, 0, sizeof(xyz));
+        const struct NormalizedLandmarks* lms = &landmarks[h];
+        unsigned int count = lms->landmarks_count < 21 ? lms->landmarks_count : 21;
+        for (unsigned int i = 0; i < count; i++) {
+            xyz[i * 3]     = ox + lms->landmarks[i].x * kx;
+            xyz[i * 3 + 1] = oy + lms->landmarks[i].y * ky;
+            xyz[i * 3 + 2] = lms->landmarks[i].z;
+        }
+        int filter_slot = hand[0] >= 0.5f ? 1 : 0;
+        if (used[filter_slot]) filter_slot = 1 - filter_slot;
+        used[filter_slot] = true;
+        if (options.smoothing) landmark_filter_apply(filter, filter_slot, frame_ns, xyz);
+
+        memcpy(hand + 3, xyz, sizeof(float) * LANDMARK_FILTER_HAND_FLOATS);
+        hand_features_compute(xyz, hand + 3 + LANDMARK_FILTER_HAND_FLOATS);
+        hand[3 + LANDMARK_FILTER_HAND_FLOATS + HAND_FEATURE_COUNT] = -1.0f;
+        hand[4 + LANDMARK_FILTER_HAND_FLOATS + HAND_FEATURE_COUNT] = 0.0f;
+    }
+    if (options.smoothing) {
+        for (int s = 0; s < BENCH_MAX_HANDS; s++) {
+            if (!used[s]) landmark_filter_forget(filter, s);
+        }
+    }
+    return hands;
+}
+
+static double percentile_ms(std::vector<int64_t>& samples, double p) {
+    if (samples.empty()) return 0.0;
+    size_t index = (size_t)(p * (double)(samples.size() - 1) + 0.5);
+    std::nth_element(samples.begin(), samples.begin() + index, samples.end());
+    return (double)samples[index] / 1e6;
+}
+
+static int run(const char* model_path, const char* recording_path, const BenchOptions& options) {
+    Recording rec;
+    if (!recording_open(recording_path, &rec)) {
+        fprintf(stderr, "run: %s is not a readable frame recording\n", recording_path);
+        return 1;
+    }
+
+    struct BaseOptions base;
+    memset(&base, 0, sizeof(base));
+    base.model_asset_path = model_path;
+    PooledTaskOptions task_options;
+    task_options.base = &base;
+    task_options.num_hands = options.num_hands;
+    task_options.min_hand_detection_confidence = 0.5f;
+    task_options.min_hand_presence_confidence = 0.5f;
+    task_options.min_tracking_confidence = 0.5f;
+    task_options.use_gpu = options.gpu;
+
+    char error[512];
+    int64_t create_start = now_ns();
+    PooledRecognizer* recognizer = nullptr;
+    PooledLandmarker* landmarker = nullptr;
+    if (options.landmarker) {
+        landmarker = pooled_landmarker_create(&task_options, error, sizeof(error));
+    } else {
+        recognizer = pooled_recognizer_create(&task_options, error, sizeof(error));
+    }
+    if (recognizer == nullptr && landmarker == nullptr) {
+        fprintf(stderr, "run: %s\n", error);
+        return 1;
+    }
+    double create_ms = (double)(now_ns() - create_start) / 1e6;
+
+    ImagePool* images = image_pool_create();
+    int size = frame_square_size(rec.width, rec.height);
+    std::vector<uint8_t> bgra((size_t)rec.width * rec.height * 4);
+    std::vector<uint8_t> rgb((size_t)size * size * 3);
+    const int chroma_width = (rec.width + 1) / 2;
+    const size_t nv12_bytes = (size_t)rec.width * rec.height +
+                              (size_t)chroma_width * 2 * ((rec.height + 1) / 2);
+    std::vector<uint8_t> nv12;
+    if (options.nv12) {
+        nv12.resize(nv12_bytes * rec.frame_count);
+        for (int f = 0; f < rec.frame_count; f++) {
+            bgr_to_nv12(recording_pixels(rec, f), rec.width, rec.height, &nv12[nv12_bytes * f]);
+        }
+    }
+    float slot[BENCH_SLOT_FLOATS];
+    LandmarkFilter filter;
+    LandmarkFilterParams params = {1.0f, 5.0f, 1.0f};
+    landmark_filter_init(&filter, params);
+
+    int total = options.warmup + rec.frame_count * options.loops;
+    std::vector<int64_t> samples[BENCH_STAGE_COUNT];
+    for (std::vector<int64_t>& s : samples) s.reserve((size_t)total);
+
+    /* Continue timestamps across loops so the VIDEO-mode graph accepts them. */
+    int64_t span_ms = recording_timestamp(rec, rec.frame_count - 1) -
+                      recording_timestamp(rec, 0) + 33;
+    int64_t hand_frames = 0;
+    int failures = 0;
+    uint64_t allocations_before = 0;
+    int64_t timed_start = 0;
+
+    for (int n = 0; n < total; n++) {
+        if (n == options.warmup) {
+            allocations_before = g_allocations.load(std::memory_order_relaxed);
+            timed_start = now_ns();
+        }
+        int frame = n % rec.frame_count;
+        int64_t timestamp_ms = recording_timestamp(rec, frame) + (int64_t)(n / rec.frame_count) * span_ms;
+        int64_t t0 = now_ns();
+
+        if (options.nv12) {
+            const uint8_t* luma = &nv12[nv12_bytes * frame];
+            const uint8_t* chroma = luma + (size_t)rec.width * rec.height;
+            frame_yuv420_to_bgra(luma, rec.width, chroma, chroma + 1, chroma_width * 2, 2,
+                                 rec.width, rec.height, options.mirror, bgra.data());
+        } else {
+            frame_bgr_to_bgra(recording_pixels(rec, frame), rec.width, rec.height, rec.width * 3,
+                              options.mirror, bgra.data());
+        }
+        frame_argb_to_rgb_square(reinterpret_cast<const uint32_t*>(bgra.data()),
+                                 rec.width, rec.height, rec.width, false, rgb.data());
+        int64_t t1 = now_ns();
+
+        const PooledImage* image = image_pool_stage(images, rgb.data(), size, size);
+        int64_t t2 = now_ns();
+        if (image == nullptr) {
+            fprintf(stderr, "run: image pool exhausted\n");
+            failures++;
+            continue;
+        }
+
+        int hands = 0;
+        int64_t t3;
+        int64_t frame_ns = timestamp_ms * 1000000;
+        if (recognizer != nullptr) {
+            GestureRecognizerResult result;
+            bool ok = pooled_recognizer_recognize(recognizer, image, timestamp_ms, &result,
+                                                  error, sizeof(error));
+            t3 = now_ns();
+            if (ok) {
+                hands = pack_result(options, rec.width, rec.height,
+                                    result.handedness, result.handedness_count,
+                                    result.hand_landmarks, result.hand_landmarks_count,
+                                    result.gestures, result.gestures_count,
+                                    &filter, frame_ns, slot);
+            } else {
+                failures++;
+            }
+        } else {
+            HandLandmarkerResult result;
+            bool ok = pooled_landmarker_detect(landmarker, image, timestamp_ms, &result,
+                                               error, sizeof(error));
+            t3 = now_ns();
+            if (ok) {
+                hands = pack_result(options, rec.width, rec.height,
+                                    result.handedness, result.handedness_count,
+                                    result.hand_landmarks, result.hand_landmarks_count,
+                                    nullptr, 0, &filter, frame_ns, slot);
+            } else {
+                failures++;
+            }
+        }
+        int64_t t4 = now_ns();
+
+        if (n < options.warmup) continue;
+        samples[BENCH_PREPROCESS].push_back(t1 - t0);
+        samples[BENCH_IMAGE].push_back(t2 - t1);
+        samples[BENCH_INFERENCE].push_back(t3 - t2);
+        samples[BENCH_PACK].push_back(t4 - t3);
+        hand_frames += hands;
+    }
+
+    int64_t timed_ns = now_ns() - timed_start;
+    uint64_t allocations = g_allocations.load(std::memory_order_relaxed) - allocations_before;
+    int timed = total - options.warmup;
+
+    pooled_recognizer_close(recognizer);
+    pooled_landmarker_close(landmarker);
+    image_pool_destroy(images);
+
+    printf("task              %s on %s, %d hands max, smoothing %s\n",
+           options.landmarker ? "HandLandmarker" : "GestureRecognizer",
+           options.gpu ? "GPU" : "CPU", options.num_hands, options.smoothing ? "on" : "off");
+    printf("recording         %d frames of %dx%d x %d loops (+%d warm-up)\n",
+           rec.frame_count, rec.width, rec.height, options.loops, options.warmup);
+    printf("frame kernels     %s, %s input\n", frame_kernels_isa(), options.nv12 ? "NV12" : "BGR24");
+    printf("create            %.1f ms\n", create_ms);
+    printf("throughput        %.1f fps\n", timed_ns > 0 ? (double)timed * 1e9 / (double)timed_ns : 0.0);
+    printf("%-17s %8s %8s %8s %8s\n", "stage (ms)", "p50", "p95", "p99", "max");
+    for (int s = 0; s < BENCH_STAGE_COUNT; s++) {
+        std::vector<int64_t>& v = samples[s];
+        printf("%-17s %8.3f %8.3f %8.3f %8.3f\n", kStageNames[s],
+               percentile_ms(v, 0.50), percentile_ms(v, 0.95), percentile_ms(v, 0.99),
+               percentile_ms(v, 1.0));
+    }
+    printf("allocations/frame %.1f (operator new)\n", timed > 0 ? (double)allocations / timed : 0.0);
+    printf("hands/frame       %.2f\n", timed > 0 ? (double)hand_frames / timed : 0.0);
+    printf("failed frames     %d\n", failures);
+    printf("peak RSS          %.1f MB\n", (double)peak_rss_bytes() / (1024.0 * 1024.0));
+    return failures == 0 ? 0 : 2;
+}
+
+static void usage() {
+    fprintf(stderr,
+            "usage: mediapipe_bench record <device> <frames> <out.frames> [width height fps]\n"
+            "       mediapipe_bench run <model.task> <in.frames> [--landmarker] [--hands N]\n"
+            "                           [--loops N] [--warmup N] [--smoothing] [--no-mirror]\n"
+            "                           [--gpu] [--nv12]\n");
+}
+
+int main(int argc, char** argv) {
+    if (argc >= 5 && strcmp(argv[1], "record") == 0) {
+        int width = argc >= 8 ? atoi(argv[5]) : 640;
+        int height = argc >= 8 ? atoi(argv[6]) : 480;
+        int fps = argc >= 8 ? atoi(argv[7]) : 30;
+        return record(atoi(argv[2]), atoi(argv[3]), argv[4], width, height, fps);
+    }
+    if (argc >= 4 && strcmp(argv[1], "run") == 0) {
+        BenchOptions options = {false, 2, 1, 10, false, true, false, false};
+        for (int i = 4; i < argc; i++) {
+            const char* arg = argv[i];
+            bool has_value = i + 1 < argc;
+            if (strcmp(arg, "--landmarker") == 0) {
+                options.landmarker = true;
+            } else if (strcmp(arg, "--smoothing") == 0) {
+                options.smoothing = true;
+            } else if (strcmp(arg, "--no-mirror") == 0) {
+                options.mirror = false;
+            } else if (strcmp(arg, "--gpu") == 0) {
+                options.gpu = true;
+            } else if (strcmp(arg, "--nv12") == 0) {
+                options.nv12 = true;
+            } else if (strcmp(arg, "--hands") == 0 && has_value) {
+                options.num_hands = atoi(argv[++i]);
+            } else if (strcmp(arg, "--loops") == 0 && has_value) {
+                options.loops = atoi(argv[++i]);
+            } else if (strcmp(arg, "--warmup") == 0 && has_value) {
+                options.warmup = atoi(argv[++i]);
+            } else {
+                usage();
+                return 64;
+            }
+        }
+        if (options.num_hands < 1 || options.num_hands > BENCH_MAX_HANDS ||
+            options.loops < 1 || options.warmup < 0) {
+            usage();
+            return 64;
+        }
+        return run(argv[2], argv[3], options);
+    }
+    usage();
+    return 64;
+}
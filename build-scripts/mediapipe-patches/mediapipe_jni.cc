@@ -3,360 +3,2976 @@
 #include <cstring>
 #include <cstdio>
 #include <cstdint>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include <cstdarg>
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#endif
+#if defined(__ANDROID__)
+#include <android/log.h>
+#endif
 
 #include "mediapipe/tasks/c/vision/hand_landmarker/hand_landmarker.h"
 #include "mediapipe/tasks/c/vision/gesture_recognizer/gesture_recognizer.h"
 #include "mediapipe/tasks/c/vision/core/image.h"
 #include "mediapipe/tasks/c/vision/core/image_processing_options.h"
 #include "mediapipe/tasks/c/core/mp_status.h"
+#include "mediapipe/tasks/c/vision/hand_landmarker/asl_classifier.h"
+#include "mediapipe/tasks/c/vision/hand_landmarker/frame_kernels.h"
+#include "mediapipe/tasks/c/vision/hand_landmarker/gesture_schedule.h"
+#include "mediapipe/tasks/c/vision/hand_landmarker/hand_features.h"
+#include "mediapipe/tasks/c/vision/hand_landmarker/hand_snapshot.h"
+#include "mediapipe/tasks/c/vision/hand_landmarker/landmark_filter.h"
+#include "mediapipe/tasks/c/vision/hand_landmarker/landmark_predictor.h"
+#include "mediapipe/tasks/c/vision/hand_landmarker/native_capture.h"
+#include "mediapipe/tasks/c/vision/hand_landmarker/pooled_tasks.h"
+#include "mediapipe/tasks/c/vision/hand_landmarker/result_log.h"
 
 /*
  * Combined JNI shim for MediaPipe HandLandmarker + GestureRecognizer.
  * All MediaPipe symbols are resolved at link time (no dlopen).
- * Both APIs share a single dylib and JVM reference.
+ * Both APIs share a single dylib and JVM reference.  Each create call
+ * returns an independent Tracker handle owning its callback and result
+ * ring, so multiple instances (e.g. one per camera) can coexist.
  *
  * HandLandmarker callback format (packed float array):
- *   [numHands, per-hand(handedness, 21*xyz)]
- *   Per hand: 1 + 63 = 64 floats
+ *   [numHands, per-hand(handedness, 21*xyz, features)]
+ *   Per hand: 1 + 63 + 18 = 82 floats
  *
  * GestureRecognizer callback format:
- *   Float array: [numHands, per-hand(handedness, gestureScore, 21*xyz)]
- *   Per hand: 1 + 1 + 63 = 65 floats
+ *   Float array: [numHands, per-hand(handedness, gestureScore, 21*xyz, features)]
+ *   Per hand: 1 + 1 + 63 + 18 = 83 floats
  *   Plus a separate String[] of gesture names (one per hand).
+ *
+ * features is the HAND_FEATURE_COUNT geometric vector of hand_features.h
+ * (hand scale, tip-to-wrist distances, curls, palm normal, pinches).
+ *
+ * In every format handedness is 1.0 for the user's right hand (MediaPipe's
+ * label inverted when the create call says frames are mirrored), and x/y
+ * are normalized to the capture frame when its size is passed at create
+ * time — otherwise to the letterboxed square.
+ *
+ * Result ring mode (nativeSetResultRing, per handle):
+ *   Both paths write into a caller-owned direct buffer of fixed slots and
+ *   call onSlot(int slot, long timestampMs) — no per-frame JNI allocation.
+ *   Slot format: [numHands, per-hand(handedness, gestureId, gestureScore,
+ *   21*xyz, features, aslClassId, aslScore)], per hand
+ *   1 + 1 + 1 + 63 + 18 + 2 = 86 floats, 2 hands max.  aslClassId is -1
+ *   unless a custom classifier is loaded (nativeLoadAslClassifier).
+ *   Gesture names are interned once as small IDs and announced via
+ *   onGestureName(int id, String name) before the first slot using them.
+ *
+ * Model options (hand count, confidences, delegate) are passed to the
+ * create calls.  The default build disables GPU, so a GPU request logs and
+ * runs on CPU (XNNPACK).  Built with ORPHEUS_MEDIAPIPE_GPU (the
+ * libmediapipe_jni_gpu variant), the pooled VIDEO-mode tasks take the GPU
+ * delegate and fall back to CPU if creating them on it fails;
+ * nativeGetDelegate reports what a handle ended up on.  The LIVE_STREAM
+ * HandLandmarker stays on CPU: the C API has no delegate option.
+ *
+ * LIVE_STREAM backpressure (nativeSetFlowControl):
+ *   Optional cap on outstanding detectAsync frames with drop-newest or
+ *   drop-oldest semantics; nativeGetDroppedFrames reports the drop count.
+ *
+ * Instrumentation (nativeGetStats / nativeResetStats):
+ *   Process-wide p50/p95/p99 histograms for image create, inference, result
+ *   packing and the JNI callback, plus frame counters, as a packed long[].
+ *
+ * Skip-frame gestures (nativeSetGestureSchedule, per recognizer):
+ *   Optional companion VIDEO-mode HandLandmarker that handles the frames
+ *   between full recognitions (gesture_schedule.cc decides which); those
+ *   results carry the gesture labels of the last full recognition.
+ *
+ * Pipelined gestures (nativeRecognizeGestureAsync):
+ *   Frames go to a per-recognizer worker thread through a latest-frame-wins
+ *   mailbox; results arrive on that thread.  Don't mix with the synchronous
+ *   RecognizeForVideo calls on the same handle.
+ *
+ * Frame preprocessing (mirror + letterbox + ARGB->RGB) lives in
+ * frame_kernels.cc and is exposed via nativePreprocessArgb.  On x86_64
+ * its kernels are picked per CPU at first use; nativeFrameKernelsIsa
+ * reports which.
+ * nativePreprocessArgbRoi additionally crops around the previous result's
+ * hands; landmarks of such frames are remapped to full-square coordinates
+ * before delivery.  nativePreprocessBgrFrame takes the camera's BGR24
+ * buffer directly and also fills a caller-owned BGRA preview surface;
+ * nativePreprocessYuvFrame does the same from strided NV12 / NV21 / I420
+ * planes, converting YUV natively, optionally into an RGBA preview.
+ *
+ * Pooled VIDEO-mode tasks (pooled_tasks.cc):
+ *   The GestureRecognizer and the skip-frame tracking landmarker run on the
+ *   C++ task API with reused image slots and fixed result storage, so their
+ *   steady-state frames allocate nothing outside MediaPipe's graphs.  The
+ *   LIVE_STREAM HandLandmarker keeps the C API.
+ *
+ * Native capture (nativeOpenCamera / nativeStartCapture, per handle):
+ *   Optional capture thread that reads the camera through OpenCV
+ *   (native_capture.cc), preprocesses and submits every frame itself; only
+ *   results and the optional BGRA preview (into a Java-supplied direct
+ *   buffer, via MediaPipeJni$CaptureCallback) cross JNI.  Unavailable on
+ *   Android, where CameraX frames come through nativePreprocessYuvFrame.
+ *
+ * Batched recognition (nativeCreateBatch / nativeDetectBatch):
+ *   One frame for each of several recognizers (cameras or ROIs) per JNI
+ *   call, run in parallel on a native worker pool and packed into
+ *   consecutive ring-format slots of one caller-owned buffer.
+ *
+ * Warm-up and sessions (nativeWarmUp / nativeResetSession, per handle):
+ *   Optional background pass of synthetic frames through a new tracker
+ *   before its first real frame, and a reset of per-session state so one
+ *   tracker can be kept alive across camera start/stop cycles.
+ *
+ * Latest snapshot (nativeReadLatest, per handle):
+ *   Every staged result is also published, in ring slot format, to a
+ *   seqlock (hand_snapshot.cc) that any thread can copy from without
+ *   locks or callbacks, in bounded time (audio/control-rate polling).
+ *
+ * Result log (nativeSetResultLog, per handle):
+ *   Optional memory-mapped file (result_log.cc) receiving every staged
+ *   result — timestamp, hands, handedness, landmarks, gesture ID — for
+ *   replay through ReplayHandTracker.
+ *
+ * Custom ASL classifier (nativeLoadAslClassifier, per handle):
+ *   Optional TFLite model (asl_classifier.cc) run once per hand on the
+ *   staged landmarks; its class ID and score go into ring slots only.
+ *
+ * Landmark smoothing (nativeSetLandmarkSmoothing, per handle):
+ *   Optional One-Euro filter (landmark_filter.cc) over the output-space
+ *   landmarks of every hand, applied once before any packer runs.
+ *
+ * Prediction (nativeSampleLandmarks / nativeNanoTime):
+ *   Every delivered result also feeds a per-handle predictor that fits
+ *   landmark velocity over the last few frames; sampling extrapolates the
+ *   newest result to the caller's time (on the bridge clock) as
+ *   [numHands, per-hand(handedness, 21*xyz)], at any rate and from any
+ *   thread.
+ *
+ * Versioning (nativeBridgeVersion):
+ *   BRIDGE_VERSION names this JNI surface; MediaPipeJni.initialize()
+ *   refuses a library whose version differs from its bindings. A library
+ *   without this entry point (version 0, the original six natives) is run in
+ *   legacy mode through the baseline signatures of the create calls.
+ *
+ * Android (arm64-v8a, build-native-mediapipe.sh --android):
+ *   The same library, loaded with System.loadLibrary; bridge warnings go to
+ *   logcat (tag MediaPipeJni) instead of stderr.
  */
 
-static JavaVM* g_jvm = nullptr;
+/* --- JNI context ---
+ * Class global refs and method IDs resolved once in JNI_OnLoad (on the thread
+ * calling System.load, so FindClass uses the app class loader rather than
+ * the system loader a natively attached MediaPipe thread would see).
+ * Released in JNI_OnUnload.  Nothing on the per-frame path calls FindClass,
+ * GetObjectClass or GetMethodID. */
+static struct JniContext {
+    JavaVM* jvm;
+    jclass string_class;              /* java/lang/String */
+    jclass runtime_exception_class;   /* java/lang/RuntimeException */
+    jclass result_callback_class;     /* MediaPipeJni$ResultCallback */
+    jclass gesture_callback_class;    /* MediaPipeJni$GestureResultCallback */
+    jclass ring_callback_class;       /* MediaPipeJni$RingCallback */
+    jclass capture_callback_class;    /* MediaPipeJni$CaptureCallback */
+    jmethodID hl_on_result;           /* onResult(float[], long) */
+    jmethodID gr_on_result;           /* onResult(float[], String[], long) */
+    jmethodID ring_on_slot;           /* onSlot(int, long) */
+    jmethodID ring_on_gesture_name;   /* onGestureName(int, String) */
+    jmethodID capture_preview_buffer; /* previewBuffer(int, int) -> ByteBuffer */
+    jmethodID capture_on_preview;     /* onPreview(int, int, long) */
+    jmethodID capture_on_stopped;     /* onCaptureStopped(String) */
+} g_jni;
+
+static void throw_exception(JNIEnv* env, const char* msg) {
+    env->ThrowNew(g_jni.runtime_exception_class, msg);
+}
+
+/* Diagnostics: stderr on desktop, logcat on Android (where stderr goes
+ * nowhere). */
+static void bridge_log(const char* format, ...) {
+    va_list args;
+    va_start(args, format);
+#if defined(__ANDROID__)
+    __android_log_vprint(ANDROID_LOG_WARN, "MediaPipeJni", format, args);
+#else
+    vfprintf(stderr, format, args);
+#endif
+    va_end(args);
+}
+
+/* Resolve a class and pin it with a global ref.  Returns nullptr with a
+ * pending exception if the class cannot be found. */
+static jclass find_global_class(JNIEnv* env, const char* name) {
+    jclass local = env->FindClass(name);
+    if (local == nullptr) return nullptr;
+    jclass global = static_cast<jclass>(env->NewGlobalRef(local));
+    env->DeleteLocalRef(local);
+    return global;
+}
+
+static bool jni_context_init(JNIEnv* env) {
+    g_jni.string_class = find_global_class(env, "java/lang/String");
+    g_jni.runtime_exception_class = find_global_class(env, "java/lang/RuntimeException");
+    g_jni.result_callback_class = find_global_class(
+        env, "org/balch/orpheus/core/mediapipe/MediaPipeJni$ResultCallback");
+    g_jni.gesture_callback_class = find_global_class(
+        env, "org/balch/orpheus/core/mediapipe/MediaPipeJni$GestureResultCallback");
+    g_jni.ring_callback_class = find_global_class(
+        env, "org/balch/orpheus/core/mediapipe/MediaPipeJni$RingCallback");
+    g_jni.capture_callback_class = find_global_class(
+        env, "org/balch/orpheus/core/mediapipe/MediaPipeJni$CaptureCallback");
+    if (!g_jni.string_class || !g_jni.runtime_exception_class ||
+        !g_jni.result_callback_class || !g_jni.gesture_callback_class ||
+        !g_jni.ring_callback_class || !g_jni.capture_callback_class) {
+        return false;
+    }
+
+    g_jni.hl_on_result = env->GetMethodID(g_jni.result_callback_class,
+                                          "onResult", "([FJ)V");
+    g_jni.gr_on_result = env->GetMethodID(g_jni.gesture_callback_class,
+                                          "onResult", "([F[Ljava/lang/String;J)V");
+    g_jni.ring_on_slot = env->GetMethodID(g_jni.ring_callback_class,
+                                          "onSlot", "(IJ)V");
+    g_jni.ring_on_gesture_name = env->GetMethodID(g_jni.ring_callback_class,
+                                                  "onGestureName", "(ILjava/lang/String;)V");
+    g_jni.capture_preview_buffer = env->GetMethodID(g_jni.capture_callback_class,
+                                                    "previewBuffer", "(II)Ljava/nio/ByteBuffer;");
+    g_jni.capture_on_preview = env->GetMethodID(g_jni.capture_callback_class,
+                                                "onPreview", "(IIJ)V");
+    g_jni.capture_on_stopped = env->GetMethodID(g_jni.capture_callback_class,
+                                                "onCaptureStopped", "(Ljava/lang/String;)V");
+    return g_jni.hl_on_result && g_jni.gr_on_result &&
+           g_jni.ring_on_slot && g_jni.ring_on_gesture_name &&
+           g_jni.capture_preview_buffer && g_jni.capture_on_preview &&
+           g_jni.capture_on_stopped;
+}
+
+static void jni_context_release(JNIEnv* env) {
+    jclass* classes[] = {
+        &g_jni.string_class, &g_jni.runtime_exception_class,
+        &g_jni.result_callback_class, &g_jni.gesture_callback_class,
+        &g_jni.ring_callback_class, &g_jni.capture_callback_class,
+    };
+    for (jclass* cls : classes) {
+        if (*cls != nullptr) env->DeleteGlobalRef(*cls);
+    }
+    JavaVM* vm = g_jni.jvm;
+    memset(&g_jni, 0, sizeof(g_jni));
+    g_jni.jvm = vm;
+}
+
+/* Helper: resolve the backing memory of a direct ByteBuffer holding a packed
+ * RGB frame.  No JVM-side copy is made (unlike GetByteArrayElements, which
+ * may duplicate the whole array).  Throws and returns nullptr if the buffer
+ * is not direct or is too small for width*height*3 bytes. */
+static uint8_t* direct_rgb_address(JNIEnv* env, jobject buffer,
+                                   jint width, jint height) {
+    void* address = env->GetDirectBufferAddress(buffer);
+    if (address == nullptr) {
+        throw_exception(env, "pixel buffer must be a direct ByteBuffer");
+        return nullptr;
+    }
+    jlong capacity = env->GetDirectBufferCapacity(buffer);
+    if (capacity < static_cast<jlong>(width) * height * 3) {
+        throw_exception(env, "pixel buffer smaller than width*height*3");
+        return nullptr;
+    }
+    return static_cast<uint8_t*>(address);
+}
+
+/* Address of a camera plane that must span at least min_bytes (its last
+ * row may be unpadded), or nullptr with an exception naming the plane. */
+static const uint8_t* direct_plane_address(JNIEnv* env, jobject buffer, jlong min_bytes,
+                                           const char* plane) {
+    const void* address = buffer != nullptr ? env->GetDirectBufferAddress(buffer) : nullptr;
+    if (address == nullptr || env->GetDirectBufferCapacity(buffer) < min_bytes) {
+        char message[128];
+        snprintf(message, sizeof(message),
+                 "%s plane must be a direct buffer of at least %lld bytes", plane,
+                 static_cast<long long>(min_bytes));
+        throw_exception(env, message);
+        return nullptr;
+    }
+    return static_cast<const uint8_t*>(address);
+}
+
+/* --- Callback thread attachment ---
+ * MediaPipe's LIVE_STREAM worker thread is attached to the JVM on its first
+ * callback and stays attached until it exits; the thread_local guard below
+ * detaches it from the thread-exit destructor.  Attaching per result would
+ * create (and garbage) a java.lang.Thread every frame.  Because JNI never
+ * returns to Java on such a thread, callbacks must free their local refs
+ * (PushLocalFrame/PopLocalFrame) and clear any exception a callback threw. */
+struct ThreadAttachment {
+    bool attached = false;
+    ~ThreadAttachment() {
+        if (attached && g_jni.jvm != nullptr) g_jni.jvm->DetachCurrentThread();
+    }
+};
+static thread_local ThreadAttachment t_attachment;
+
+/* Helper: JNIEnv for the current thread, attaching it (as a daemon, so it
+ * never blocks JVM shutdown) on first use. */
+static JNIEnv* attached_env() {
+    JNIEnv* env = nullptr;
+    jint result = g_jni.jvm->GetEnv(reinterpret_cast<void**>(&env), JNI_VERSION_1_6);
+    if (result == JNI_OK) return env;
+    if (result != JNI_EDETACHED) return nullptr;
+
+    JavaVMAttachArgs args;
+    args.version = JNI_VERSION_1_6;
+    args.name = const_cast<char*>("MediaPipe-callback");
+    args.group = nullptr;
+    if (g_jni.jvm->AttachCurrentThreadAsDaemon(reinterpret_cast<void**>(&env), &args) != JNI_OK) {
+        return nullptr;
+    }
+    t_attachment.attached = true;
+    return env;
+}
+
+/* Helper: clear an exception thrown by a Java callback on a native thread,
+ * where nothing would otherwise ever observe (and clear) it. */
+static void clear_callback_exception(JNIEnv* env) {
+    if (env->ExceptionCheck()) {
+        env->ExceptionDescribe();
+        env->ExceptionClear();
+    }
+}
+
+/* ========================================================================
+ * Model options
+ * ======================================================================== */
+
+enum TrackerDelegate { DELEGATE_CPU = 0, DELEGATE_GPU = 1 };
+
+/* Create-time options shared by HandLandmarker and GestureRecognizer. */
+struct TrackerOptions {
+    int num_hands;
+    float min_hand_detection_confidence;
+    float min_hand_presence_confidence;
+    float min_tracking_confidence;
+    TrackerDelegate delegate;
+};
+
+static TrackerOptions tracker_options(jint numHands, jfloat detectionConfidence,
+                                      jfloat presenceConfidence, jfloat trackingConfidence,
+                                      jint delegate) {
+    TrackerOptions o;
+    /* Result formats carry at most two hands. */
+    o.num_hands = numHands < 1 ? 1 : (numHands > 2 ? 2 : (int)numHands);
+    o.min_hand_detection_confidence = detectionConfidence;
+    o.min_hand_presence_confidence = presenceConfidence;
+    o.min_tracking_confidence = trackingConfidence;
+    o.delegate = delegate == DELEGATE_GPU ? DELEGATE_GPU : DELEGATE_CPU;
+#if !defined(ORPHEUS_MEDIAPIPE_GPU)
+    if (o.delegate == DELEGATE_GPU) {
+        /* This build sets MEDIAPIPE_DISABLE_GPU, so inference always runs
+         * on the CPU (XNNPACK) path. */
+        bridge_log("[MediaPipe JNI] GPU delegate not available in this build, using CPU\n");
+        o.delegate = DELEGATE_CPU;
+    }
+#endif
+    return o;
+}
+
+/* Copy TrackerOptions into a HandLandmarkerOptions / PooledTaskOptions
+ * (both share these field names). */
+template <typename MpOptions>
+static void apply_tracker_options(const TrackerOptions& o, MpOptions* options) {
+    options->num_hands = o.num_hands;
+    options->min_hand_detection_confidence = o.min_hand_detection_confidence;
+    options->min_hand_presence_confidence = o.min_hand_presence_confidence;
+    options->min_tracking_confidence = o.min_tracking_confidence;
+}
+
+/* Create a pooled task (pooled_recognizer_create / pooled_landmarker_create)
+ * on o's delegate.  If the GPU one fails, log and retry on CPU, updating
+ * o->delegate to what the task runs on. */
+template <typename Task>
+static Task* create_pooled_task(Task* (*create)(const PooledTaskOptions*, char*, size_t),
+                                const char* what, TrackerOptions* o,
+                                const struct BaseOptions* base, char* error, size_t error_size) {
+    PooledTaskOptions options;
+    options.base = base;
+    apply_tracker_options(*o, &options);
+    options.use_gpu = o->delegate == DELEGATE_GPU;
+
+    Task* task = create(&options, error, error_size);
+    if (task == nullptr && options.use_gpu) {
+        bridge_log("[MediaPipe JNI] %s on GPU failed (%s), using CPU\n", what, error);
+        options.use_gpu = false;
+        o->delegate = DELEGATE_CPU;
+        task = create(&options, error, error_size);
+    }
+    return task;
+}
+
+/* Model of a create call: a .task path, or the .task bytes in a direct
+ * ByteBuffer (memory-mapped or read from the JAR by ModelExtractor) passed
+ * as base_options.model_asset_buffer, so no model file has to exist.
+ * MediaPipe copies the buffer into its own BaseOptions during create, so
+ * it only has to outlive the create call. */
+struct ModelAsset {
+    jstring path;
+    const char* path_chars;
+};
+
+/* Point base at the buffer if given, else at the path.  Throws and returns
+ * false if neither is usable; otherwise pair with model_asset_release. */
+static bool model_asset_acquire(JNIEnv* env, jstring path, jobject buffer,
+                                BaseOptions* base, ModelAsset* asset) {
+    asset->path = path;
+    asset->path_chars = nullptr;
+    if (buffer != nullptr) {
+        void* address = env->GetDirectBufferAddress(buffer);
+        jlong capacity = env->GetDirectBufferCapacity(buffer);
+        if (address == nullptr || capacity <= 0 || capacity > (jlong)0xFFFFFFFFu) {
+            throw_exception(env, "model buffer must be a non-empty direct ByteBuffer under 4 GB");
+            return false;
+        }
+        base->model_asset_buffer = static_cast<const char*>(address);
+        base->model_asset_buffer_count = (unsigned int)capacity;
+        return true;
+    }
+    if (path == nullptr) {
+        throw_exception(env, "model path or buffer required");
+        return false;
+    }
+    asset->path_chars = env->GetStringUTFChars(path, nullptr);
+    base->model_asset_path = asset->path_chars;
+    return true;
+}
+
+static void model_asset_release(JNIEnv* env, ModelAsset* asset) {
+    if (asset->path_chars != nullptr) env->ReleaseStringUTFChars(asset->path, asset->path_chars);
+}
+
+/* ========================================================================
+ * Latency instrumentation
+ *
+ * Process-wide, lock-free histograms of per-frame stage durations, read via
+ * nativeGetStats.  Buckets are log-linear in nanoseconds (4 sub-buckets per
+ * power of two, ~25% resolution), so recording is a relaxed atomic
+ * increment and never blocks the frame path.
+ * ======================================================================== */
+
+enum StatsStage {
+    STAGE_IMAGE_CREATE,   /* MpImageCreateFromUint8Data (pixel copy) */
+    STAGE_INFERENCE,      /* RecognizeForVideo, or DetectAsync submit -> result */
+    STAGE_RESULT_PACK,    /* packing landmarks into the ring / float[] */
+    STAGE_JNI_CALLBACK,   /* CallVoidMethod into Kotlin */
+    STAGE_COUNT
+};
+
+#define STATS_VERSION 2
+#define STATS_SUB_BUCKETS 4
+#define STATS_BUCKETS (STATS_SUB_BUCKETS * 40)   /* up to ~2^41 ns */
+#define STATS_STAGE_FIELDS 6                     /* count, mean, p50, p95, p99, max */
+
+struct StageHistogram {
+    std::atomic<uint64_t> buckets[STATS_BUCKETS];
+    std::atomic<uint64_t> count;
+    std::atomic<uint64_t> sum_ns;
+    std::atomic<uint64_t> max_ns;
+};
+
+static struct {
+    StageHistogram stages[STAGE_COUNT];
+    std::atomic<uint64_t> frames_submitted;
+    std::atomic<uint64_t> results_delivered;
+    std::atomic<uint64_t> frames_dropped;
+    std::atomic<uint64_t> gestures_full;      /* full gesture recognitions */
+    std::atomic<uint64_t> gestures_tracked;   /* landmarks-only scheduled frames */
+} g_stats;
+
+static int64_t now_ns() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+/* Index of the highest set bit; v must be non-zero. */
+static int highest_bit(uint64_t v) {
+#if defined(_MSC_VER) && !defined(__clang__)
+    unsigned long index;
+    _BitScanReverse64(&index, v);
+    return (int)index;
+#else
+    return 63 - __builtin_clzll(v);
+#endif
+}
+
+static int stats_bucket(uint64_t ns) {
+    if (ns < STATS_SUB_BUCKETS) return (int)ns;
+    int exp = highest_bit(ns);                                  /* >= 2 */
+    int sub = (int)((ns >> (exp - 2)) & (STATS_SUB_BUCKETS - 1));
+    int bucket = (exp - 1) * STATS_SUB_BUCKETS + sub;
+    return bucket < STATS_BUCKETS ? bucket : STATS_BUCKETS - 1;
+}
+
+/* Lower bound of a bucket, in nanoseconds. */
+static uint64_t stats_bucket_floor(int bucket) {
+    if (bucket < STATS_SUB_BUCKETS) return (uint64_t)bucket;
+    int exp = bucket / STATS_SUB_BUCKETS + 1;
+    uint64_t sub = (uint64_t)(bucket % STATS_SUB_BUCKETS);
+    return (STATS_SUB_BUCKETS + sub) << (exp - 2);
+}
+
+static void stats_record_ns(StatsStage stage, int64_t elapsed_ns) {
+    uint64_t ns = elapsed_ns > 0 ? (uint64_t)elapsed_ns : 0;
+    StageHistogram* h = &g_stats.stages[stage];
+    h->buckets[stats_bucket(ns)].fetch_add(1, std::memory_order_relaxed);
+    h->count.fetch_add(1, std::memory_order_relaxed);
+    h->sum_ns.fetch_add(ns, std::memory_order_relaxed);
+    uint64_t max = h->max_ns.load(std::memory_order_relaxed);
+    while (ns > max && !h->max_ns.compare_exchange_weak(max, ns, std::memory_order_relaxed)) {}
+}
+
+/* Record the time elapsed since start_ns (from now_ns()). */
+static void stats_record(StatsStage stage, int64_t start_ns) {
+    stats_record_ns(stage, now_ns() - start_ns);
+}
+
+static void stats_count(std::atomic<uint64_t>* counter) {
+    counter->fetch_add(1, std::memory_order_relaxed);
+}
+
+/* Write [count, mean, p50, p95, p99, max] for one stage.  The bucket
+ * snapshot is not atomic as a whole; concurrent records may skew a read
+ * by a frame or two, which is fine for monitoring. */
+static void stats_summarize(const StageHistogram* h, jlong* out) {
+    uint64_t snapshot[STATS_BUCKETS];
+    uint64_t total = 0;
+    for (int i = 0; i < STATS_BUCKETS; i++) {
+        snapshot[i] = h->buckets[i].load(std::memory_order_relaxed);
+        total += snapshot[i];
+    }
+
+    out[0] = (jlong)total;
+    out[1] = total > 0 ? (jlong)(h->sum_ns.load(std::memory_order_relaxed) /
+                                 h->count.load(std::memory_order_relaxed)) : 0;
+    const double quantiles[3] = {0.50, 0.95, 0.99};
+    for (int q = 0; q < 3; q++) {
+        uint64_t rank = (uint64_t)(quantiles[q] * (double)total);
+        uint64_t seen = 0;
+        jlong value = 0;
+        for (int i = 0; i < STATS_BUCKETS && total > 0; i++) {
+            seen += snapshot[i];
+            if (seen > rank) {
+                value = (jlong)stats_bucket_floor(i);
+                break;
+            }
+        }
+        out[2 + q] = value;
+    }
+    out[5] = (jlong)h->max_ns.load(std::memory_order_relaxed);
+}
+
+static void stats_reset() {
+    for (int s = 0; s < STAGE_COUNT; s++) {
+        StageHistogram* h = &g_stats.stages[s];
+        for (int i = 0; i < STATS_BUCKETS; i++) h->buckets[i].store(0, std::memory_order_relaxed);
+        h->count.store(0, std::memory_order_relaxed);
+        h->sum_ns.store(0, std::memory_order_relaxed);
+        h->max_ns.store(0, std::memory_order_relaxed);
+    }
+    g_stats.frames_submitted.store(0, std::memory_order_relaxed);
+    g_stats.results_delivered.store(0, std::memory_order_relaxed);
+    g_stats.frames_dropped.store(0, std::memory_order_relaxed);
+    g_stats.gestures_full.store(0, std::memory_order_relaxed);
+    g_stats.gestures_tracked.store(0, std::memory_order_relaxed);
+}
+
+/* ========================================================================
+ * Tracker instances
+ *
+ * Every landmarker/recognizer gets its own Tracker context, returned to
+ * Kotlin as the opaque jlong handle.  It owns the MediaPipe task, the
+ * callback ref and the result ring, so several trackers (one per camera)
+ * can run in one process without cross-talk.
+ * ======================================================================== */
+
+#define RING_MAX_HANDS 2
+#define RING_HAND_FLOATS 86   /* handedness, gestureId, gestureScore, 21*xyz, features,
+                                 aslClassId, aslScore */
+#define RING_SLOT_FLOATS (1 + RING_MAX_HANDS * RING_HAND_FLOATS)
+#define RING_MAX_GESTURES 32
+#define RING_GESTURE_NAME_LEN 48
+
+/* Fixed ring of packed result slots in a caller-owned direct buffer. */
+struct ResultRing {
+    jobject buffer;          /* global ref keeps the direct buffer alive */
+    float* base;             /* nullptr when ring mode is off */
+    int slot_count;
+    int next_slot;
+    jobject callback;        /* MediaPipeJni$RingCallback */
+    char gesture_names[RING_MAX_GESTURES][RING_GESTURE_NAME_LEN];
+    int gesture_count;
+};
+
+enum TrackerKind { TRACKER_LANDMARKER, TRACKER_GESTURE_RECOGNIZER };
+
+enum FlowPolicy { FLOW_DROP_NEWEST = 0, FLOW_DROP_OLDEST = 1 };
+
+#define FLOW_MAX_IN_FLIGHT 8
+#define FLOW_SUBMIT_HISTORY 16
+
+/* LIVE_STREAM backpressure state (see "In-flight limit" below). */
+struct FlowControl {
+    std::mutex mutex;
+    int max_in_flight;                        /* 0 = unlimited */
+    FlowPolicy policy;
+    bool closing;                             /* no staged submits once set */
+    int64_t in_flight_ts[FLOW_MAX_IN_FLIGHT]; /* submitted, no result yet */
+    int in_flight;
+    int64_t last_submitted_ts;
+    MpImagePtr staged;                        /* DROP_OLDEST pending frame */
+    int64_t staged_ts;
+    int64_t dropped;
+    /* Recent submits (timestamp, submit time) for the inference histogram. */
+    int64_t submit_ts[FLOW_SUBMIT_HISTORY];
+    int64_t submit_ns[FLOW_SUBMIT_HISTORY];
+    int submit_head;
+};
+
+/* ========================================================================
+ * ROI tracking
+ *
+ * Instead of feeding the whole letterboxed frame (mostly padding and
+ * background), nativePreprocessArgbRoi crops a square around the hands of
+ * the previous result, with a margin, and resamples it to ROI_OUTPUT_SIZE.
+ * Results for such frames are mapped back to full-square coordinates before
+ * packing, so consumers never see crop space.
+ *
+ * The ROI only moves when the hands leave it or it becomes much too large,
+ * keeping MediaPipe's own frame-to-frame tracking stable.  The full frame is
+ * used when tracking is lost, and every ROI_REDETECT_INTERVAL frames while
+ * fewer than num_hands hands are tracked so new hands can be picked up.
+ * ======================================================================== */
+
+#define ROI_OUTPUT_SIZE 256
+#define ROI_MARGIN 1.8f              /* crop side / landmark bbox side */
+#define ROI_MIN_SIDE 0.2f            /* of the full square */
+#define ROI_SHRINK_RATIO 1.6f        /* re-fit once crop > this * needed side */
+#define ROI_REDETECT_INTERVAL 15
+#define ROI_HISTORY 16
+
+/* Crop-normalized -> full-square-normalized: v_full = origin + v * scale. */
+struct RoiTransform {
+    float x0;
+    float y0;
+    float scale;
+};
+
+static const RoiTransform kRoiIdentity = {0.0f, 0.0f, 1.0f};
+
+struct RoiState {
+    std::mutex mutex;
+    bool valid;                             /* current ROI usable */
+    RoiTransform current;
+    int tracked_hands;
+    int frames_since_full;
+    int64_t history_ts[ROI_HISTORY];        /* transform used per submitted frame */
+    RoiTransform history[ROI_HISTORY];
+    bool history_used[ROI_HISTORY];
+    int history_head;
+};
+
+/* Choose the window for the frame about to be submitted at timestamp_ms
+ * and remember it for the result.  num_hands is the tracker's hand limit. */
+static RoiTransform roi_plan(RoiState* roi, int num_hands, int64_t timestamp_ms) {
+    std::lock_guard<std::mutex> lock(roi->mutex);
+    RoiTransform xf = kRoiIdentity;
+    bool redetect = roi->tracked_hands < num_hands &&
+                    roi->frames_since_full >= ROI_REDETECT_INTERVAL;
+    if (roi->valid && !redetect) {
+        xf = roi->current;
+        roi->frames_since_full++;
+    } else {
+        roi->frames_since_full = 0;
+    }
+
+    int slot = roi->history_head;
+    roi->history_head = (slot + 1) % ROI_HISTORY;
+    roi->history_ts[slot] = timestamp_ms;
+    roi->history[slot] = xf;
+    roi->history_used[slot] = true;
+    return xf;
+}
+
+/* Look up the window the frame at timestamp_ms was cropped with (identity
+ * if it was not planned, e.g. submitted via the full-frame path), then fit
+ * the next window to this result's landmarks. */
+static RoiTransform roi_on_result(RoiState* roi, int64_t timestamp_ms,
+                                  const struct NormalizedLandmarks* landmarks,
+                                  uint32_t landmarks_count) {
+    std::lock_guard<std::mutex> lock(roi->mutex);
+    RoiTransform xf = kRoiIdentity;
+    for (int i = 0; i < ROI_HISTORY; i++) {
+        if (roi->history_used[i] && roi->history_ts[i] == timestamp_ms) {
+            xf = roi->history[i];
+            roi->history_used[i] = false;
+            break;
+        }
+    }
+
+    float min_x = 1e9f, min_y = 1e9f, max_x = -1e9f, max_y = -1e9f;
+    int hands = 0;
+    for (uint32_t h = 0; h < landmarks_count && h < 2; h++) {
+        const struct NormalizedLandmarks* lms = &landmarks[h];
+        if (lms->landmarks_count == 0) continue;
+        hands++;
+        for (uint32_t i = 0; i < lms->landmarks_count; i++) {
+            float x = xf.x0 + lms->landmarks[i].x * xf.scale;
+            float y = xf.y0 + lms->landmarks[i].y * xf.scale;
+            if (x < min_x) min_x = x;
+            if (x > max_x) max_x = x;
+            if (y < min_y) min_y = y;
+            if (y > max_y) max_y = y;
+        }
+    }
+    roi->tracked_hands = hands;
+    if (hands == 0) {
+        roi->valid = false;   /* tracking lost: next frame is full */
+        return xf;
+    }
+
+    float extent = max_x - min_x > max_y - min_y ? max_x - min_x : max_y - min_y;
+    float needed = extent * ROI_MARGIN;
+    if (needed < ROI_MIN_SIDE) needed = ROI_MIN_SIDE;
+    if (needed >= 1.0f) {
+        roi->valid = false;   /* hands fill the frame: crop buys nothing */
+        return xf;
+    }
+
+    const RoiTransform& cur = roi->current;
+    bool contains = roi->valid &&
+                    min_x >= cur.x0 && max_x <= cur.x0 + cur.scale &&
+                    min_y >= cur.y0 && max_y <= cur.y0 + cur.scale;
+    if (!contains || cur.scale > needed * ROI_SHRINK_RATIO) {
+        float cx = (min_x + max_x) * 0.5f;
+        float cy = (min_y + max_y) * 0.5f;
+        roi->current.x0 = cx - needed * 0.5f;
+        roi->current.y0 = cy - needed * 0.5f;
+        roi->current.scale = needed;
+        roi->valid = true;
+    }
+    return xf;
+}
+
+/* ========================================================================
+ * Output coordinates
+ *
+ * With the capture geometry set at create time, packers emit landmarks in
+ * final capture-normalized coordinates (ROI crop and letterbox padding
+ * undone) and handedness as the user sees it: the camera preview is
+ * mirrored, so MediaPipe's "Right" is the user's left hand.  Without it
+ * (width 0), coordinates stay in full-square space.
+ * ======================================================================== */
+
+struct CaptureGeometry {
+    int width;        /* 0 = square-space output */
+    int height;
+    bool mirrored;    /* frames were flipped horizontally before inference */
+};
+
+/* v_out = offset + v * scale, per axis (z is only ROI-scaled). */
+struct LandmarkTransform {
+    float sx, ox;
+    float sy, oy;
+    float sz;
+};
+
+static LandmarkTransform landmark_transform(const CaptureGeometry& geometry,
+                                            const RoiTransform& roi) {
+    LandmarkTransform lt = {roi.scale, roi.x0, roi.scale, roi.y0, roi.scale};
+    if (geometry.width > 0 && geometry.height > 0) {
+        int size = frame_square_size(geometry.width, geometry.height);
+        float pad_x = (float)((size - geometry.width) / 2);
+        float pad_y = (float)((size - geometry.height) / 2);
+        float kx = (float)size / (float)geometry.width;
+        float ky = (float)size / (float)geometry.height;
+        lt.sx = roi.scale * kx;
+        lt.ox = roi.x0 * kx - pad_x / (float)geometry.width;
+        lt.sy = roi.scale * ky;
+        lt.oy = roi.y0 * ky - pad_y / (float)geometry.height;
+    }
+    return lt;
+}
+
+static CaptureGeometry capture_geometry(jint width, jint height, jboolean mirrored) {
+    CaptureGeometry g;
+    g.width = width > 0 && height > 0 ? (int)width : 0;
+    g.height = width > 0 && height > 0 ? (int)height : 0;
+    g.mirrored = mirrored == JNI_TRUE;
+    return g;
+}
+
+/* 1.0 if hand h is the user's right hand, else 0.0. */
+static float user_handedness(const struct Categories* handedness, uint32_t handedness_count,
+                             int h, bool mirrored) {
+    bool right = false;
+    if (h < (int)handedness_count && handedness[h].categories_count > 0) {
+        const char* name = handedness[h].categories[0].category_name;
+        right = name != nullptr && name[0] == 'R';
+    }
+    return right != mirrored ? 1.0f : 0.0f;
+}
+
+struct Tracker {
+    TrackerKind kind;
+    MpHandLandmarkerPtr landmarker;        /* TRACKER_LANDMARKER */
+    PooledRecognizer* recognizer;          /* TRACKER_GESTURE_RECOGNIZER */
+    ImagePool* images;                     /* frames for recognizer and `tracking` */
+    int callback_slot;                     /* hl trampoline slot, -1 if none */
+    jobject callback;                      /* per-frame callback, or nullptr */
+    ResultRing ring;
+    FlowControl flow;                      /* TRACKER_LANDMARKER */
+    RoiState roi;                          /* nativePreprocessArgbRoi */
+    CaptureGeometry geometry;
+    int num_hands;
+    TrackerOptions options;                /* create-time options, reused by `tracking` */
+    struct GestureWorker* worker;          /* recognizeGestureAsync, lazily started */
+    struct CaptureThread* capture;         /* nativeStartCapture, or nullptr */
+    std::atomic<struct WarmUp*> warmup;    /* nativeWarmUp, or nullptr */
+    std::atomic<int64_t> last_frame_ts;    /* newest real frame, INT64_MIN = none yet */
+    std::mutex filter_mutex;               /* guards the two fields below */
+    bool filter_enabled;                   /* nativeSetLandmarkSmoothing */
+    LandmarkFilter filter;
+    std::mutex predictor_mutex;            /* result thread vs nativeSampleLandmarks */
+    LandmarkPredictor predictor;
+    HandSnapshot latest;                   /* nativeReadLatest; result thread writes */
+    std::mutex log_mutex;                  /* result thread vs nativeSetResultLog */
+    ResultLog* log;                        /* nativeSetResultLog, or nullptr */
+    std::mutex asl_mutex;                  /* result thread vs nativeLoadAslClassifier */
+    AslClassifier* asl;                    /* custom ASL model, or nullptr */
+    std::mutex schedule_mutex;             /* frame thread vs nativeSetGestureSchedule */
+    PooledLandmarker* tracking;            /* skip-frame landmarker, or nullptr */
+    GestureSchedule schedule;
+};
+
+static Tracker* tracker_from_handle(jlong handle) {
+    return reinterpret_cast<Tracker*>(handle);
+}
+
+/* ========================================================================
+ * Landmark staging
+ *
+ * Every packer starts from the same StagedHands block: handedness,
+ * 21*xyz and the feature vector per hand, already in output coordinates
+ * and, when smoothing is enabled, filtered (features are computed from
+ * the filtered landmarks).  Staging also feeds the predictor.  Filter and
+ * predictor state are keyed by handedness rather than by MediaPipe's
+ * result index, which can swap between frames; a hand that drops out of
+ * a frame loses its history.
+ *
+ * frame_ns is when the frame entered the bridge (now_ns clock), so both
+ * see frame spacing and prediction spans the inference latency.
+ * ======================================================================== */
+
+/* Extrapolate at most this far past the newest result; beyond it the
+ * prediction holds.  Covers a few frames of inference latency. */
+#define PREDICT_MAX_HORIZON_NS 100000000LL
+
+struct StagedHands {
+    int count;
+    float handedness[RING_MAX_HANDS];
+    float xyz[RING_MAX_HANDS][LANDMARK_FILTER_HAND_STRIDE];
+    float features[RING_MAX_HANDS][HAND_FEATURE_COUNT];
+    int asl_class[RING_MAX_HANDS];        /* -1 without a custom classifier */
+    float asl_score[RING_MAX_HANDS];
+};
+
+/* Handedness slot of each hand: the user's right hand takes slot 1, the
+ * left slot 0, and a second hand labelled alike takes the other one. */
+static void hand_slots(const float* handedness, int count, int* slots) {
+    bool used[RING_MAX_HANDS] = {false, false};
+    for (int h = 0; h < count; h++) {
+        int slot = handedness[h] >= 0.5f ? 1 : 0;
+        if (used[slot]) slot = 1 - slot;
+        used[slot] = true;
+        slots[h] = slot;
+    }
+}
+
+static void stage_hands(Tracker* t,
+                        const struct Categories* handedness, uint32_t handedness_count,
+                        const struct NormalizedLandmarks* landmarks, uint32_t landmarks_count,
+                        const LandmarkTransform& lt, int64_t frame_ns,
+                        StagedHands* out) {
+    int numHands = (int)landmarks_count;
+    if (numHands > RING_MAX_HANDS) numHands = RING_MAX_HANDS;
+    out->count = numHands;
+
+    for (int h = 0; h < numHands; h++) {
+        out->handedness[h] = user_handedness(handedness, handedness_count,
+                                             h, t->geometry.mirrored);
+        float* xyz = out->xyz[h];
+        memset(xyz, 0, sizeof(out->xyz[h]));
+        const struct NormalizedLandmarks* lms = &landmarks[h];
+        unsigned int count = lms->landmarks_count < 21 ? lms->landmarks_count : 21;
+        for (unsigned int i = 0; i < count; i++) {
+            xyz[i * 3]     = lt.ox + lms->landmarks[i].x * lt.sx;
+            xyz[i * 3 + 1] = lt.oy + lms->landmarks[i].y * lt.sy;
+            xyz[i * 3 + 2] = lms->landmarks[i].z * lt.sz;
+        }
+    }
+
+    int slots[RING_MAX_HANDS];
+    bool used[RING_MAX_HANDS] = {false, false};
+    hand_slots(out->handedness, numHands, slots);
+    for (int h = 0; h < numHands; h++) used[slots[h]] = true;
+
+    {
+        std::lock_guard<std::mutex> lock(t->filter_mutex);
+        if (t->filter_enabled) {
+            for (int h = 0; h < numHands; h++) {
+                landmark_filter_apply(&t->filter, slots[h], frame_ns, out->xyz[h]);
+            }
+            for (int slot = 0; slot < RING_MAX_HANDS; slot++) {
+                if (!used[slot]) landmark_filter_forget(&t->filter, slot);
+            }
+        }
+    }
+
+    for (int h = 0; h < numHands; h++) {
+        hand_features_compute(out->xyz[h], out->features[h]);
+        out->asl_class[h] = -1;
+        out->asl_score[h] = 0.0f;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(t->asl_mutex);
+        if (t->asl != nullptr) {
+            /* Undo the capture aspect so the model sees square-space units. */
+            float kx = 1.0f, ky = 1.0f;
+            if (t->geometry.width > 0) {
+                float size = (float)frame_square_size(t->geometry.width, t->geometry.height);
+                kx = (float)t->geometry.width / size;
+                ky = (float)t->geometry.height / size;
+            }
+            for (int h = 0; h < numHands; h++) {
+                if (!asl_classifier_run(t->asl, out->xyz[h], out->handedness[h] >= 0.5f,
+                                        kx, ky, &out->asl_class[h], &out->asl_score[h])) {
+                    out->asl_class[h] = -1;
+                    out->asl_score[h] = 0.0f;
+                }
+            }
+        }
+    }
+
+    std::lock_guard<std::mutex> lock(t->predictor_mutex);
+    for (int h = 0; h < numHands; h++) {
+        landmark_predictor_push(&t->predictor, slots[h], out->handedness[h],
+                                frame_ns, out->xyz[h]);
+    }
+    for (int slot = 0; slot < RING_MAX_HANDS; slot++) {
+        if (!used[slot]) landmark_predictor_forget(&t->predictor, slot);
+    }
+}
+
+/* Top gesture name (nullptr = none) and score per staged hand.  gestures
+ * may be nullptr (HandLandmarker path). */
+static void top_gestures(const StagedHands& hands, const struct Categories* gestures,
+                         uint32_t gestures_count, const char** names, float* scores) {
+    for (int h = 0; h < RING_MAX_HANDS; h++) {
+        names[h] = nullptr;
+        scores[h] = 0.0f;
+        if (h < hands.count && gestures != nullptr && h < (int)gestures_count &&
+            gestures[h].categories_count > 0) {
+            names[h] = gestures[h].categories[0].category_name;
+            scores[h] = gestures[h].categories[0].score;
+        }
+    }
+}
+
+static bool tracker_logging(Tracker* t) {
+    std::lock_guard<std::mutex> lock(t->log_mutex);
+    return t->log != nullptr;
+}
+
+/* Append staged hands to the tracker's result log, if it has one.
+ * gestures may be nullptr (HandLandmarker path). */
+static void tracker_log_result(Tracker* t, const StagedHands& hands,
+                               const struct Categories* gestures, uint32_t gestures_count,
+                               int64_t timestamp_ms, int64_t frame_ns) {
+    const char* names[RING_MAX_HANDS];
+    float scores[RING_MAX_HANDS];
+    top_gestures(hands, gestures, gestures_count, names, scores);
+    std::lock_guard<std::mutex> lock(t->log_mutex);
+    if (t->log == nullptr) return;
+    result_log_append(t->log, timestamp_ms, frame_ns, hands.count, hands.handedness, names, scores,
+                      &hands.xyz[0][0], LANDMARK_FILTER_HAND_STRIDE);
+}
+
+/* ========================================================================
+ * Result ring
+ * ======================================================================== */
+
+/* Map a gesture category name to a stable small ID, announcing new names to
+ * Java exactly once.  Returns -1 for no gesture or when the table is full. */
+static int ring_intern_gesture(JNIEnv* env, ResultRing* ring, const char* name) {
+    if (name == nullptr) return -1;
+    for (int i = 0; i < ring->gesture_count; i++) {
+        if (strcmp(ring->gesture_names[i], name) == 0) return i;
+    }
+    if (ring->gesture_count >= RING_MAX_GESTURES) return -1;
+
+    int id = ring->gesture_count++;
+    snprintf(ring->gesture_names[id], RING_GESTURE_NAME_LEN, "%s", name);
+    jstring jname = env->NewStringUTF(ring->gesture_names[id]);
+    env->CallVoidMethod(ring->callback, g_jni.ring_on_gesture_name, (jint)id, jname);
+    env->DeleteLocalRef(jname);
+    return id;
+}
+
+/* Write one frame's hands in slot format.  gesture_ids and gesture_scores
+ * are per hand; -1 = no gesture. */
+static void pack_slot(float* buf, const StagedHands& hands,
+                      const int* gesture_ids, const float* gesture_scores) {
+    buf[0] = (float)hands.count;
+
+    for (int h = 0; h < hands.count; h++) {
+        float* hand = buf + 1 + h * RING_HAND_FLOATS;
+
+        hand[0] = hands.handedness[h];
+        hand[1] = (float)gesture_ids[h];
+        hand[2] = gesture_scores[h];
+
+        memcpy(hand + 3, hands.xyz[h], sizeof(float) * LANDMARK_FILTER_HAND_FLOATS);
+        memcpy(hand + 3 + LANDMARK_FILTER_HAND_FLOATS, hands.features[h],
+               sizeof(float) * HAND_FEATURE_COUNT);
+        hand[3 + LANDMARK_FILTER_HAND_FLOATS + HAND_FEATURE_COUNT] = (float)hands.asl_class[h];
+        hand[4 + LANDMARK_FILTER_HAND_FLOATS + HAND_FEATURE_COUNT] = hands.asl_score[h];
+    }
+}
+
+/* Pack one frame's hands into the next ring slot and signal Java.
+ * gestures may be nullptr (HandLandmarker path). */
+/* pack_start is when the caller began staging, so RESULT_PACK covers the
+ * transform and filter too. */
+static void ring_deliver(JNIEnv* env, ResultRing* ring, const StagedHands& hands,
+                         const struct Categories* gestures, uint32_t gestures_count,
+                         int64_t pack_start, int64_t timestamp_ms) {
+    int slot = ring->next_slot;
+    ring->next_slot = (slot + 1) % ring->slot_count;
+
+    int gesture_ids[RING_MAX_HANDS];
+    float gesture_scores[RING_MAX_HANDS];
+    for (int h = 0; h < hands.count; h++) {
+        gesture_ids[h] = -1;
+        gesture_scores[h] = 0.0f;
+        if (gestures != nullptr && h < (int)gestures_count &&
+            gestures[h].categories_count > 0) {
+            gesture_ids[h] = ring_intern_gesture(env, ring, gestures[h].categories[0].category_name);
+            gesture_scores[h] = gestures[h].categories[0].score;
+        }
+    }
+    pack_slot(ring->base + (size_t)slot * RING_SLOT_FLOATS, hands, gesture_ids, gesture_scores);
+
+    stats_record(STAGE_RESULT_PACK, pack_start);
+
+    int64_t callback_start = now_ns();
+    env->CallVoidMethod(ring->callback, g_jni.ring_on_slot,
+                        (jint)slot, static_cast<jlong>(timestamp_ms));
+    stats_record(STAGE_JNI_CALLBACK, callback_start);
+    stats_count(&g_stats.results_delivered);
+}
+
+static void ring_clear(JNIEnv* env, ResultRing* ring) {
+    if (ring->buffer != nullptr) env->DeleteGlobalRef(ring->buffer);
+    if (ring->callback != nullptr) env->DeleteGlobalRef(ring->callback);
+    memset(ring, 0, sizeof(*ring));
+}
+
+/* ========================================================================
+ * Latest snapshot
+ * ======================================================================== */
+
+static_assert(RING_SLOT_FLOATS <= HAND_SNAPSHOT_MAX_FLOATS, "ring slot exceeds the snapshot");
+
+/* Publish staged hands, in slot format, as the tracker's latest result.
+ * names (nullptr, or per hand with nullptr / "" = no gesture) and scores
+ * as from top_gestures.  Result thread only; never blocks. */
+static void tracker_publish_latest(Tracker* t, const StagedHands& hands,
+                                   const char* const* names, const float* scores) {
+    static const float kNoScores[RING_MAX_HANDS] = {0.0f, 0.0f};
+    int gesture_ids[RING_MAX_HANDS];
+    for (int h = 0; h < hands.count; h++) {
+        gesture_ids[h] = hand_snapshot_intern(&t->latest, names != nullptr ? names[h] : nullptr);
+    }
+    float block[RING_SLOT_FLOATS] = {};
+    pack_slot(block, hands, gesture_ids, names != nullptr ? scores : kNoScores);
+    hand_snapshot_write(&t->latest, block);
+}
+
+/* ========================================================================
+ * Warm-up
+ *
+ * nativeWarmUp runs synthetic frames through a tracker that has not seen
+ * a real frame yet, on a background thread, so graph start-up, XNNPACK
+ * weight packing and first-inference allocations are paid before the
+ * camera delivers anything.  Warm-up frames use timestamps -n..-1, so
+ * the real stream (>= 0) stays monotonic in every graph, and their
+ * results are never delivered.  The first real frame preempts a running
+ * warm-up: it waits for the warm-up frame in progress, and the rest are
+ * skipped.
+ * ======================================================================== */
+
+#define WARMUP_MAX_ITERATIONS 32
+#define WARMUP_RESULT_TIMEOUT_MS 5000
+#define WARMUP_GRAY 128
+
+struct WarmUp {
+    std::thread thread;
+    std::mutex mutex;                /* held while a warm-up frame runs */
+    std::condition_variable cv;      /* LIVE_STREAM warm-up result arrived */
+    std::atomic<bool> abort;
+    std::atomic<bool> running;
+    int64_t completed_ts;            /* newest warm-up result, guarded by mutex */
+    int iterations;
+    int width;
+    int height;
+    std::vector<uint8_t> rgb;        /* the synthetic (or caller's) frame */
+};
+
+/* Result callback side of a LIVE_STREAM warm-up frame. */
+static void warmup_on_result(Tracker* t, int64_t timestamp_ms) {
+    WarmUp* w = t->warmup.load();
+    if (w == nullptr) return;
+    {
+        std::lock_guard<std::mutex> lock(w->mutex);
+        if (timestamp_ms > w->completed_ts) w->completed_ts = timestamp_ms;
+    }
+    w->cv.notify_all();
+}
+
+/* Called before every real frame reaches a graph: records its timestamp
+ * (see nativeResetSession) and preempts a running warm-up.  The frame is
+ * recorded before the warm-up is checked, and nativeWarmUp publishes the
+ * warm-up before its thread checks for frames, so one of the two always
+ * sees the other. */
+static void tracker_note_frame(Tracker* t, int64_t timestamp_ms) {
+    int64_t last = t->last_frame_ts.load();
+    while (timestamp_ms > last && !t->last_frame_ts.compare_exchange_weak(last, timestamp_ms)) {
+    }
+
+    WarmUp* w = t->warmup.load();
+    if (w == nullptr || !w->running.load(std::memory_order_acquire)) return;
+    w->abort.store(true, std::memory_order_release);
+    {
+        /* The warm-up holds the mutex except while waiting for a result,
+         * so this returns once the frame in progress is done. */
+        std::lock_guard<std::mutex> lock(w->mutex);
+    }
+    w->cv.notify_all();
+}
+
+/* First timestamp a new session on t may use. */
+static int64_t tracker_next_timestamp(Tracker* t) {
+    int64_t last = t->last_frame_ts.load();
+    return last == INT64_MIN ? 0 : last + 1;
+}
+
+/* Release everything a Tracker owns except the MediaPipe task itself. */
+static void tracker_free(JNIEnv* env, Tracker* t) {
+    ring_clear(env, &t->ring);
+    if (t->callback != nullptr) env->DeleteGlobalRef(t->callback);
+    if (t->asl != nullptr) asl_classifier_destroy(t->asl);
+    if (t->images != nullptr) image_pool_destroy(t->images);
+    result_log_close(t->log);
+    delete t->warmup.load();
+    delete t;
+}
+
+/* ========================================================================
+ * Hand Landmarker
+ * ======================================================================== */
+
+static void hl_on_result(Tracker* t, MpStatus status, const HandLandmarkerResult* result,
+                         int64_t timestamp_ms, int64_t frame_ns) {
+    bool ok = status == kMpOk && result != nullptr;
+    LandmarkTransform lt = landmark_transform(
+        t->geometry, roi_on_result(&t->roi, timestamp_ms,
+                                   ok ? result->hand_landmarks : nullptr,
+                                   ok ? result->hand_landmarks_count : 0));
+    bool delivering = g_jni.jvm != nullptr && (t->callback != nullptr || t->ring.base != nullptr);
+
+    int64_t pack_start = now_ns();
+    StagedHands hands;
+    stage_hands(t, ok ? result->handedness : nullptr, ok ? result->handedness_count : 0,
+                ok ? result->hand_landmarks : nullptr, ok ? result->hand_landmarks_count : 0,
+                lt, frame_ns, &hands);
+    tracker_publish_latest(t, hands, nullptr, nullptr);
+    if (tracker_logging(t)) tracker_log_result(t, hands, nullptr, 0, timestamp_ms, frame_ns);
+    if (!delivering) return;
+
+    JNIEnv* env = attached_env();
+    if (!env) return;
+    /* Bound local refs: this thread stays attached and never returns to Java. */
+    if (env->PushLocalFrame(16) != JNI_OK) return;
+
+    if (t->ring.base != nullptr) {
+        ring_deliver(env, &t->ring, hands, nullptr, 0, pack_start, timestamp_ms);
+        clear_callback_exception(env);
+        env->PopLocalFrame(nullptr);
+        return;
+    }
+
+    jfloatArray jResult = nullptr;
+
+    if (hands.count > 0) {
+        int perHand = 1 + LANDMARK_FILTER_HAND_FLOATS + HAND_FEATURE_COUNT;
+        int arraySize = 1 + hands.count * perHand;
+        jResult = env->NewFloatArray(arraySize);
+        jfloat* buf = env->GetFloatArrayElements(jResult, nullptr);
+
+        buf[0] = (float)hands.count;
+
+        for (int h = 0; h < hands.count; h++) {
+            int base = 1 + h * perHand;
+            buf[base] = hands.handedness[h];
+            memcpy(buf + base + 1, hands.xyz[h], sizeof(float) * LANDMARK_FILTER_HAND_FLOATS);
+            memcpy(buf + base + 1 + LANDMARK_FILTER_HAND_FLOATS, hands.features[h],
+                   sizeof(float) * HAND_FEATURE_COUNT);
+        }
+
+        env->ReleaseFloatArrayElements(jResult, buf, 0);
+    }
+
+    stats_record(STAGE_RESULT_PACK, pack_start);
+
+    int64_t callback_start = now_ns();
+    env->CallVoidMethod(t->callback, g_jni.hl_on_result,
+                        jResult, static_cast<jlong>(timestamp_ms));
+    stats_record(STAGE_JNI_CALLBACK, callback_start);
+    stats_count(&g_stats.results_delivered);
+
+    clear_callback_exception(env);
+    env->PopLocalFrame(nullptr);
+}
+
+/* --- In-flight limit ---
+ * LIVE_STREAM queues every submitted frame inside the graph, so when
+ * inference falls behind, hand-to-sound latency grows without bound.  With
+ * max_in_flight > 0 the bridge keeps at most that many frames outstanding
+ * and drops the rest:
+ *   DROP_NEWEST  the incoming frame is discarded while the graph is full.
+ *   DROP_OLDEST  the incoming frame replaces a single staged frame, which is
+ *                submitted from the result callback as soon as a frame
+ *                completes — the graph always gets the freshest frame.
+ * A result for timestamp T completes every outstanding frame <= T; frames
+ * the graph skipped internally are counted as dropped too.  All submits go
+ * through flow.mutex so timestamps reach the graph in increasing order. */
+static void flow_drop(FlowControl* flow) {
+    flow->dropped++;
+    stats_count(&g_stats.frames_dropped);
+}
+
+static void hl_submit_locked(Tracker* t, MpImagePtr image, int64_t timestamp_ms) {
+    FlowControl* flow = &t->flow;
+    if (timestamp_ms <= flow->last_submitted_ts) {
+        MpImageFree(image);
+        flow_drop(flow);
+        return;
+    }
+
+    char* error_msg = nullptr;
+    MpStatus status = MpHandLandmarkerDetectAsync(t->landmarker, image, nullptr,
+                                                  timestamp_ms, &error_msg);
+    if (status != kMpOk) {
+        if (error_msg) free(error_msg);
+        MpImageFree(image);
+        return;
+    }
+
+    flow->last_submitted_ts = timestamp_ms;
+    flow->submit_ts[flow->submit_head] = timestamp_ms;
+    flow->submit_ns[flow->submit_head] = now_ns();
+    flow->submit_head = (flow->submit_head + 1) % FLOW_SUBMIT_HISTORY;
+    stats_count(&g_stats.frames_submitted);
+    if (flow->max_in_flight > 0) {
+        flow->in_flight_ts[flow->in_flight++] = timestamp_ms;
+    }
+}
+
+static void hl_flow_submit(Tracker* t, MpImagePtr image, int64_t timestamp_ms) {
+    FlowControl* flow = &t->flow;
+    std::lock_guard<std::mutex> lock(flow->mutex);
+
+    if (flow->max_in_flight == 0 || flow->in_flight < flow->max_in_flight) {
+        hl_submit_locked(t, image, timestamp_ms);
+    } else if (flow->policy == FLOW_DROP_NEWEST) {
+        MpImageFree(image);
+        flow_drop(flow);
+    } else {
+        if (flow->staged != nullptr) {
+            MpImageFree(flow->staged);
+            flow_drop(flow);
+        }
+        flow->staged = image;
+        flow->staged_ts = timestamp_ms;
+    }
+}
+
+/* Result callback side: record submit -> result latency, retire frames up
+ * to timestamp_ms, then fill the freed capacity with the staged frame
+ * (DROP_OLDEST).  result_ns is when the result callback was entered. */
+/* When the frame with timestamp_ms was submitted, or fallback_ns if it is
+ * no longer in the submit history. */
+static int64_t hl_flow_submit_ns(Tracker* t, int64_t timestamp_ms, int64_t fallback_ns) {
+    FlowControl* flow = &t->flow;
+    std::lock_guard<std::mutex> lock(flow->mutex);
+    for (int i = 0; i < FLOW_SUBMIT_HISTORY; i++) {
+        if (flow->submit_ns[i] != 0 && flow->submit_ts[i] == timestamp_ms) {
+            return flow->submit_ns[i];
+        }
+    }
+    return fallback_ns;
+}
+
+static void hl_flow_complete(Tracker* t, int64_t timestamp_ms, int64_t result_ns) {
+    FlowControl* flow = &t->flow;
+    std::lock_guard<std::mutex> lock(flow->mutex);
+
+    for (int i = 0; i < FLOW_SUBMIT_HISTORY; i++) {
+        if (flow->submit_ns[i] != 0 && flow->submit_ts[i] == timestamp_ms) {
+            stats_record_ns(STAGE_INFERENCE, result_ns - flow->submit_ns[i]);
+            flow->submit_ns[i] = 0;
+            break;
+        }
+    }
+    if (flow->max_in_flight == 0) return;
+
+    int kept = 0;
+    for (int i = 0; i < flow->in_flight; i++) {
+        int64_t ts = flow->in_flight_ts[i];
+        if (ts > timestamp_ms) {
+            flow->in_flight_ts[kept++] = ts;
+        } else if (ts < timestamp_ms) {
+            flow_drop(flow);   /* skipped inside the graph, no result */
+        }
+    }
+    flow->in_flight = kept;
+
+    if (flow->staged != nullptr && !flow->closing && flow->in_flight < flow->max_in_flight) {
+        MpImagePtr image = flow->staged;
+        flow->staged = nullptr;
+        hl_submit_locked(t, image, flow->staged_ts);
+    }
+}
+
+/* --- LIVE_STREAM callback routing ---
+ * The C API result_callback carries no user-data pointer, so each live
+ * landmarker is bound to one of a fixed set of trampolines.  Slot i's
+ * trampoline forwards to the Tracker registered in g_hl_slots[i].  Slots
+ * are claimed before MpHandLandmarkerCreate and released after
+ * MpHandLandmarkerClose, which drains the graph, so a trampoline never
+ * sees a freed Tracker. */
+#define HL_MAX_INSTANCES 8
+
+typedef decltype(HandLandmarkerOptions::result_callback) HlResultCallback;
+
+static std::atomic<Tracker*> g_hl_slots[HL_MAX_INSTANCES];
+
+template <int N>
+static void hl_on_result_slot(MpStatus status, const HandLandmarkerResult* result,
+                              MpImagePtr image, int64_t timestamp_ms) {
+    Tracker* t = g_hl_slots[N].load(std::memory_order_acquire);
+    if (t == nullptr) return;
+    if (timestamp_ms < 0) {
+        warmup_on_result(t, timestamp_ms);   /* never delivered or accounted */
+        return;
+    }
+    int64_t result_ns = now_ns();
+    hl_on_result(t, status, result, timestamp_ms,
+                 hl_flow_submit_ns(t, timestamp_ms, result_ns));
+    hl_flow_complete(t, timestamp_ms, result_ns);
+}
+
+static const HlResultCallback kHlTrampolines[HL_MAX_INSTANCES] = {
+    hl_on_result_slot<0>, hl_on_result_slot<1>, hl_on_result_slot<2>, hl_on_result_slot<3>,
+    hl_on_result_slot<4>, hl_on_result_slot<5>, hl_on_result_slot<6>, hl_on_result_slot<7>,
+};
+
+/* Claim a free trampoline slot for t.  Returns the slot, or -1 if all
+ * HL_MAX_INSTANCES landmarkers are live. */
+static int hl_claim_slot(Tracker* t) {
+    for (int i = 0; i < HL_MAX_INSTANCES; i++) {
+        Tracker* expected = nullptr;
+        if (g_hl_slots[i].compare_exchange_strong(expected, t, std::memory_order_acq_rel)) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+static void hl_release_slot(int slot) {
+    if (slot >= 0) g_hl_slots[slot].store(nullptr, std::memory_order_release);
+}
+
+/* ========================================================================
+ * Gesture Recognizer
+ * ======================================================================== */
+
+/* One source's result from nativeDetectBatch, staged on a batch worker and
+ * packed by the calling thread (see "Batched recognition" below). */
+struct BatchResult {
+    StagedHands hands;
+    char gesture_names[RING_MAX_HANDS][RING_GESTURE_NAME_LEN];   /* "" = none */
+    float gesture_scores[RING_MAX_HANDS];
+};
+
+/* Pack result into JNI float array + gesture name strings and call Java callback,
+ * in the GestureRecognizer callback format described at the top of this file
+ * (83 floats per hand, ending in the hand features).  env must already be
+ * attached.
+ *
+ * Gesture names are passed as a separate String[] (one per hand), read
+ * directly from category_name each frame. No name-table indirection.
+ *
+ * With batch non-null the hands are only staged into it, for the batch
+ * caller to pack; env is unused and may be nullptr. */
+static void gr_deliver_result(JNIEnv* env, Tracker* t, const GestureRecognizerResult* result,
+                              int64_t timestamp_ms, int64_t frame_ns, BatchResult* batch) {
+    LandmarkTransform lt = landmark_transform(
+        t->geometry, roi_on_result(&t->roi, timestamp_ms, result->hand_landmarks,
+                                   result->hand_landmarks_count));
+    if (batch != nullptr) {
+        stage_hands(t, result->handedness, result->handedness_count,
+                    result->hand_landmarks, result->hand_landmarks_count, lt, frame_ns,
+                    &batch->hands);
+        for (int h = 0; h < RING_MAX_HANDS; h++) {
+            batch->gesture_names[h][0] = '\0';
+            batch->gesture_scores[h] = 0.0f;
+            if (h < batch->hands.count && h < (int)result->gestures_count &&
+                result->gestures[h].categories_count > 0) {
+                const struct Category* top = &result->gestures[h].categories[0];
+                if (top->category_name != nullptr) {
+                    snprintf(batch->gesture_names[h], RING_GESTURE_NAME_LEN, "%s",
+                             top->category_name);
+                }
+                batch->gesture_scores[h] = top->score;
+            }
+        }
+        const char* names[RING_MAX_HANDS] = {batch->gesture_names[0], batch->gesture_names[1]};
+        tracker_publish_latest(t, batch->hands, names, batch->gesture_scores);
+        if (tracker_logging(t)) {
+            tracker_log_result(t, batch->hands, result->gestures, result->gestures_count,
+                               timestamp_ms, frame_ns);
+        }
+        return;
+    }
+
+    int64_t pack_start = now_ns();
+    StagedHands hands;
+    stage_hands(t, result->handedness, result->handedness_count,
+                result->hand_landmarks, result->hand_landmarks_count, lt, frame_ns, &hands);
+    const char* names[RING_MAX_HANDS];
+    float scores[RING_MAX_HANDS];
+    top_gestures(hands, result->gestures, result->gestures_count, names, scores);
+    tracker_publish_latest(t, hands, names, scores);
+    if (tracker_logging(t)) {
+        tracker_log_result(t, hands, result->gestures, result->gestures_count,
+                           timestamp_ms, frame_ns);
+    }
+    if (t->ring.base == nullptr && t->callback == nullptr) return;
+
+    if (t->ring.base != nullptr) {
+        ring_deliver(env, &t->ring, hands, result->gestures, result->gestures_count,
+                     pack_start, timestamp_ms);
+        return;
+    }
+
+    jfloatArray jResult = nullptr;
+    jobjectArray jNames = nullptr;
+
+    if (hands.count > 0) {
+        int perHand = 2 + LANDMARK_FILTER_HAND_FLOATS + HAND_FEATURE_COUNT;
+        int arraySize = 1 + hands.count * perHand;
+
+        jResult = env->NewFloatArray(arraySize);
+        jfloat* buf = env->GetFloatArrayElements(jResult, nullptr);
+
+        jNames = env->NewObjectArray((jsize)hands.count, g_jni.string_class, nullptr);
+
+        buf[0] = (float)hands.count;
+
+        for (int h = 0; h < hands.count; h++) {
+            int base = 1 + h * perHand;
+
+            buf[base] = hands.handedness[h];
+
+            float gestureScore = 0.0f;
+            const char* gestureName = nullptr;
+            if (h < (int)result->gestures_count &&
+                result->gestures[h].categories_count > 0) {
+                gestureName = result->gestures[h].categories[0].category_name;
+                gestureScore = result->gestures[h].categories[0].score;
+            }
+            buf[base + 1] = gestureScore;
+
+            // Pass gesture name string directly — no index indirection
+            if (gestureName != nullptr) {
+                jstring jname = env->NewStringUTF(gestureName);
+                env->SetObjectArrayElement(jNames, (jsize)h, jname);
+                env->DeleteLocalRef(jname);
+            }
+
+            memcpy(buf + base + 2, hands.xyz[h], sizeof(float) * LANDMARK_FILTER_HAND_FLOATS);
+            memcpy(buf + base + 2 + LANDMARK_FILTER_HAND_FLOATS, hands.features[h],
+                   sizeof(float) * HAND_FEATURE_COUNT);
+        }
+
+        env->ReleaseFloatArrayElements(jResult, buf, 0);
+    }
+
+    stats_record(STAGE_RESULT_PACK, pack_start);
+
+    int64_t callback_start = now_ns();
+    env->CallVoidMethod(t->callback, g_jni.gr_on_result,
+                        jResult, jNames, static_cast<jlong>(timestamp_ms));
+    stats_record(STAGE_JNI_CALLBACK, callback_start);
+    stats_count(&g_stats.results_delivered);
+
+    if (jResult != nullptr) env->DeleteLocalRef(jResult);
+    if (jNames != nullptr) env->DeleteLocalRef(jNames);
+}
+
+/* Wrap packed RGB pixels in an MpImage and submit to the LIVE_STREAM
+ * landmarker.  Results arrive later via hl_on_result. */
+static void hl_detect_async(Tracker* t, const uint8_t* pixels,
+                            int width, int height, int64_t timestamp_ms) {
+    tracker_note_frame(t, timestamp_ms);
+    int dataSize = width * height * 3;
+
+    MpImagePtr image = nullptr;
+    char* error_msg = nullptr;
+    int64_t create_start = now_ns();
+    MpStatus status = MpImageCreateFromUint8Data(
+        kMpImageFormatSrgb, width, height, pixels, dataSize,
+        &image, &error_msg);
+    stats_record(STAGE_IMAGE_CREATE, create_start);
+
+    if (status != kMpOk) {
+        if (error_msg) free(error_msg);
+        return;
+    }
+
+    hl_flow_submit(t, image, timestamp_ms);
+}
+
+/* --- Skip-frame scheduling ---
+ * With a tracking landmarker attached (nativeSetGestureSchedule), frames the
+ * schedule doesn't need classified go to that landmarker instead of the
+ * recognizer: palm detection still runs whenever it loses the hand, but
+ * the gesture embedder and classifiers are skipped, and each hand is
+ * delivered with the label its handedness slot had at the last full
+ * recognition.  Both graphs run in VIDEO mode on the calling thread and
+ * each sees increasing timestamps.  The scheduler works on MediaPipe's own
+ * square-space landmarks, so ROI crops don't register as motion. */
+
+/* Slot-indexed raw landmarks (and each hand's slot) for the scheduler.
+ * xyz[slot] points into storage, or is nullptr for an empty slot. */
+static int schedule_hands(const Tracker* t,
+                          const struct Categories* handedness, uint32_t handedness_count,
+                          const struct NormalizedLandmarks* landmarks, uint32_t landmarks_count,
+                          float (*storage)[LANDMARK_FILTER_HAND_FLOATS],
+                          const float** xyz, int* slots) {
+    int numHands = (int)landmarks_count;
+    if (numHands > RING_MAX_HANDS) numHands = RING_MAX_HANDS;
+
+    float user[RING_MAX_HANDS];
+    for (int h = 0; h < numHands; h++) {
+        user[h] = user_handedness(handedness, handedness_count, h, t->geometry.mirrored);
+    }
+    hand_slots(user, numHands, slots);
+
+    for (int slot = 0; slot < RING_MAX_HANDS; slot++) xyz[slot] = nullptr;
+    for (int h = 0; h < numHands; h++) {
+        float* out = storage[slots[h]];
+        memset(out, 0, sizeof(storage[0]));
+        const struct NormalizedLandmarks* lms = &landmarks[h];
+        unsigned int count = lms->landmarks_count < 21 ? lms->landmarks_count : 21;
+        for (unsigned int i = 0; i < count; i++) {
+            out[i * 3]     = lms->landmarks[i].x;
+            out[i * 3 + 1] = lms->landmarks[i].y;
+            out[i * 3 + 2] = lms->landmarks[i].z;
+        }
+        xyz[slots[h]] = out;
+    }
+    return numHands;
+}
+
+/* Record a full recognition with the scheduler.  Caller holds schedule_mutex. */
+static void schedule_on_full(Tracker* t, const GestureRecognizerResult* result) {
+    float storage[RING_MAX_HANDS][LANDMARK_FILTER_HAND_FLOATS];
+    const float* xyz[RING_MAX_HANDS];
+    int slots[RING_MAX_HANDS];
+    int numHands = schedule_hands(t, result->handedness, result->handedness_count,
+                                  result->hand_landmarks, result->hand_landmarks_count,
+                                  storage, xyz, slots);
+
+    const char* labels[RING_MAX_HANDS] = {nullptr, nullptr};
+    float scores[RING_MAX_HANDS] = {0.0f, 0.0f};
+    for (int h = 0; h < numHands; h++) {
+        if (h < (int)result->gestures_count && result->gestures[h].categories_count > 0) {
+            labels[slots[h]] = result->gestures[h].categories[0].category_name;
+            scores[slots[h]] = result->gestures[h].categories[0].score;
+        }
+    }
+    gesture_schedule_on_full(&t->schedule, xyz, labels, scores);
+}
+
+/* Run a scheduled landmarks-only frame on t->tracking and deliver it (or
+ * stage it into batch, see gr_deliver_result).
+ * Entered with schedule_mutex held through `schedule`; releases it before
+ * calling into Java.  Returns false if detection failed (the next frame
+ * then gets full recognition). */
+static bool gr_track_for_video(JNIEnv* env, Tracker* t, const PooledImage* image,
+                               int64_t timestamp_ms, int64_t frame_ns,
+                               std::unique_lock<std::mutex>* schedule, BatchResult* batch) {
+    HandLandmarkerResult result;
+    char error[512];
+    int64_t inference_start = now_ns();
+    bool ok = pooled_landmarker_detect(t->tracking, image, timestamp_ms, &result,
+                                       error, sizeof(error));
+    stats_record(STAGE_INFERENCE, inference_start);
+
+    if (!ok) {
+        gesture_schedule_invalidate(&t->schedule);
+        schedule->unlock();
+        bridge_log("[JNI] GR tracking err: %s\n", error);
+        return false;
+    }
+
+    float storage[RING_MAX_HANDS][LANDMARK_FILTER_HAND_FLOATS];
+    const float* xyz[RING_MAX_HANDS];
+    int slots[RING_MAX_HANDS];
+    int numHands = schedule_hands(t, result.handedness, result.handedness_count,
+                                  result.hand_landmarks, result.hand_landmarks_count,
+                                  storage, xyz, slots);
+    gesture_schedule_on_tracking(&t->schedule, xyz);
+
+    /* Kept labels, shaped like the recognizer's gesture categories. */
+    char names[RING_MAX_HANDS][GESTURE_SCHEDULE_NAME_LEN];
+    struct Category kept[RING_MAX_HANDS];
+    struct Categories gestures[RING_MAX_HANDS];
+    for (int h = 0; h < numHands; h++) {
+        float score = 0.0f;
+        const char* label = gesture_schedule_label(&t->schedule, slots[h], &score);
+        gestures[h].categories = nullptr;
+        gestures[h].categories_count = 0;
+        if (label == nullptr) continue;
+        snprintf(names[h], GESTURE_SCHEDULE_NAME_LEN, "%s", label);
+        memset(&kept[h], 0, sizeof(kept[h]));
+        kept[h].index = -1;
+        kept[h].score = score;
+        kept[h].category_name = names[h];
+        gestures[h].categories = &kept[h];
+        gestures[h].categories_count = 1;
+    }
+    schedule->unlock();
+
+    stats_count(&g_stats.frames_submitted);
+    stats_count(&g_stats.gestures_tracked);
+
+    GestureRecognizerResult view;
+    memset(&view, 0, sizeof(view));
+    view.gestures = gestures;
+    view.gestures_count = (uint32_t)numHands;
+    view.handedness = result.handedness;
+    view.handedness_count = result.handedness_count;
+    view.hand_landmarks = result.hand_landmarks;
+    view.hand_landmarks_count = result.hand_landmarks_count;
+    view.hand_world_landmarks = result.hand_world_landmarks;
+    view.hand_world_landmarks_count = result.hand_world_landmarks_count;
+    gr_deliver_result(env, t, &view, timestamp_ms, frame_ns, batch);
+    return true;
+}
+
+/* Stage packed RGB pixels in the tracker's image pool, run synchronous
+ * VIDEO-mode recognition (or, when the skip-frame schedule allows,
+ * tracking only) and deliver the result to the Java callback, or stage it
+ * into batch when that is non-null.  frame_ns is when the frame entered
+ * the bridge.
+ * Returns false if staging or recognition failed. */
+static bool gr_recognize_for_video(JNIEnv* env, Tracker* t,
+                                   const uint8_t* pixels, int width, int height,
+                                   int64_t timestamp_ms, int64_t frame_ns,
+                                   BatchResult* batch) {
+    tracker_note_frame(t, timestamp_ms);
+
+    int64_t create_start = now_ns();
+    const PooledImage* image = image_pool_stage(t->images, pixels, width, height);
+    stats_record(STAGE_IMAGE_CREATE, create_start);
+
+    if (image == nullptr) {
+        bridge_log("[MediaPipe JNI] GR image pool exhausted\n");
+        return false;
+    }
+
+    std::unique_lock<std::mutex> schedule(t->schedule_mutex);
+    if (t->tracking != nullptr && !gesture_schedule_due(&t->schedule)) {
+        return gr_track_for_video(env, t, image, timestamp_ms, frame_ns, &schedule, batch);
+    }
+    schedule.unlock();
+
+    // Synchronous recognition — blocks until result is available.
+    GestureRecognizerResult result;
+    char error[512];
+    int64_t inference_start = now_ns();
+    bool ok = pooled_recognizer_recognize(t->recognizer, image, timestamp_ms, &result,
+                                          error, sizeof(error));
+    stats_record(STAGE_INFERENCE, inference_start);
+
+    if (!ok) {
+        bridge_log("[JNI] GR err: %s\n", error);
+        return false;
+    }
+    stats_count(&g_stats.frames_submitted);
+    stats_count(&g_stats.gestures_full);
+
+    schedule.lock();
+    if (t->tracking != nullptr) schedule_on_full(t, &result);
+    schedule.unlock();
+
+    gr_deliver_result(env, t, &result, timestamp_ms, frame_ns, batch);
+    return true;
+}
+
+/* ========================================================================
+ * Pipelined gesture recognition
+ *
+ * recognizeGestureAsync hands frames to a per-recognizer worker thread
+ * through a one-deep, latest-frame-wins mailbox, so capture/preprocess and
+ * inference overlap.  The worker still calls the VIDEO-mode recognizer
+ * synchronously (LIVE_STREAM crashes in Holder<Eigen::Matrix>); results
+ * are delivered from the worker thread.
+ * ======================================================================== */
+
+struct GestureWorker {
+    std::thread thread;
+    std::mutex mutex;
+    std::condition_variable cv;
+    std::vector<uint8_t> pending;   /* guarded by mutex */
+    std::vector<uint8_t> working;   /* worker-owned */
+    int width;
+    int height;
+    int64_t timestamp_ms;
+    int64_t frame_ns;
+    bool has_frame;
+    bool stop;
+    std::atomic<bool> last_ok;
+};
+
+static void gr_worker_loop(Tracker* t) {
+    GestureWorker* w = t->worker;
+    JNIEnv* env = attached_env();
+    if (!env) return;
+
+    for (;;) {
+        int width, height;
+        int64_t timestamp_ms, frame_ns;
+        {
+            std::unique_lock<std::mutex> lock(w->mutex);
+            w->cv.wait(lock, [w] { return w->has_frame || w->stop; });
+            if (w->stop) return;
+            w->pending.swap(w->working);
+            w->has_frame = false;
+            width = w->width;
+            height = w->height;
+            timestamp_ms = w->timestamp_ms;
+            frame_ns = w->frame_ns;
+        }
+
+        if (env->PushLocalFrame(16) != JNI_OK) continue;
+        bool ok = gr_recognize_for_video(env, t, w->working.data(), width, height,
+                                         timestamp_ms, frame_ns, nullptr);
+        clear_callback_exception(env);
+        env->PopLocalFrame(nullptr);
+        w->last_ok.store(ok, std::memory_order_relaxed);
+    }
+}
+
+/* Queue a frame for the worker, replacing any frame it has not picked up
+ * yet.  Starts the worker on first use. */
+static void gr_worker_submit(Tracker* t, const uint8_t* pixels, int width, int height,
+                             int64_t timestamp_ms) {
+    /* Recorded here too, so a frame still in the mailbox counts for
+     * nativeResetSession. */
+    tracker_note_frame(t, timestamp_ms);
+    if (t->worker == nullptr) {
+        t->worker = new GestureWorker();
+        t->worker->last_ok.store(true);
+        t->worker->thread = std::thread(gr_worker_loop, t);
+    }
+
+    GestureWorker* w = t->worker;
+    size_t bytes = (size_t)width * height * 3;
+    {
+        std::lock_guard<std::mutex> lock(w->mutex);
+        if (w->has_frame) stats_count(&g_stats.frames_dropped);   /* superseded */
+        w->pending.resize(bytes);
+        memcpy(w->pending.data(), pixels, bytes);
+        w->width = width;
+        w->height = height;
+        w->timestamp_ms = timestamp_ms;
+        w->frame_ns = now_ns();
+        w->has_frame = true;
+    }
+    w->cv.notify_one();
+}
+
+/* Stop and join the worker; a frame still in the mailbox is discarded. */
+static void gr_worker_stop(Tracker* t) {
+    GestureWorker* w = t->worker;
+    if (w == nullptr) return;
+    {
+        std::lock_guard<std::mutex> lock(w->mutex);
+        w->stop = true;
+    }
+    w->cv.notify_one();
+    w->thread.join();
+    delete w;
+    t->worker = nullptr;
+}
+
+/* ========================================================================
+ * Batched recognition
+ *
+ * nativeDetectBatch takes one frame for each of several GestureRecognizer
+ * handles (one per camera, or per ROI of one camera) in a single JNI
+ * crossing.  The frames are spread over a small pool of native workers;
+ * each handle is its own recognizer with its own graph and timestamps,
+ * so a worker only needs the handle it claimed.  The calling thread works
+ * through the batch too and then packs every result, in order, into a
+ * caller-owned direct buffer of ring-format slots.  Workers never touch
+ * the JVM.
+ *
+ * Gesture names are interned per batch object (not per handle) and read
+ * back with nativeBatchGestureName.
+ * ======================================================================== */
+
+#define BATCH_MAX_WORKERS 8
+#define BATCH_MAX_SOURCES 16
+
+struct BatchJob {
+    Tracker* tracker;
+    const uint8_t* pixels;
+    int width;
+    int height;
+    int64_t timestamp_ms;
+    int64_t frame_ns;
+    bool ok;
+    BatchResult result;
+};
+
+struct BatchPool {
+    std::vector<std::thread> threads;
+    std::mutex mutex;
+    std::condition_variable work_cv;     /* workers: jobs posted or stop */
+    std::condition_variable done_cv;     /* caller: last job finished */
+    BatchJob jobs[BATCH_MAX_SOURCES];
+    int job_count;                       /* guarded by mutex, as are the next two */
+    int next_job;
+    int unfinished;
+    bool stop;
+    std::mutex call_mutex;               /* one batch at a time; guards the names */
+    char gesture_names[RING_MAX_GESTURES][RING_GESTURE_NAME_LEN];
+    int gesture_count;
+};
+
+static void batch_run_job(BatchJob* job) {
+    job->ok = gr_recognize_for_video(nullptr, job->tracker, job->pixels,
+                                     job->width, job->height, job->timestamp_ms,
+                                     job->frame_ns, &job->result);
+}
+
+/* Claim and run jobs until none are left unclaimed.  Entered and left
+ * with `lock` held on b->mutex. */
+static void batch_drain(BatchPool* b, std::unique_lock<std::mutex>& lock) {
+    while (b->next_job < b->job_count) {
+        BatchJob* job = &b->jobs[b->next_job++];
+        lock.unlock();
+        batch_run_job(job);
+        lock.lock();
+        if (--b->unfinished == 0) b->done_cv.notify_one();
+    }
+}
+
+static void batch_worker_loop(BatchPool* b) {
+    std::unique_lock<std::mutex> lock(b->mutex);
+    for (;;) {
+        b->work_cv.wait(lock, [b] { return b->stop || b->next_job < b->job_count; });
+        if (b->stop) return;
+        batch_drain(b, lock);
+    }
+}
+
+/* Run b->jobs[0..count) on the workers and the calling thread; returns
+ * once all have finished. */
+static void batch_run(BatchPool* b, int count) {
+    std::unique_lock<std::mutex> lock(b->mutex);
+    b->job_count = count;
+    b->next_job = 0;
+    b->unfinished = count;
+    b->work_cv.notify_all();
+    batch_drain(b, lock);
+    b->done_cv.wait(lock, [b] { return b->unfinished == 0; });
+    b->job_count = 0;
+    b->next_job = 0;
+}
+
+/* Like ring_intern_gesture, without the Java announcement.  Caller holds
+ * call_mutex. */
+static int batch_intern_gesture(BatchPool* b, const char* name) {
+    if (name[0] == '\0') return -1;
+    for (int i = 0; i < b->gesture_count; i++) {
+        if (strcmp(b->gesture_names[i], name) == 0) return i;
+    }
+    if (b->gesture_count >= RING_MAX_GESTURES) return -1;
+
+    int id = b->gesture_count++;
+    snprintf(b->gesture_names[id], RING_GESTURE_NAME_LEN, "%s", name);
+    return id;
+}
+
+/* Pack jobs[0..count) into consecutive slots of out; a failed frame gets
+ * an empty slot. */
+static void batch_pack(BatchPool* b, int count, float* out) {
+    for (int i = 0; i < count; i++) {
+        int64_t pack_start = now_ns();
+        BatchJob* job = &b->jobs[i];
+        float* slot = out + (size_t)i * RING_SLOT_FLOATS;
+        if (!job->ok) {
+            slot[0] = 0.0f;
+            continue;
+        }
+        int gesture_ids[RING_MAX_HANDS];
+        for (int h = 0; h < job->result.hands.count; h++) {
+            gesture_ids[h] = batch_intern_gesture(b, job->result.gesture_names[h]);
+        }
+        pack_slot(slot, job->result.hands, gesture_ids, job->result.gesture_scores);
+        stats_record(STAGE_RESULT_PACK, pack_start);
+        stats_count(&g_stats.results_delivered);
+    }
+}
+
+static void batch_stop(BatchPool* b) {
+    {
+        std::lock_guard<std::mutex> lock(b->mutex);
+        b->stop = true;
+    }
+    b->work_cv.notify_all();
+    for (std::thread& thread : b->threads) thread.join();
+}
+
+/* ========================================================================
+ * Frame preprocessing
+ * ======================================================================== */
+
+/* Crop the ROI window planned from t's previous result and resample it to
+ * ROI_OUTPUT_SIZE, or letterbox the full frame when there is no usable
+ * ROI.  The window is recorded under timestamp_ms.  rgba selects R,G,B,A
+ * source bytes instead of ARGB.  dst must hold the full square.  Returns
+ * the output side length. */
+static int preprocess_roi(Tracker* t, const uint32_t* src, int width, int height,
+                          int src_stride, bool mirror, bool rgba, uint8_t* dst,
+                          int64_t timestamp_ms) {
+    int size = frame_square_size(width, height);
+    RoiTransform xf = roi_plan(&t->roi, t->num_hands, timestamp_ms);
+    if (xf.scale >= 1.0f) {
+        (rgba ? frame_rgba_to_rgb_square : frame_argb_to_rgb_square)(
+            src, width, height, src_stride, mirror, dst);
+        return size;
+    }
+    (rgba ? frame_rgba_crop_to_rgb : frame_argb_crop_to_rgb)(
+        src, width, height, src_stride, mirror, xf.x0 * size,
+        xf.y0 * size, xf.scale * size, ROI_OUTPUT_SIZE, dst);
+    return ROI_OUTPUT_SIZE;
+}
+
+/* ========================================================================
+ * Native capture
+ *
+ * nativeStartCapture hands a camera opened with nativeOpenCamera to a
+ * per-tracker thread that does what DesktopHandTracker's capture loop does
+ * in Kotlin: read a frame, fill the preview the callback supplies (or a
+ * private scratch surface without one), crop/letterbox the inference frame
+ * from it and submit — detectAsync for landmarkers, the gesture worker's
+ * mailbox for recognizers.  Timestamps are frame sequence numbers.
+ * ======================================================================== */
+
+/* Give up after this many consecutive failed reads (~1 s at 30 fps). */
+#define CAPTURE_MAX_READ_FAILURES 30
+
+struct CaptureThread {
+    std::thread thread;
+    std::atomic<bool> stop;
+    NativeCapture* camera;
+    bool mirror;
+    jobject callback;                  /* MediaPipeJni$CaptureCallback */
+    std::vector<uint8_t> scratch;      /* BGRA frame when no preview is taken */
+    std::vector<uint8_t> rgb;          /* inference frame, full square */
+};
+
+/* Preview target for this frame: the callback's direct buffer if it gives
+ * one large enough, else nullptr.  The local ref is freed with the frame. */
+static uint8_t* capture_preview_target(JNIEnv* env, CaptureThread* c, int width, int height) {
+    jobject buffer = env->CallObjectMethod(c->callback, g_jni.capture_preview_buffer,
+                                           (jint)width, (jint)height);
+    if (env->ExceptionCheck()) {
+        clear_callback_exception(env);
+        return nullptr;
+    }
+    if (buffer == nullptr) return nullptr;
+    void* address = env->GetDirectBufferAddress(buffer);
+    if (address == nullptr ||
+        env->GetDirectBufferCapacity(buffer) < (jlong)width * height * 4) {
+        return nullptr;
+    }
+    return static_cast<uint8_t*>(address);
+}
+
+static void capture_loop(Tracker* t) {
+    CaptureThread* c = t->capture;
+    JNIEnv* env = attached_env();
+    if (!env) return;
+
+    int width, height;
+    native_capture_size(c->camera, &width, &height);
+    int size = frame_square_size(width, height);
+    c->rgb.resize((size_t)size * size * 3);
+
+    /* Continue the tracker's timestamps: it may have run sessions before. */
+    int64_t timestamp_ms = tracker_next_timestamp(t);
+    int failures = 0;
+    while (!c->stop.load(std::memory_order_acquire)) {
+        const uint8_t* bgr = nullptr;
+        int stride = 0;
+        if (!native_capture_read(c->camera, &bgr, &stride)) {
+            if (++failures < CAPTURE_MAX_READ_FAILURES) continue;
+            jstring reason = env->NewStringUTF("camera stopped delivering frames");
+            env->CallVoidMethod(c->callback, g_jni.capture_on_stopped, reason);
+            env->DeleteLocalRef(reason);
+            clear_callback_exception(env);
+            return;
+        }
+        failures = 0;
+
+        if (env->PushLocalFrame(8) != JNI_OK) continue;
+        uint8_t* preview = capture_preview_target(env, c, width, height);
+        uint8_t* bgra = preview;
+        if (bgra == nullptr) {
+            c->scratch.resize((size_t)width * height * 4);
+            bgra = c->scratch.data();
+        }
+        frame_bgr_to_bgra(bgr, width, height, stride, c->mirror, bgra);
+        int out_size = preprocess_roi(t, reinterpret_cast<const uint32_t*>(bgra), width, height,
+                                      width, false, false, c->rgb.data(), timestamp_ms);
+
+        if (t->kind == TRACKER_LANDMARKER) {
+            hl_detect_async(t, c->rgb.data(), out_size, out_size, timestamp_ms);
+        } else {
+            gr_worker_submit(t, c->rgb.data(), out_size, out_size, timestamp_ms);
+        }
+        if (preview != nullptr) {
+            env->CallVoidMethod(c->callback, g_jni.capture_on_preview,
+                                (jint)width, (jint)height, (jlong)timestamp_ms);
+            clear_callback_exception(env);
+        }
+        env->PopLocalFrame(nullptr);
+        timestamp_ms++;
+    }
+}
+
+/* Stop and join the capture thread and close its camera.  Must not run on
+ * the capture thread (i.e. not from a CaptureCallback). */
+static void capture_stop(JNIEnv* env, Tracker* t) {
+    CaptureThread* c = t->capture;
+    if (c == nullptr) return;
+    c->stop.store(true, std::memory_order_release);
+    c->thread.join();
+    native_capture_close(c->camera);
+    env->DeleteGlobalRef(c->callback);
+    delete c;
+    t->capture = nullptr;
+}
+
+/* --- Warm-up thread --- */
+
+/* One warm-up frame through every graph of t.  Entered with w->mutex held
+ * through `lock`.  Returns false if a graph failed (the warm-up stops). */
+static bool warmup_frame(Tracker* t, WarmUp* w, int64_t timestamp_ms,
+                         std::unique_lock<std::mutex>* lock) {
+    if (t->kind == TRACKER_GESTURE_RECOGNIZER) {
+        char error[512];
+        const PooledImage* image = image_pool_stage(t->images, w->rgb.data(), w->width, w->height);
+        if (image == nullptr) return false;
+        GestureRecognizerResult result;
+        bool ok = pooled_recognizer_recognize(t->recognizer, image, timestamp_ms, &result,
+                                              error, sizeof(error));
+        std::lock_guard<std::mutex> schedule(t->schedule_mutex);
+        if (ok && t->tracking != nullptr) {
+            HandLandmarkerResult landmarks;
+            ok = pooled_landmarker_detect(t->tracking, image, timestamp_ms, &landmarks,
+                                          error, sizeof(error));
+        }
+        if (!ok) bridge_log("[JNI] warm-up err: %s\n", error);
+        return ok;
+    }
+
+    int dataSize = w->width * w->height * 3;
+    MpImagePtr image = nullptr;
+    char* error_msg = nullptr;
+    MpStatus status = MpImageCreateFromUint8Data(kMpImageFormatSrgb, w->width, w->height,
+                                                 w->rgb.data(), dataSize, &image, &error_msg);
+    if (status == kMpOk) {
+        status = MpHandLandmarkerDetectAsync(t->landmarker, image, nullptr, timestamp_ms,
+                                             &error_msg);
+        if (status != kMpOk) MpImageFree(image);
+    }
+    if (status != kMpOk) {
+        bridge_log("[JNI] warm-up err: %s\n", error_msg ? error_msg : "?");
+        if (error_msg) free(error_msg);
+        return false;
+    }
+    /* Pace by results so every frame is run rather than queued. */
+    return w->cv.wait_for(
+        *lock, std::chrono::milliseconds(WARMUP_RESULT_TIMEOUT_MS), [w, timestamp_ms] {
+            return w->completed_ts >= timestamp_ms || w->abort.load();
+        });
+}
+
+static void warmup_loop(Tracker* t) {
+    WarmUp* w = t->warmup.load();
+    for (int i = 0; i < w->iterations; i++) {
+        std::unique_lock<std::mutex> lock(w->mutex);
+        if (w->abort.load(std::memory_order_acquire) || t->last_frame_ts.load() != INT64_MIN) {
+            break;
+        }
+        if (!warmup_frame(t, w, (int64_t)(i - w->iterations), &lock)) break;
+    }
+    w->running.store(false, std::memory_order_release);
+}
+
+/* Abort and join a warm-up, if one was started.  Call once nothing can
+ * submit frames to t any more (capture and gesture worker stopped).  The
+ * WarmUp itself lives until tracker_free: a landmarker's late warm-up
+ * results still reach warmup_on_result until the graph is closed. */
+static void warmup_stop(Tracker* t) {
+    WarmUp* w = t->warmup.load();
+    if (w == nullptr || !w->thread.joinable()) return;
+    w->abort.store(true, std::memory_order_release);
+    {
+        std::lock_guard<std::mutex> lock(w->mutex);
+    }
+    w->cv.notify_all();
+    w->thread.join();
+}
+
+/* Forget what the tracker learned from the previous session's frames:
+ * the ROI window, smoothing and prediction history and the gesture
+ * schedule's kept labels.  The graphs themselves keep running. */
+static void tracker_reset_session(Tracker* t) {
+    {
+        std::lock_guard<std::mutex> lock(t->roi.mutex);
+        t->roi.valid = false;
+        t->roi.tracked_hands = 0;
+        t->roi.frames_since_full = 0;
+        for (int i = 0; i < ROI_HISTORY; i++) t->roi.history_used[i] = false;
+    }
+    {
+        std::lock_guard<std::mutex> lock(t->filter_mutex);
+        for (int h = 0; h < LANDMARK_FILTER_MAX_HANDS; h++) landmark_filter_forget(&t->filter, h);
+    }
+    {
+        std::lock_guard<std::mutex> lock(t->predictor_mutex);
+        for (int h = 0; h < LANDMARK_FILTER_MAX_HANDS; h++) {
+            landmark_predictor_forget(&t->predictor, h);
+        }
+    }
+    {
+        std::lock_guard<std::mutex> lock(t->schedule_mutex);
+        gesture_schedule_invalidate(&t->schedule);
+    }
+}
+
+/* ========================================================================
+ * JNI exports
+ * ======================================================================== */
+
+extern "C" {
+
+JNIEXPORT jint JNICALL JNI_OnLoad(JavaVM* vm, void* reserved) {
+    g_jni.jvm = vm;
+
+    JNIEnv* env = nullptr;
+    if (vm->GetEnv(reinterpret_cast<void**>(&env), JNI_VERSION_1_6) != JNI_OK) {
+        return JNI_ERR;
+    }
+    if (!jni_context_init(env)) {
+        /* Leaves the NoClassDefFoundError/NoSuchMethodError pending so
+         * System.load reports which lookup failed. */
+        jni_context_release(env);
+        return JNI_ERR;
+    }
+    return JNI_VERSION_1_6;
+}
+
+JNIEXPORT void JNICALL JNI_OnUnload(JavaVM* vm, void* reserved) {
+    JNIEnv* env = nullptr;
+    if (vm->GetEnv(reinterpret_cast<void**>(&env), JNI_VERSION_1_6) != JNI_OK) return;
+    jni_context_release(env);
+    g_jni.jvm = nullptr;
+}
+
+/* JNI surface version: bump with every added, removed or re-signatured
+ * native so MediaPipeJni.initialize() can refuse a library built from
+ * older sources instead of failing at its first missing native. */
+#define BRIDGE_VERSION 1
+
+JNIEXPORT jint JNICALL
+Java_org_balch_orpheus_core_mediapipe_MediaPipeJni_nativeBridgeVersion(JNIEnv* env, jclass cls) {
+    return BRIDGE_VERSION;
+}
+
+/* --- Hand Landmarker --- */
+
+JNIEXPORT jlong JNICALL
+Java_org_balch_orpheus_core_mediapipe_MediaPipeJni_nativeCreateLandmarker(
+    JNIEnv* env, jclass cls, jstring modelPath, jobject modelBuffer, jint numHands,
+    jfloat detectionConfidence, jfloat presenceConfidence, jfloat trackingConfidence,
+    jint delegate, jint captureWidth, jint captureHeight, jboolean mirrored,
+    jobject callback) {
+
+    TrackerOptions opts = tracker_options(numHands, detectionConfidence, presenceConfidence,
+                                          trackingConfidence, delegate);
+    if (opts.delegate == DELEGATE_GPU) {
+        bridge_log("[MediaPipe JNI] LIVE_STREAM HandLandmarker has no GPU delegate, using CPU\n");
+        opts.delegate = DELEGATE_CPU;
+    }
+    Tracker* t = new Tracker();
+    t->kind = TRACKER_LANDMARKER;
+    t->num_hands = opts.num_hands;
+    t->options = opts;
+    landmark_predictor_init(&t->predictor, PREDICT_MAX_HORIZON_NS);
+    hand_snapshot_init(&t->latest, RING_SLOT_FLOATS);
+    t->geometry = capture_geometry(captureWidth, captureHeight, mirrored);
+    t->flow.last_submitted_ts = INT64_MIN;
+    t->last_frame_ts.store(INT64_MIN);
+    /* callback may be null when results go to a result ring (nativeSetResultRing). */
+    if (callback != nullptr) t->callback = env->NewGlobalRef(callback);
+
+    t->callback_slot = hl_claim_slot(t);
+    if (t->callback_slot < 0) {
+        tracker_free(env, t);
+        throw_exception(env, "too many live HandLandmarker instances");
+        return 0;
+    }
+
+    struct HandLandmarkerOptions options;
+    memset(&options, 0, sizeof(options));
+    ModelAsset model;
+    if (!model_asset_acquire(env, modelPath, modelBuffer, &options.base_options, &model)) {
+        hl_release_slot(t->callback_slot);
+        tracker_free(env, t);
+        return 0;
+    }
+    options.running_mode = LIVE_STREAM;
+    apply_tracker_options(opts, &options);
+    options.result_callback = kHlTrampolines[t->callback_slot];
+
+    MpHandLandmarkerPtr landmarker = nullptr;
+    char* error_msg = nullptr;
+    MpStatus status = MpHandLandmarkerCreate(&options, &landmarker, &error_msg);
+
+    model_asset_release(env, &model);
+
+    if (status != kMpOk) {
+        char buf[512];
+        snprintf(buf, sizeof(buf), "MpHandLandmarkerCreate failed: %s",
+                 error_msg ? error_msg : "unknown error");
+        if (error_msg) free(error_msg);
+        hl_release_slot(t->callback_slot);
+        tracker_free(env, t);
+        throw_exception(env, buf);
+        return 0;
+    }
+
+    t->landmarker = landmarker;
+    return reinterpret_cast<jlong>(t);
+}
+
+JNIEXPORT void JNICALL
+Java_org_balch_orpheus_core_mediapipe_MediaPipeJni_nativeDetectAsync(
+    JNIEnv* env, jclass cls, jlong landmarkerPtr,
+    jbyteArray pixelData, jint width, jint height, jlong timestampMs) {
+
+    Tracker* t = tracker_from_handle(landmarkerPtr);
+
+    jbyte* pixels = env->GetByteArrayElements(pixelData, nullptr);
+    hl_detect_async(t, reinterpret_cast<const uint8_t*>(pixels),
+                    width, height, timestampMs);
+    env->ReleaseByteArrayElements(pixelData, pixels, JNI_ABORT);
+}
+
+/* Direct ByteBuffer variant: reads the caller-owned frame in place, so the
+ * only copy left is the one MpImageCreateFromUint8Data makes into the
+ * graph-owned ImageFrame (required in LIVE_STREAM, since the graph keeps
+ * the image after this call returns and the caller reuses its buffer). */
+JNIEXPORT void JNICALL
+Java_org_balch_orpheus_core_mediapipe_MediaPipeJni_nativeDetectAsyncBuffer(
+    JNIEnv* env, jclass cls, jlong landmarkerPtr,
+    jobject pixelBuffer, jint width, jint height, jlong timestampMs) {
+
+    Tracker* t = tracker_from_handle(landmarkerPtr);
+
+    const uint8_t* pixels = direct_rgb_address(env, pixelBuffer, width, height);
+    if (pixels == nullptr) return;
+    hl_detect_async(t, pixels, width, height, timestampMs);
+}
+
+JNIEXPORT void JNICALL
+Java_org_balch_orpheus_core_mediapipe_MediaPipeJni_nativeCloseLandmarker(
+    JNIEnv* env, jclass cls, jlong landmarkerPtr) {
+
+    Tracker* t = tracker_from_handle(landmarkerPtr);
+    capture_stop(env, t);
+    warmup_stop(t);
+    {
+        std::lock_guard<std::mutex> lock(t->flow.mutex);
+        t->flow.closing = true;
+    }
+    char* error_msg = nullptr;
+    /* Close drains the graph — no callback runs for t after this returns. */
+    MpHandLandmarkerClose(t->landmarker, &error_msg);
+    if (error_msg) free(error_msg);
+    if (t->flow.staged != nullptr) MpImageFree(t->flow.staged);
 
-/* --- Hand Landmarker state --- */
-static jobject g_hl_callback = nullptr;
-static jmethodID g_hl_onResult = nullptr;
+    hl_release_slot(t->callback_slot);
+    tracker_free(env, t);
+}
 
-/* --- Gesture Recognizer state --- */
-static jobject g_gr_callback = nullptr;
-static jmethodID g_gr_onResult = nullptr;  /* onResult(float[], String[], long) */
+/* Configure the in-flight limit of a landmarker.  maxInFlight 0 disables
+ * it (every frame is submitted); otherwise it is clamped to
+ * FLOW_MAX_IN_FLIGHT.  policy is FLOW_DROP_NEWEST or FLOW_DROP_OLDEST. */
+JNIEXPORT void JNICALL
+Java_org_balch_orpheus_core_mediapipe_MediaPipeJni_nativeSetFlowControl(
+    JNIEnv* env, jclass cls, jlong landmarkerPtr, jint maxInFlight, jint policy) {
+
+    Tracker* t = tracker_from_handle(landmarkerPtr);
+    FlowControl* flow = &t->flow;
+    std::lock_guard<std::mutex> lock(flow->mutex);
+
+    int limit = maxInFlight < 0 ? 0 : maxInFlight;
+    if (limit > FLOW_MAX_IN_FLIGHT) limit = FLOW_MAX_IN_FLIGHT;
+    flow->max_in_flight = limit;
+    flow->policy = policy == FLOW_DROP_OLDEST ? FLOW_DROP_OLDEST : FLOW_DROP_NEWEST;
+    /* Outstanding frames submitted while unlimited are not tracked. */
+    flow->in_flight = 0;
+    if (flow->policy != FLOW_DROP_OLDEST && flow->staged != nullptr) {
+        MpImageFree(flow->staged);
+        flow->staged = nullptr;
+        flow_drop(flow);
+    }
+}
 
-/* Helper: pack a GestureRecognizerResult into the JNI float array format and
- * call the Java callback.  Used by the VIDEO-mode synchronous path. */
-static void gr_deliver_result(JNIEnv* env, const GestureRecognizerResult* result,
-                              int64_t timestamp_ms);
+/* Total frames dropped by the in-flight limit or skipped by the graph. */
+JNIEXPORT jlong JNICALL
+Java_org_balch_orpheus_core_mediapipe_MediaPipeJni_nativeGetDroppedFrames(
+    JNIEnv* env, jclass cls, jlong landmarkerPtr) {
 
-static void throw_exception(JNIEnv* env, const char* msg) {
-    jclass cls = env->FindClass("java/lang/RuntimeException");
-    env->ThrowNew(cls, msg);
+    Tracker* t = tracker_from_handle(landmarkerPtr);
+    std::lock_guard<std::mutex> lock(t->flow.mutex);
+    return static_cast<jlong>(t->flow.dropped);
 }
 
-/* Helper: attach to JVM if needed, returns env and sets needs_detach flag */
-static JNIEnv* attach_jvm(int* needs_detach) {
-    *needs_detach = 0;
-    JNIEnv* env = nullptr;
-    jint result = g_jvm->GetEnv(reinterpret_cast<void**>(&env), JNI_VERSION_1_6);
-    if (result == JNI_EDETACHED) {
-        if (g_jvm->AttachCurrentThread(reinterpret_cast<void**>(&env), nullptr) != 0) {
-            return nullptr;
-        }
-        *needs_detach = 1;
-    } else if (result != JNI_OK) {
-        return nullptr;
+/* --- Instrumentation --- */
+
+/* Packed stats snapshot:
+ *   [STATS_VERSION, STAGE_COUNT, STATS_STAGE_FIELDS,
+ *    per-stage(count, meanNs, p50Ns, p95Ns, p99Ns, maxNs),
+ *    framesSubmitted, resultsDelivered, framesDropped, gesturesFull, gesturesTracked]
+ * Stage order follows StatsStage.  Percentiles are bucket lower bounds. */
+JNIEXPORT jlongArray JNICALL
+Java_org_balch_orpheus_core_mediapipe_MediaPipeJni_nativeGetStats(
+    JNIEnv* env, jclass cls) {
+
+    jlong packed[3 + STAGE_COUNT * STATS_STAGE_FIELDS + 5];
+    packed[0] = STATS_VERSION;
+    packed[1] = STAGE_COUNT;
+    packed[2] = STATS_STAGE_FIELDS;
+    for (int s = 0; s < STAGE_COUNT; s++) {
+        stats_summarize(&g_stats.stages[s], packed + 3 + s * STATS_STAGE_FIELDS);
     }
-    return env;
+    jlong* counters = packed + 3 + STAGE_COUNT * STATS_STAGE_FIELDS;
+    counters[0] = (jlong)g_stats.frames_submitted.load(std::memory_order_relaxed);
+    counters[1] = (jlong)g_stats.results_delivered.load(std::memory_order_relaxed);
+    counters[2] = (jlong)g_stats.frames_dropped.load(std::memory_order_relaxed);
+    counters[3] = (jlong)g_stats.gestures_full.load(std::memory_order_relaxed);
+    counters[4] = (jlong)g_stats.gestures_tracked.load(std::memory_order_relaxed);
+
+    jsize length = (jsize)(sizeof(packed) / sizeof(packed[0]));
+    jlongArray result = env->NewLongArray(length);
+    if (result != nullptr) env->SetLongArrayRegion(result, 0, length, packed);
+    return result;
 }
 
-/* ========================================================================
- * Hand Landmarker
- * ======================================================================== */
-
-static void hl_on_result(MpStatus status, const HandLandmarkerResult* result,
-                         MpImagePtr image, int64_t timestamp_ms) {
-    if (g_jvm == nullptr || g_hl_callback == nullptr) return;
-
-    int needs_detach = 0;
-    JNIEnv* env = attach_jvm(&needs_detach);
-    if (!env) return;
+JNIEXPORT void JNICALL
+Java_org_balch_orpheus_core_mediapipe_MediaPipeJni_nativeResetStats(
+    JNIEnv* env, jclass cls) {
+    stats_reset();
+}
 
-    jfloatArray jResult = nullptr;
+/* --- Result ring --- */
 
-    if (status == kMpOk && result != nullptr && result->hand_landmarks_count > 0) {
-        int numHands = (int)result->hand_landmarks_count;
-        if (numHands > 2) numHands = 2;
+/* Register (or, with a null buffer, clear) the result ring of one tracker.
+ * Must be called before the first frame is submitted to that tracker.
+ * ringBuffer must be a direct buffer of at least slotCount * slotFloats
+ * floats in native byte order. */
+JNIEXPORT void JNICALL
+Java_org_balch_orpheus_core_mediapipe_MediaPipeJni_nativeSetResultRing(
+    JNIEnv* env, jclass cls, jlong trackerPtr, jobject ringBuffer, jint slotCount,
+    jint slotFloats, jobject callback) {
 
-        int arraySize = 1 + numHands * 64;
-        jResult = env->NewFloatArray(arraySize);
-        jfloat* buf = env->GetFloatArrayElements(jResult, nullptr);
+    Tracker* t = tracker_from_handle(trackerPtr);
+    ring_clear(env, &t->ring);
+    if (ringBuffer == nullptr) return;
 
-        buf[0] = (float)numHands;
+    if (slotFloats != RING_SLOT_FLOATS || slotCount <= 0) {
+        throw_exception(env, "result ring slot layout mismatch");
+        return;
+    }
+    void* address = env->GetDirectBufferAddress(ringBuffer);
+    if (address == nullptr ||
+        env->GetDirectBufferCapacity(ringBuffer) < (jlong)slotCount * slotFloats * 4) {
+        throw_exception(env, "result ring must be a direct buffer of slotCount*slotFloats floats");
+        return;
+    }
 
-        for (int h = 0; h < numHands; h++) {
-            int base = 1 + h * 64;
+    t->ring.buffer = env->NewGlobalRef(ringBuffer);
+    t->ring.callback = env->NewGlobalRef(callback);
+    t->ring.slot_count = (int)slotCount;
+    t->ring.base = static_cast<float*>(address);
+}
 
-            float handednessValue = 0.0f;
-            if (h < (int)result->handedness_count &&
-                result->handedness[h].categories_count > 0) {
-                const char* name = result->handedness[h].categories[0].category_name;
-                if (name && name[0] == 'R') {
-                    handednessValue = 1.0f;
-                }
-            }
-            buf[base] = handednessValue;
+/* --- Native capture --- */
 
-            struct NormalizedLandmarks* lms = &result->hand_landmarks[h];
-            for (unsigned int i = 0; i < lms->landmarks_count && i < 21; i++) {
-                buf[base + 1 + i * 3]     = lms->landmarks[i].x;
-                buf[base + 1 + i * 3 + 1] = lms->landmarks[i].y;
-                buf[base + 1 + i * 3 + 2] = lms->landmarks[i].z;
-            }
-        }
+/* Open camera deviceIndex at (about) width x height and fps.  Writes the
+ * delivered size into sizeOut[0..1] and returns an opaque camera handle
+ * for nativeStartCapture or nativeCloseCamera; throws on failure. */
+JNIEXPORT jlong JNICALL
+Java_org_balch_orpheus_core_mediapipe_MediaPipeJni_nativeOpenCamera(
+    JNIEnv* env, jclass cls, jint deviceIndex, jint width, jint height, jint fps,
+    jintArray sizeOut) {
 
-        env->ReleaseFloatArrayElements(jResult, buf, 0);
+    if (sizeOut == nullptr || env->GetArrayLength(sizeOut) < 2) {
+        throw_exception(env, "sizeOut must hold 2 ints");
+        return 0;
     }
+    char error[256];
+    NativeCapture* camera = native_capture_open((int)deviceIndex, (int)width, (int)height,
+                                                (double)fps, error, sizeof(error));
+    if (camera == nullptr) {
+        throw_exception(env, error);
+        return 0;
+    }
+    jint size[2];
+    native_capture_size(camera, &size[0], &size[1]);
+    env->SetIntArrayRegion(sizeOut, 0, 2, size);
+    return reinterpret_cast<jlong>(camera);
+}
 
-    env->CallVoidMethod(g_hl_callback, g_hl_onResult,
-                        jResult, static_cast<jlong>(timestamp_ms));
-
-    if (jResult != nullptr) env->DeleteLocalRef(jResult);
-    if (needs_detach) g_jvm->DetachCurrentThread();
+/* Close a camera that was never passed to nativeStartCapture. */
+JNIEXPORT void JNICALL
+Java_org_balch_orpheus_core_mediapipe_MediaPipeJni_nativeCloseCamera(
+    JNIEnv* env, jclass cls, jlong cameraPtr) {
+    native_capture_close(reinterpret_cast<NativeCapture*>(cameraPtr));
 }
 
-/* ========================================================================
- * Gesture Recognizer
- * ======================================================================== */
+/* Start feeding the tracker from cameraPtr on a native thread.  The
+ * tracker takes ownership of the camera; closing the tracker (or
+ * nativeStopCapture) stops the thread and closes it.  Don't also submit
+ * frames from Java to the same tracker. */
+JNIEXPORT void JNICALL
+Java_org_balch_orpheus_core_mediapipe_MediaPipeJni_nativeStartCapture(
+    JNIEnv* env, jclass cls, jlong trackerPtr, jlong cameraPtr, jboolean mirror,
+    jobject callback) {
 
-/* Pack result into JNI float array + gesture name strings and call Java callback.
- * env must already be attached.
- *
- * Float array format (changed from original):
- *   [numHands, per-hand(handedness, gestureScore, 21*xyz)]
- *   Per hand: 1 + 1 + 63 = 65 floats
- *
- * Gesture names are passed as a separate String[] (one per hand), read
- * directly from category_name each frame. No name-table indirection. */
-static void gr_deliver_result(JNIEnv* env, const GestureRecognizerResult* result,
-                              int64_t timestamp_ms) {
-    jfloatArray jResult = nullptr;
-    jobjectArray jNames = nullptr;
+    Tracker* t = tracker_from_handle(trackerPtr);
+    if (t->capture != nullptr) {
+        throw_exception(env, "capture already running on this tracker");
+        return;
+    }
+    if (callback == nullptr) {
+        throw_exception(env, "capture callback must not be null");
+        return;
+    }
+    CaptureThread* c = new CaptureThread();
+    c->stop.store(false);
+    c->camera = reinterpret_cast<NativeCapture*>(cameraPtr);
+    c->mirror = mirror == JNI_TRUE;
+    c->callback = env->NewGlobalRef(callback);
+    t->capture = c;
+    c->thread = std::thread(capture_loop, t);
+}
 
-    if (result != nullptr && result->hand_landmarks_count > 0) {
-        int numHands = (int)result->hand_landmarks_count;
-        if (numHands > 2) numHands = 2;
+/* Stop the tracker's capture thread and close its camera, if running. */
+JNIEXPORT void JNICALL
+Java_org_balch_orpheus_core_mediapipe_MediaPipeJni_nativeStopCapture(
+    JNIEnv* env, jclass cls, jlong trackerPtr) {
+    capture_stop(env, tracker_from_handle(trackerPtr));
+}
 
-        int perHand = 65;
-        int arraySize = 1 + numHands * perHand;
+/* --- Warm-up and sessions --- */
 
-        jResult = env->NewFloatArray(arraySize);
-        jfloat* buf = env->GetFloatArrayElements(jResult, nullptr);
+/* Start warming up the tracker on a background thread with `iterations`
+ * frames (clamped to WARMUP_MAX_ITERATIONS): rgbFrame (packed RGB, width x
+ * height, in a direct buffer) if given, else a mid-gray square of the
+ * capture size.  Gray frames run palm detection and the graph plumbing
+ * only; a frame showing a hand also warms the landmark and gesture
+ * models.  Returns false, without warming up, once the tracker has seen a
+ * real frame or was already warmed up.  Closing the tracker aborts and
+ * joins the warm-up. */
+JNIEXPORT jboolean JNICALL
+Java_org_balch_orpheus_core_mediapipe_MediaPipeJni_nativeWarmUp(
+    JNIEnv* env, jclass cls, jlong trackerPtr, jint iterations, jobject rgbFrame,
+    jint width, jint height) {
 
-        jclass stringClass = env->FindClass("java/lang/String");
-        jNames = env->NewObjectArray((jsize)numHands, stringClass, nullptr);
+    Tracker* t = tracker_from_handle(trackerPtr);
+    if (iterations < 1) {
+        throw_exception(env, "warm-up needs at least 1 iteration");
+        return JNI_FALSE;
+    }
+    if (t->warmup.load() != nullptr || t->last_frame_ts.load() != INT64_MIN) return JNI_FALSE;
+
+    WarmUp* w = new WarmUp();
+    w->abort.store(false);
+    w->running.store(true);
+    w->completed_ts = INT64_MIN;
+    w->iterations = iterations < WARMUP_MAX_ITERATIONS ? (int)iterations : WARMUP_MAX_ITERATIONS;
+    if (rgbFrame != nullptr) {
+        const uint8_t* pixels = direct_rgb_address(env, rgbFrame, width, height);
+        if (pixels == nullptr) {
+            delete w;
+            return JNI_FALSE;
+        }
+        w->width = (int)width;
+        w->height = (int)height;
+        w->rgb.assign(pixels, pixels + (size_t)width * height * 3);
+    } else {
+        int size = t->geometry.width > 0
+            ? frame_square_size(t->geometry.width, t->geometry.height) : ROI_OUTPUT_SIZE;
+        w->width = size;
+        w->height = size;
+        w->rgb.assign((size_t)size * size * 3, WARMUP_GRAY);
+    }
+    t->warmup.store(w);
+    w->thread = std::thread(warmup_loop, t);
+    return JNI_TRUE;
+}
 
-        buf[0] = (float)numHands;
+/* Prepare a kept-alive tracker for a new camera session: forgets the ROI,
+ * smoothing, prediction and gesture-schedule state of the previous one
+ * and returns the first timestamp the session may submit (every graph
+ * needs timestamps to keep increasing over its lifetime).  Call with no
+ * frames in flight, i.e. after nativeStopCapture. */
+JNIEXPORT jlong JNICALL
+Java_org_balch_orpheus_core_mediapipe_MediaPipeJni_nativeResetSession(
+    JNIEnv* env, jclass cls, jlong trackerPtr) {
 
-        for (int h = 0; h < numHands; h++) {
-            int base = 1 + h * perHand;
+    Tracker* t = tracker_from_handle(trackerPtr);
+    tracker_reset_session(t);
+    return static_cast<jlong>(tracker_next_timestamp(t));
+}
 
-            float handednessValue = 0.0f;
-            if (h < (int)result->handedness_count &&
-                result->handedness[h].categories_count > 0) {
-                const char* name = result->handedness[h].categories[0].category_name;
-                if (name && name[0] == 'R') {
-                    handednessValue = 1.0f;
-                }
-            }
-            buf[base] = handednessValue;
+/* --- Delegate --- */
 
-            float gestureScore = 0.0f;
-            const char* gestureName = nullptr;
-            if (h < (int)result->gestures_count &&
-                result->gestures[h].categories_count > 0) {
-                gestureName = result->gestures[h].categories[0].category_name;
-                gestureScore = result->gestures[h].categories[0].score;
-            }
-            buf[base + 1] = gestureScore;
+/* Delegate the tracker's inference runs on: 0 = CPU, 1 = GPU.  May differ
+ * from the requested one (see "Model options" above). */
+JNIEXPORT jint JNICALL
+Java_org_balch_orpheus_core_mediapipe_MediaPipeJni_nativeGetDelegate(
+    JNIEnv* env, jclass cls, jlong trackerPtr) {
+    return static_cast<jint>(tracker_from_handle(trackerPtr)->options.delegate);
+}
 
-            // Pass gesture name string directly — no index indirection
-            if (gestureName != nullptr) {
-                jstring jname = env->NewStringUTF(gestureName);
-                env->SetObjectArrayElement(jNames, (jsize)h, jname);
-                env->DeleteLocalRef(jname);
-            }
+/* --- Result log --- */
 
-            struct NormalizedLandmarks* lms = &result->hand_landmarks[h];
-            for (unsigned int i = 0; i < lms->landmarks_count && i < 21; i++) {
-                buf[base + 2 + i * 3]     = lms->landmarks[i].x;
-                buf[base + 2 + i * 3 + 1] = lms->landmarks[i].y;
-                buf[base + 2 + i * 3 + 2] = lms->landmarks[i].z;
-            }
+/* Start logging every result of the tracker to a new file at path, with
+ * room for maxRecords results (later ones are dropped), or with a null
+ * path stop and close the current log.  Replaces any previous log. */
+JNIEXPORT void JNICALL
+Java_org_balch_orpheus_core_mediapipe_MediaPipeJni_nativeSetResultLog(
+    JNIEnv* env, jclass cls, jlong trackerPtr, jstring path, jint maxRecords) {
+
+    Tracker* t = tracker_from_handle(trackerPtr);
+    ResultLog* opened = nullptr;
+    if (path != nullptr) {
+        const char* file = env->GetStringUTFChars(path, nullptr);
+        char error[512];
+        opened = result_log_open(file, (int)maxRecords, error, sizeof(error));
+        env->ReleaseStringUTFChars(path, file);
+        if (opened == nullptr) {
+            throw_exception(env, error);
+            return;
         }
+    }
 
-        env->ReleaseFloatArrayElements(jResult, buf, 0);
+    ResultLog* previous;
+    {
+        std::lock_guard<std::mutex> lock(t->log_mutex);
+        previous = t->log;
+        t->log = opened;
     }
+    result_log_close(previous);
+}
 
-    env->CallVoidMethod(g_gr_callback, g_gr_onResult,
-                        jResult, jNames, static_cast<jlong>(timestamp_ms));
+/* --- Custom ASL classifier --- */
 
-    if (jResult != nullptr) env->DeleteLocalRef(jResult);
-    if (jNames != nullptr) env->DeleteLocalRef(jNames);
+/* Load (or, with a null path, unload) the tracker's custom ASL model.
+ * Replaces any previous model; takes effect from the next result. */
+JNIEXPORT void JNICALL
+Java_org_balch_orpheus_core_mediapipe_MediaPipeJni_nativeLoadAslClassifier(
+    JNIEnv* env, jclass cls, jlong trackerPtr, jstring modelPath) {
+
+    Tracker* t = tracker_from_handle(trackerPtr);
+    AslClassifier* loaded = nullptr;
+    if (modelPath != nullptr) {
+        const char* path = env->GetStringUTFChars(modelPath, nullptr);
+        char error[256];
+        loaded = asl_classifier_create(path, error, sizeof(error));
+        env->ReleaseStringUTFChars(modelPath, path);
+        if (loaded == nullptr) {
+            throw_exception(env, error);
+            return;
+        }
+    }
+
+    AslClassifier* previous;
+    {
+        std::lock_guard<std::mutex> lock(t->asl_mutex);
+        previous = t->asl;
+        t->asl = loaded;
+    }
+    if (previous != nullptr) asl_classifier_destroy(previous);
 }
 
-/* ========================================================================
- * JNI exports
- * ======================================================================== */
+/* --- Landmark smoothing --- */
 
-extern "C" {
+/* Enable (or, with enabled false, disable) One-Euro smoothing of one
+ * tracker's landmarks.  Cutoffs are in Hz, beta per normalized unit/s.
+ * Changing the parameters restarts the filter from the next result. */
+JNIEXPORT void JNICALL
+Java_org_balch_orpheus_core_mediapipe_MediaPipeJni_nativeSetLandmarkSmoothing(
+    JNIEnv* env, jclass cls, jlong trackerPtr, jboolean enabled, jfloat minCutoff,
+    jfloat beta, jfloat derivativeCutoff) {
 
-JNIEXPORT jint JNICALL JNI_OnLoad(JavaVM* vm, void* reserved) {
-    g_jvm = vm;
-    return JNI_VERSION_1_6;
+    if (enabled == JNI_TRUE && (minCutoff <= 0.0f || beta < 0.0f || derivativeCutoff <= 0.0f)) {
+        throw_exception(env, "smoothing cutoffs must be positive and beta non-negative");
+        return;
+    }
+    Tracker* t = tracker_from_handle(trackerPtr);
+    std::lock_guard<std::mutex> lock(t->filter_mutex);
+    LandmarkFilterParams params = {minCutoff, beta, derivativeCutoff};
+    landmark_filter_init(&t->filter, params);
+    t->filter_enabled = enabled == JNI_TRUE;
 }
 
-/* --- Hand Landmarker --- */
+/* --- Latest snapshot --- */
 
+/* Copy the tracker's newest result, in ring slot format, into the direct
+ * FloatBuffer out (at least one slot of floats, native order).  Lock-free
+ * and allocation-free; safe from realtime threads.  Returns the result's
+ * number (from 1), 0 before the first result, or -1 (out untouched) if a
+ * result was being published throughout the read. */
 JNIEXPORT jlong JNICALL
-Java_org_balch_orpheus_core_mediapipe_MediaPipeJni_nativeCreateLandmarker(
-    JNIEnv* env, jclass cls, jstring modelPath, jobject callback) {
+Java_org_balch_orpheus_core_mediapipe_MediaPipeJni_nativeReadLatest(
+    JNIEnv* env, jclass cls, jlong trackerPtr, jobject out) {
 
-    if (g_hl_callback != nullptr) {
-        env->DeleteGlobalRef(g_hl_callback);
-    }
-    g_hl_callback = env->NewGlobalRef(callback);
-
-    jclass callbackClass = env->GetObjectClass(callback);
-    g_hl_onResult = env->GetMethodID(callbackClass, "onResult", "([FJ)V");
-    if (g_hl_onResult == nullptr) {
-        throw_exception(env, "ResultCallback.onResult([FJ)V method not found");
+    float* dst = out != nullptr ? static_cast<float*>(env->GetDirectBufferAddress(out)) : nullptr;
+    if (dst == nullptr || env->GetDirectBufferCapacity(out) < RING_SLOT_FLOATS) {
+        throw_exception(env, "out must be a direct FloatBuffer of at least one slot");
         return 0;
     }
+    return static_cast<jlong>(hand_snapshot_read(&tracker_from_handle(trackerPtr)->latest, dst));
+}
 
-    const char* model = env->GetStringUTFChars(modelPath, nullptr);
+/* Name behind a gesture ID in nativeReadLatest output, or null. */
+JNIEXPORT jstring JNICALL
+Java_org_balch_orpheus_core_mediapipe_MediaPipeJni_nativeLatestGestureName(
+    JNIEnv* env, jclass cls, jlong trackerPtr, jint id) {
 
-    struct HandLandmarkerOptions options;
-    memset(&options, 0, sizeof(options));
-    options.base_options.model_asset_path = model;
-    options.running_mode = LIVE_STREAM;
-    options.num_hands = 2;
-    options.min_hand_detection_confidence = 0.5f;
-    options.min_hand_presence_confidence = 0.5f;
-    options.min_tracking_confidence = 0.5f;
-    options.result_callback = hl_on_result;
+    const char* name = hand_snapshot_gesture_name(&tracker_from_handle(trackerPtr)->latest, (int)id);
+    return name != nullptr ? env->NewStringUTF(name) : nullptr;
+}
 
-    MpHandLandmarkerPtr landmarker = nullptr;
-    char* error_msg = nullptr;
-    MpStatus status = MpHandLandmarkerCreate(&options, &landmarker, &error_msg);
+/* --- Prediction --- */
 
-    env->ReleaseStringUTFChars(modelPath, model);
+/* now_ns() for callers of nativeSampleLandmarks. */
+JNIEXPORT jlong JNICALL
+Java_org_balch_orpheus_core_mediapipe_MediaPipeJni_nativeNanoTime(JNIEnv* env, jclass cls) {
+    return static_cast<jlong>(now_ns());
+}
 
-    if (status != kMpOk) {
-        char buf[512];
-        snprintf(buf, sizeof(buf), "MpHandLandmarkerCreate failed: %s",
-                 error_msg ? error_msg : "unknown error");
-        if (error_msg) free(error_msg);
-        throw_exception(env, buf);
+/* Landmarks of every tracked hand extrapolated to nowNanos, written into
+ * out as [numHands, per-hand(handedness, 21*xyz)].  out must hold
+ * 1 + 2 * 64 floats.  Returns the hand count. */
+JNIEXPORT jint JNICALL
+Java_org_balch_orpheus_core_mediapipe_MediaPipeJni_nativeSampleLandmarks(
+    JNIEnv* env, jclass cls, jlong trackerPtr, jlong nowNanos, jfloatArray out) {
+
+    const int sampleFloats = 1 + RING_MAX_HANDS * 64;
+    if (out == nullptr || env->GetArrayLength(out) < sampleFloats) {
+        throw_exception(env, "sample array must hold 1 + 2 * 64 floats");
         return 0;
     }
 
-    return reinterpret_cast<jlong>(landmarker);
+    Tracker* t = tracker_from_handle(trackerPtr);
+    float buf[1 + RING_MAX_HANDS * 64];
+    int numHands = 0;
+    {
+        std::lock_guard<std::mutex> lock(t->predictor_mutex);
+        for (int slot = 0; slot < RING_MAX_HANDS; slot++) {
+            float xyz[LANDMARK_FILTER_HAND_STRIDE];
+            if (!landmark_predictor_sample(&t->predictor, slot, (int64_t)nowNanos, xyz)) continue;
+            float* hand = buf + 1 + numHands * 64;
+            hand[0] = t->predictor.hands[slot].handedness;
+            memcpy(hand + 1, xyz, sizeof(float) * LANDMARK_FILTER_HAND_FLOATS);
+            numHands++;
+        }
+    }
+    buf[0] = (float)numHands;
+    env->SetFloatArrayRegion(out, 0, (jsize)(1 + numHands * 64), buf);
+    return numHands;
 }
 
-JNIEXPORT void JNICALL
-Java_org_balch_orpheus_core_mediapipe_MediaPipeJni_nativeDetectAsync(
-    JNIEnv* env, jclass cls, jlong landmarkerPtr,
-    jbyteArray pixelData, jint width, jint height, jlong timestampMs) {
+/* --- Frame preprocessing --- */
 
-    auto landmarker = reinterpret_cast<MpHandLandmarkerPtr>(landmarkerPtr);
+/* Mirror + letterbox + ARGB->RGB in one pass.  Reads the Java int[] in place
+ * (GetPrimitiveArrayCritical — no copy on HotSpot) and writes the square RGB
+ * frame into the caller's reused direct ByteBuffer.
+ * Returns the square side length, or 0 on error (exception thrown). */
+JNIEXPORT jint JNICALL
+Java_org_balch_orpheus_core_mediapipe_MediaPipeJni_nativePreprocessArgb(
+    JNIEnv* env, jclass cls, jintArray argbPixels, jint width, jint height,
+    jboolean mirror, jobject rgbOut) {
 
-    jbyte* pixels = env->GetByteArrayElements(pixelData, nullptr);
-    int dataSize = width * height * 3;
+    if (width <= 0 || height <= 0 ||
+        env->GetArrayLength(argbPixels) < width * height) {
+        throw_exception(env, "ARGB array smaller than width*height");
+        return 0;
+    }
 
-    MpImagePtr image = nullptr;
-    char* error_msg = nullptr;
-    MpStatus status = MpImageCreateFromUint8Data(
-        kMpImageFormatSrgb, width, height,
-        reinterpret_cast<const uint8_t*>(pixels), dataSize,
-        &image, &error_msg);
+    int size = frame_square_size(width, height);
+    uint8_t* dst = direct_rgb_address(env, rgbOut, size, size);
+    if (dst == nullptr) return 0;
 
-    env->ReleaseByteArrayElements(pixelData, pixels, JNI_ABORT);
+    void* src = env->GetPrimitiveArrayCritical(argbPixels, nullptr);
+    if (src == nullptr) return 0;
+    frame_argb_to_rgb_square(static_cast<const uint32_t*>(src), width, height,
+                             width, mirror == JNI_TRUE, dst);
+    env->ReleasePrimitiveArrayCritical(argbPixels, src, JNI_ABORT);
 
-    if (status != kMpOk) {
-        if (error_msg) free(error_msg);
-        return;
+    return size;
+}
+
+/* Tracker-aware variant of nativePreprocessArgb: crops the window planned
+ * from the tracker's previous result ("ROI tracking") and resamples it to
+ * ROI_OUTPUT_SIZE, or produces the full letterboxed square when there is
+ * no usable ROI.  The window is recorded under timestampMs — submit the
+ * frame with that same timestamp.  rgbOut must hold the full square.
+ * Returns the output side length, or 0 on error (exception thrown). */
+JNIEXPORT jint JNICALL
+Java_org_balch_orpheus_core_mediapipe_MediaPipeJni_nativePreprocessArgbRoi(
+    JNIEnv* env, jclass cls, jlong trackerPtr, jintArray argbPixels, jint width, jint height,
+    jboolean mirror, jobject rgbOut, jlong timestampMs) {
+
+    if (width <= 0 || height <= 0 ||
+        env->GetArrayLength(argbPixels) < width * height) {
+        throw_exception(env, "ARGB array smaller than width*height");
+        return 0;
     }
 
-    status = MpHandLandmarkerDetectAsync(landmarker, image, nullptr,
-                                          timestampMs, &error_msg);
+    Tracker* t = tracker_from_handle(trackerPtr);
+    int size = frame_square_size(width, height);
+    uint8_t* dst = direct_rgb_address(env, rgbOut, size, size);
+    if (dst == nullptr) return 0;
 
-    if (status != kMpOk) {
-        if (error_msg) free(error_msg);
-        MpImageFree(image);
+    void* src = env->GetPrimitiveArrayCritical(argbPixels, nullptr);
+    if (src == nullptr) return 0;
+    int out_size = preprocess_roi(t, static_cast<const uint32_t*>(src), width, height,
+                                  width, mirror == JNI_TRUE, false, dst, timestampMs);
+    env->ReleasePrimitiveArrayCritical(argbPixels, src, JNI_ABORT);
+
+    return out_size;
+}
+
+/* Camera-frame variant of nativePreprocessArgbRoi for packed BGR24 frames
+ * in a direct buffer (FFmpeg's output, srcStride bytes per row): one pass
+ * writes the (optionally mirrored) BGRA preview into previewOut, width *
+ * height * 4 bytes, and the inference input is then cropped or letterboxed
+ * from that preview into rgbOut, so neither needs a JVM-side image.
+ * Returns the output side length, or 0 on error (exception thrown). */
+JNIEXPORT jint JNICALL
+Java_org_balch_orpheus_core_mediapipe_MediaPipeJni_nativePreprocessBgrFrame(
+    JNIEnv* env, jclass cls, jlong trackerPtr, jobject bgrPixels, jint width, jint height,
+    jint srcStride, jboolean mirror, jobject previewOut, jobject rgbOut, jlong timestampMs) {
+
+    if (width <= 0 || height <= 0 || srcStride < width * 3) {
+        throw_exception(env, "BGR frame stride smaller than width*3");
+        return 0;
+    }
+    const uint8_t* src = static_cast<const uint8_t*>(env->GetDirectBufferAddress(bgrPixels));
+    if (src == nullptr ||
+        env->GetDirectBufferCapacity(bgrPixels) < (jlong)srcStride * (height - 1) + width * 3) {
+        throw_exception(env, "BGR frame must be a direct buffer of height rows of srcStride bytes");
+        return 0;
+    }
+    uint8_t* preview = static_cast<uint8_t*>(env->GetDirectBufferAddress(previewOut));
+    if (preview == nullptr ||
+        env->GetDirectBufferCapacity(previewOut) < (jlong)width * height * 4) {
+        throw_exception(env, "preview must be a direct buffer of width*height*4 bytes");
+        return 0;
     }
+
+    Tracker* t = tracker_from_handle(trackerPtr);
+    int size = frame_square_size(width, height);
+    uint8_t* dst = direct_rgb_address(env, rgbOut, size, size);
+    if (dst == nullptr) return 0;
+
+    frame_bgr_to_bgra(src, width, height, srcStride, mirror == JNI_TRUE, preview);
+    /* The preview is already mirrored and doubles as the ARGB source. */
+    return preprocess_roi(t, reinterpret_cast<const uint32_t*>(preview), width, height,
+                          width, false, false, dst, timestampMs);
 }
 
-JNIEXPORT void JNICALL
-Java_org_balch_orpheus_core_mediapipe_MediaPipeJni_nativeCloseLandmarker(
-    JNIEnv* env, jclass cls, jlong landmarkerPtr) {
+/* YUV 4:2:0 variant of nativePreprocessBgrFrame for cameras that deliver
+ * NV12 / NV21 / I420 (V4L2 and Media Foundation webcams, CameraX
+ * ImageProxy): the planes are read in place with their row strides and
+ * the chroma pixel stride (1 planar, 2 interleaved), converted to the BGRA
+ * preview in one native pass and cropped or letterboxed into rgbOut from
+ * there.  MediaPipe's CPU image path takes only SRGB(A), so YUV is not
+ * passed through.  previewRgba writes the preview in Android Bitmap byte
+ * order instead; the crop reads it in that order, so it is still one pass.
+ * Returns the output side length, or 0 on error (exception thrown). */
+JNIEXPORT jint JNICALL
+Java_org_balch_orpheus_core_mediapipe_MediaPipeJni_nativePreprocessYuvFrame(
+    JNIEnv* env, jclass cls, jlong trackerPtr, jobject yPlane, jint yRowStride,
+    jobject uPlane, jobject vPlane, jint uvRowStride, jint uvPixelStride,
+    jint width, jint height, jboolean mirror, jobject previewOut, jboolean previewRgba,
+    jobject rgbOut, jlong timestampMs) {
+
+    const int chroma_width = (width + 1) / 2;
+    const int chroma_height = (height + 1) / 2;
+    if (width <= 0 || height <= 0 || yRowStride < width || uvPixelStride < 1 ||
+        uvRowStride < (chroma_width - 1) * uvPixelStride + 1) {
+        throw_exception(env, "YUV frame strides smaller than its rows");
+        return 0;
+    }
+    const uint8_t* y = direct_plane_address(
+        env, yPlane, (jlong)yRowStride * (height - 1) + width, "Y");
+    if (y == nullptr) return 0;
+    const jlong chroma_bytes =
+        (jlong)uvRowStride * (chroma_height - 1) + (jlong)(chroma_width - 1) * uvPixelStride + 1;
+    const uint8_t* u = direct_plane_address(env, uPlane, chroma_bytes, "U");
+    if (u == nullptr) return 0;
+    const uint8_t* v = direct_plane_address(env, vPlane, chroma_bytes, "V");
+    if (v == nullptr) return 0;
+    uint8_t* preview = static_cast<uint8_t*>(env->GetDirectBufferAddress(previewOut));
+    if (preview == nullptr ||
+        env->GetDirectBufferCapacity(previewOut) < (jlong)width * height * 4) {
+        throw_exception(env, "preview must be a direct buffer of width*height*4 bytes");
+        return 0;
+    }
 
-    auto landmarker = reinterpret_cast<MpHandLandmarkerPtr>(landmarkerPtr);
-    char* error_msg = nullptr;
-    MpHandLandmarkerClose(landmarker, &error_msg);
-    if (error_msg) free(error_msg);
+    Tracker* t = tracker_from_handle(trackerPtr);
+    int size = frame_square_size(width, height);
+    uint8_t* dst = direct_rgb_address(env, rgbOut, size, size);
+    if (dst == nullptr) return 0;
+
+    const bool rgba = previewRgba == JNI_TRUE;
+    (rgba ? frame_yuv420_to_rgba : frame_yuv420_to_bgra)(
+        y, yRowStride, u, v, uvRowStride, uvPixelStride,
+        width, height, mirror == JNI_TRUE, preview);
+    /* The preview is already mirrored and doubles as the crop source. */
+    return preprocess_roi(t, reinterpret_cast<const uint32_t*>(preview), width, height,
+                          width, false, rgba, dst, timestampMs);
+}
 
-    if (g_hl_callback != nullptr) {
-        env->DeleteGlobalRef(g_hl_callback);
-        g_hl_callback = nullptr;
-        g_hl_onResult = nullptr;
+/* Native address of a direct buffer, for wrapping it in place (e.g. as a
+ * Skia surface).  Throws and returns 0 for heap buffers. */
+JNIEXPORT jlong JNICALL
+Java_org_balch_orpheus_core_mediapipe_MediaPipeJni_nativeDirectBufferAddress(
+    JNIEnv* env, jclass cls, jobject buffer) {
+    void* address = env->GetDirectBufferAddress(buffer);
+    if (address == nullptr) {
+        throw_exception(env, "buffer must be a direct ByteBuffer");
+        return 0;
     }
+    return reinterpret_cast<jlong>(address);
+}
+
+/* Instruction set the frame kernels dispatched to on this CPU. */
+JNIEXPORT jstring JNICALL
+Java_org_balch_orpheus_core_mediapipe_MediaPipeJni_nativeFrameKernelsIsa(JNIEnv* env, jclass cls) {
+    return env->NewStringUTF(frame_kernels_isa());
 }
 
 /* --- Gesture Recognizer --- */
 
 JNIEXPORT jlong JNICALL
 Java_org_balch_orpheus_core_mediapipe_MediaPipeJni_nativeCreateGestureRecognizer(
-    JNIEnv* env, jclass cls, jstring modelPath, jint numHands, jobject callback) {
-
-    if (g_gr_callback != nullptr) {
-        env->DeleteGlobalRef(g_gr_callback);
-    }
-    g_gr_callback = env->NewGlobalRef(callback);
-
-    jclass callbackClass = env->GetObjectClass(callback);
-    /* New signature: onResult(float[], String[], long) */
-    g_gr_onResult = env->GetMethodID(callbackClass, "onResult",
-                                     "([F[Ljava/lang/String;J)V");
-    if (g_gr_onResult == nullptr) {
-        throw_exception(env, "GestureCallback.onResult([F[Ljava/lang/String;J)V not found");
+    JNIEnv* env, jclass cls, jstring modelPath, jobject modelBuffer, jint numHands,
+    jfloat detectionConfidence, jfloat presenceConfidence, jfloat trackingConfidence,
+    jint delegate, jint captureWidth, jint captureHeight, jboolean mirrored,
+    jobject callback) {
+
+    TrackerOptions opts = tracker_options(numHands, detectionConfidence, presenceConfidence,
+                                          trackingConfidence, delegate);
+    Tracker* t = new Tracker();
+    t->kind = TRACKER_GESTURE_RECOGNIZER;
+    t->num_hands = opts.num_hands;
+    t->options = opts;
+    landmark_predictor_init(&t->predictor, PREDICT_MAX_HORIZON_NS);
+    hand_snapshot_init(&t->latest, RING_SLOT_FLOATS);
+    t->geometry = capture_geometry(captureWidth, captureHeight, mirrored);
+    t->callback_slot = -1;
+    t->last_frame_ts.store(INT64_MIN);
+    /* callback may be null when results go to a result ring (nativeSetResultRing). */
+    if (callback != nullptr) t->callback = env->NewGlobalRef(callback);
+
+    struct BaseOptions base;
+    memset(&base, 0, sizeof(base));
+    ModelAsset model;
+    if (!model_asset_acquire(env, modelPath, modelBuffer, &base, &model)) {
+        tracker_free(env, t);
         return 0;
     }
-
-    const char* model = env->GetStringUTFChars(modelPath, nullptr);
-
-    struct GestureRecognizerOptions options;
-    memset(&options, 0, sizeof(options));
-    options.base_options.model_asset_path = model;
-    // Use VIDEO mode (synchronous) instead of LIVE_STREAM (async) to avoid
-    // a crash in Holder<Eigen::Matrix>::~Holder() during ClearCurrentInputs.
+    // VIDEO mode (synchronous) instead of LIVE_STREAM (async) avoids a
+    // crash in Holder<Eigen::Matrix>::~Holder() during ClearCurrentInputs.
     // The GestureRecognizer graph uses LandmarksToMatrixCalculator which
     // creates intermediate Matrix packets that get double-freed in the async
     // callback flow. VIDEO mode processes synchronously, sidestepping this.
-    options.running_mode = VIDEO;
-    options.num_hands = (int)numHands;
-    options.min_hand_detection_confidence = 0.5f;
-    options.min_hand_presence_confidence = 0.5f;
-    options.min_tracking_confidence = 0.5f;
-    // No result_callback — VIDEO mode returns results synchronously.
-
-    MpGestureRecognizerPtr recognizer = nullptr;
-    char* error_msg = nullptr;
-    MpStatus status = MpGestureRecognizerCreate(&options, &recognizer, &error_msg);
+    // pooled_tasks always creates VIDEO-mode tasks.
+    char error[512];
+    PooledRecognizer* recognizer = create_pooled_task(
+        pooled_recognizer_create, "GestureRecognizer", &t->options, &base, error, sizeof(error));
 
-    env->ReleaseStringUTFChars(modelPath, model);
+    model_asset_release(env, &model);
 
-    if (status != kMpOk) {
-        char buf[512];
-        snprintf(buf, sizeof(buf), "MpGestureRecognizerCreate failed: %s",
-                 error_msg ? error_msg : "unknown error");
-        if (error_msg) free(error_msg);
-        throw_exception(env, buf);
+    if (recognizer == nullptr) {
+        tracker_free(env, t);
+        throw_exception(env, error);
         return 0;
     }
 
-    return reinterpret_cast<jlong>(recognizer);
+    t->images = image_pool_create();
+    t->recognizer = recognizer;
+    return reinterpret_cast<jlong>(t);
 }
 
 JNIEXPORT jboolean JNICALL
@@ -364,58 +2980,238 @@ Java_org_balch_orpheus_core_mediapipe_MediaPipeJni_nativeRecognizeGestureForVide
     JNIEnv* env, jclass cls, jlong recognizerPtr,
     jbyteArray pixelData, jint width, jint height, jlong timestampMs) {
 
-    auto recognizer = reinterpret_cast<MpGestureRecognizerPtr>(recognizerPtr);
+    Tracker* t = tracker_from_handle(recognizerPtr);
 
     jbyte* pixels = env->GetByteArrayElements(pixelData, nullptr);
-    int dataSize = width * height * 3;
+    bool ok = gr_recognize_for_video(env, t,
+                                     reinterpret_cast<const uint8_t*>(pixels),
+                                     width, height, timestampMs, now_ns(), nullptr);
+    env->ReleaseByteArrayElements(pixelData, pixels, JNI_ABORT);
+    return ok ? JNI_TRUE : JNI_FALSE;
+}
 
-    MpImagePtr image = nullptr;
-    char* error_msg = nullptr;
-    MpStatus status = MpImageCreateFromUint8Data(
-        kMpImageFormatSrgb, width, height,
-        reinterpret_cast<const uint8_t*>(pixels), dataSize,
-        &image, &error_msg);
+/* Direct ByteBuffer variant of nativeRecognizeGestureForVideo. */
+JNIEXPORT jboolean JNICALL
+Java_org_balch_orpheus_core_mediapipe_MediaPipeJni_nativeRecognizeGestureForVideoBuffer(
+    JNIEnv* env, jclass cls, jlong recognizerPtr,
+    jobject pixelBuffer, jint width, jint height, jlong timestampMs) {
 
-    env->ReleaseByteArrayElements(pixelData, pixels, JNI_ABORT);
+    Tracker* t = tracker_from_handle(recognizerPtr);
 
-    if (status != kMpOk) {
-        fprintf(stderr, "[MediaPipe JNI] GR image create failed: %s\n",
-                error_msg ? error_msg : "unknown");
-        if (error_msg) free(error_msg);
-        return JNI_FALSE;
+    const uint8_t* pixels = direct_rgb_address(env, pixelBuffer, width, height);
+    if (pixels == nullptr) return JNI_FALSE;
+    return gr_recognize_for_video(env, t, pixels, width, height, timestampMs, now_ns(), nullptr)
+        ? JNI_TRUE : JNI_FALSE;
+}
+
+/* Attach (or, with neither modelPath nor modelBuffer, detach) the
+ * skip-frame tracking landmarker of a recognizer: full recognition runs at
+ * least every interval frames and whenever a hand's pose drifts by more
+ * than motionThreshold hand scales; other frames are tracked with
+ * hand_landmarker.task from modelBuffer or modelPath.  Replaces any
+ * previous schedule. */
+JNIEXPORT void JNICALL
+Java_org_balch_orpheus_core_mediapipe_MediaPipeJni_nativeSetGestureSchedule(
+    JNIEnv* env, jclass cls, jlong recognizerPtr, jstring modelPath, jobject modelBuffer,
+    jint interval, jfloat motionThreshold) {
+
+    Tracker* t = tracker_from_handle(recognizerPtr);
+    if (t->kind != TRACKER_GESTURE_RECOGNIZER) {
+        throw_exception(env, "gesture schedule needs a GestureRecognizer handle");
+        return;
     }
 
-    // Synchronous recognition — blocks until result is available.
-    GestureRecognizerResult result;
-    memset(&result, 0, sizeof(result));
-    status = MpGestureRecognizerRecognizeForVideo(recognizer, image, nullptr,
-                                                   timestampMs, &result, &error_msg);
+    PooledLandmarker* landmarker = nullptr;
+    if (modelPath != nullptr || modelBuffer != nullptr) {
+        if (interval < 1 || motionThreshold <= 0.0f) {
+            throw_exception(env, "schedule interval must be >= 1 and motion threshold positive");
+            return;
+        }
+        struct BaseOptions base;
+        memset(&base, 0, sizeof(base));
+        ModelAsset model;
+        if (!model_asset_acquire(env, modelPath, modelBuffer, &base, &model)) return;
+        /* Same delegate as the recognizer; a GPU failure only demotes this one. */
+        TrackerOptions options = t->options;
+        char error[512];
+        landmarker = create_pooled_task(pooled_landmarker_create, "HandLandmarker", &options,
+                                        &base, error, sizeof(error));
+        model_asset_release(env, &model);
+
+        if (landmarker == nullptr) {
+            throw_exception(env, error);
+            return;
+        }
+    }
 
-    if (status != kMpOk) {
-        fprintf(stderr, "[JNI] GR err: %s\n", error_msg ? error_msg : "?");
-        if (error_msg) free(error_msg);
-        return JNI_FALSE;
-    } else {
-        gr_deliver_result(env, &result, timestampMs);
-        MpGestureRecognizerCloseResult(&result);
-        return JNI_TRUE;
+    PooledLandmarker* previous;
+    {
+        std::lock_guard<std::mutex> lock(t->schedule_mutex);
+        previous = t->tracking;
+        t->tracking = landmarker;
+        gesture_schedule_init(&t->schedule, (int)interval, motionThreshold);
     }
+    pooled_landmarker_close(previous);
+}
+
+/* Pipelined variant: copies the frame into the worker's mailbox and returns
+ * immediately.  Returns whether the most recently completed recognition
+ * succeeded, so callers can back off on graph errors. */
+JNIEXPORT jboolean JNICALL
+Java_org_balch_orpheus_core_mediapipe_MediaPipeJni_nativeRecognizeGestureAsync(
+    JNIEnv* env, jclass cls, jlong recognizerPtr,
+    jobject pixelBuffer, jint width, jint height, jlong timestampMs) {
+
+    Tracker* t = tracker_from_handle(recognizerPtr);
+
+    const uint8_t* pixels = direct_rgb_address(env, pixelBuffer, width, height);
+    if (pixels == nullptr) return JNI_FALSE;
+    gr_worker_submit(t, pixels, width, height, timestampMs);
+    return t->worker->last_ok.load(std::memory_order_relaxed) ? JNI_TRUE : JNI_FALSE;
 }
 
 JNIEXPORT void JNICALL
 Java_org_balch_orpheus_core_mediapipe_MediaPipeJni_nativeCloseGestureRecognizer(
     JNIEnv* env, jclass cls, jlong recognizerPtr) {
 
-    auto recognizer = reinterpret_cast<MpGestureRecognizerPtr>(recognizerPtr);
-    char* error_msg = nullptr;
-    MpGestureRecognizerClose(recognizer, &error_msg);
-    if (error_msg) free(error_msg);
+    Tracker* t = tracker_from_handle(recognizerPtr);
+    capture_stop(env, t);
+    gr_worker_stop(t);
+    warmup_stop(t);
+    pooled_recognizer_close(t->recognizer);
+    pooled_landmarker_close(t->tracking);
+
+    tracker_free(env, t);
+}
+
+/* --- Batched recognition --- */
+
+/* Create a batch object with `workers` native worker threads (0 runs every
+ * frame on the calling thread) for nativeDetectBatch. */
+JNIEXPORT jlong JNICALL
+Java_org_balch_orpheus_core_mediapipe_MediaPipeJni_nativeCreateBatch(
+    JNIEnv* env, jclass cls, jint workers) {
+
+    if (workers < 0 || workers > BATCH_MAX_WORKERS) {
+        throw_exception(env, "batch workers must be 0..8");
+        return 0;
+    }
+    BatchPool* b = new BatchPool();
+    b->job_count = 0;
+    b->next_job = 0;
+    b->unfinished = 0;
+    b->stop = false;
+    b->gesture_count = 0;
+    for (int i = 0; i < workers; i++) b->threads.emplace_back(batch_worker_loop, b);
+    return reinterpret_cast<jlong>(b);
+}
+
+/* Recognize frame i of the batch on recognizers[i], for every i.  Frame i
+ * is packed RGB at byte layout[3i] of the direct buffer `frames`, sized
+ * layout[3i+1] x layout[3i+2], with timestamp timestampsMs[i] on its
+ * recognizer's clock.  Its result goes into ring-format slot i of the
+ * direct buffer `out` (outSlots slots); `recognized` gets whether each
+ * frame went through (a failed one leaves an empty slot).  Recognizers
+ * must be distinct GestureRecognizer handles without a capture thread or
+ * async worker; their callbacks and rings are not used.
+ * Returns the number of gesture names interned so far. */
+JNIEXPORT jint JNICALL
+Java_org_balch_orpheus_core_mediapipe_MediaPipeJni_nativeDetectBatch(
+    JNIEnv* env, jclass cls, jlong batchPtr, jlongArray recognizers, jobject frames,
+    jintArray layout, jlongArray timestampsMs, jobject out, jint outSlots,
+    jbooleanArray recognized) {
+
+    BatchPool* b = reinterpret_cast<BatchPool*>(batchPtr);
+    jsize count = env->GetArrayLength(recognizers);
+    if (count > BATCH_MAX_SOURCES) {
+        throw_exception(env, "batch holds at most 16 frames");
+        return 0;
+    }
+    if (env->GetArrayLength(layout) != count * 3 ||
+        env->GetArrayLength(timestampsMs) != count ||
+        env->GetArrayLength(recognized) < count || outSlots < count) {
+        throw_exception(env, "batch array sizes don't match the recognizer count");
+        return 0;
+    }
+    const uint8_t* base = static_cast<const uint8_t*>(env->GetDirectBufferAddress(frames));
+    jlong capacity = env->GetDirectBufferCapacity(frames);
+    float* slots = static_cast<float*>(env->GetDirectBufferAddress(out));
+    if (base == nullptr || slots == nullptr ||
+        env->GetDirectBufferCapacity(out) < (jlong)outSlots * RING_SLOT_FLOATS * 4) {
+        throw_exception(env, "batch frames and out must be direct buffers, out of outSlots slots");
+        return 0;
+    }
+
+    jlong handles[BATCH_MAX_SOURCES];
+    jint spans[BATCH_MAX_SOURCES * 3];
+    jlong timestamps[BATCH_MAX_SOURCES];
+    env->GetLongArrayRegion(recognizers, 0, count, handles);
+    env->GetIntArrayRegion(layout, 0, count * 3, spans);
+    env->GetLongArrayRegion(timestampsMs, 0, count, timestamps);
+
+    std::lock_guard<std::mutex> call(b->call_mutex);
+    int64_t frame_ns = now_ns();
+    for (jsize i = 0; i < count; i++) {
+        Tracker* t = tracker_from_handle(handles[i]);
+        if (t == nullptr || t->kind != TRACKER_GESTURE_RECOGNIZER ||
+            t->worker != nullptr || t->capture != nullptr) {
+            throw_exception(env, "batch needs GestureRecognizer handles without capture or async worker");
+            return 0;
+        }
+        for (jsize j = 0; j < i; j++) {
+            if (handles[j] == handles[i]) {
+                throw_exception(env, "batch recognizers must be distinct");
+                return 0;
+            }
+        }
+        jint offset = spans[i * 3];
+        jint width = spans[i * 3 + 1];
+        jint height = spans[i * 3 + 2];
+        if (offset < 0 || width <= 0 || height <= 0 ||
+            (jlong)offset + (jlong)width * height * 3 > capacity) {
+            throw_exception(env, "batch frame outside the frames buffer");
+            return 0;
+        }
 
-    if (g_gr_callback != nullptr) {
-        env->DeleteGlobalRef(g_gr_callback);
-        g_gr_callback = nullptr;
-        g_gr_onResult = nullptr;
+        BatchJob* job = &b->jobs[i];
+        job->tracker = t;
+        job->pixels = base + offset;
+        job->width = (int)width;
+        job->height = (int)height;
+        job->timestamp_ms = (int64_t)timestamps[i];
+        job->frame_ns = frame_ns;
+        job->ok = false;
     }
+
+    batch_run(b, (int)count);
+    batch_pack(b, (int)count, slots);
+
+    jboolean ok[BATCH_MAX_SOURCES];
+    for (jsize i = 0; i < count; i++) ok[i] = b->jobs[i].ok ? JNI_TRUE : JNI_FALSE;
+    env->SetBooleanArrayRegion(recognized, 0, count, ok);
+    return (jint)b->gesture_count;
+}
+
+/* Name of gesture ID `id` in nativeDetectBatch slots, or null. */
+JNIEXPORT jstring JNICALL
+Java_org_balch_orpheus_core_mediapipe_MediaPipeJni_nativeBatchGestureName(
+    JNIEnv* env, jclass cls, jlong batchPtr, jint id) {
+
+    BatchPool* b = reinterpret_cast<BatchPool*>(batchPtr);
+    std::lock_guard<std::mutex> call(b->call_mutex);
+    if (id < 0 || id >= b->gesture_count) return nullptr;
+    return env->NewStringUTF(b->gesture_names[id]);
+}
+
+/* Join the workers and free the batch object.  Its recognizers stay open. */
+JNIEXPORT void JNICALL
+Java_org_balch_orpheus_core_mediapipe_MediaPipeJni_nativeCloseBatch(
+    JNIEnv* env, jclass cls, jlong batchPtr) {
+
+    BatchPool* b = reinterpret_cast<BatchPool*>(batchPtr);
+    if (b == nullptr) return;
+    batch_stop(b);
+    delete b;
 }
 
 }  /* extern "C" */
@@ -0,0 +1,103 @@
+#include "native_capture.h"
+
+#include <cstdio>
+
+#if defined(__ANDROID__)
+
+/* MediaPipe's Android OpenCV has no camera backend; Android feeds CameraX
+ * frames through nativePreprocessYuvFrame instead. */
+struct NativeCapture {};
+
+NativeCapture* native_capture_open(int device, int, int, double, char* error, size_t error_size) {
+    snprintf(error, error_size, "native capture is not available on Android (camera %d)", device);
+    return nullptr;
+}
+
+void native_capture_size(const NativeCapture*, int* width, int* height) {
+    *width = 0;
+    *height = 0;
+}
+
+bool native_capture_read(NativeCapture*, const uint8_t**, int*) {
+    return false;
+}
+
+void native_capture_close(NativeCapture* c) {
+    delete c;
+}
+
+#else
+
+#include "mediapipe/framework/port/opencv_core_inc.h"
+#include "mediapipe/framework/port/opencv_video_inc.h"
+
+struct NativeCapture {
+    cv::VideoCapture capture;
+    cv::Mat frame;
+    int width;
+    int height;
+};
+
+/* The platform's native backend; CAP_ANY could pick FFmpeg or GStreamer,
+ * which add their own buffering on top of the driver. */
+static int capture_api() {
+#if defined(__APPLE__)
+    return cv::CAP_AVFOUNDATION;
+#elif defined(__linux__)
+    return cv::CAP_V4L2;
+#elif defined(_WIN32)
+    return cv::CAP_MSMF;
+#else
+    return cv::CAP_ANY;
+#endif
+}
+
+NativeCapture* native_capture_open(int device, int width, int height, double fps,
+                                   char* error, size_t error_size) {
+    NativeCapture* c = new NativeCapture();
+    if (!c->capture.open(device, capture_api()) || !c->capture.isOpened()) {
+        snprintf(error, error_size, "cannot open camera %d", device);
+        delete c;
+        return nullptr;
+    }
+    c->capture.set(cv::CAP_PROP_FRAME_WIDTH, width);
+    c->capture.set(cv::CAP_PROP_FRAME_HEIGHT, height);
+    c->capture.set(cv::CAP_PROP_FPS, fps);
+    /* Keep only the newest frame queued: latency over completeness. */
+    c->capture.set(cv::CAP_PROP_BUFFERSIZE, 1);
+
+    /* Property reads are unreliable across backends; the first frame tells
+     * the real size. */
+    if (!c->capture.read(c->frame) || c->frame.empty() || c->frame.type() != CV_8UC3) {
+        snprintf(error, error_size, "camera %d delivered no BGR frame", device);
+        c->capture.release();
+        delete c;
+        return nullptr;
+    }
+    c->width = c->frame.cols;
+    c->height = c->frame.rows;
+    return c;
+}
+
+void native_capture_size(const NativeCapture* c, int* width, int* height) {
+    *width = c->width;
+    *height = c->height;
+}
+
+bool native_capture_read(NativeCapture* c, const uint8_t** bgr, int* stride) {
+    if (!c->capture.read(c->frame) || c->frame.empty() || c->frame.type() != CV_8UC3 ||
+        c->frame.cols != c->width || c->frame.rows != c->height) {
+        return false;
+    }
+    *bgr = c->frame.data;
+    *stride = static_cast<int>(c->frame.step);
+    return true;
+}
+
+void native_capture_close(NativeCapture* c) {
+    if (c == nullptr) return;
+    c->capture.release();
+    delete c;
+}
+
+#endif  // __ANDROID__
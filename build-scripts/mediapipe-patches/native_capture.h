@@ -0,0 +1,33 @@
+#ifndef ORPHEUS_MEDIAPIPE_NATIVE_CAPTURE_H_
+#define ORPHEUS_MEDIAPIPE_NATIVE_CAPTURE_H_
+
+#include <cstddef>
+#include <cstdint>
+
+/*
+ * Camera capture for the MediaPipe JNI bridge through OpenCV's VideoCapture
+ * (AVFoundation on macOS, V4L2 on Linux, Media Foundation on Windows),
+ * using the OpenCV build the dylib already links.  No JNI dependencies.
+ * Frames are packed BGR24 rows, the same layout FFmpeg hands JavaCV.
+ * Android builds compile a stub whose open always fails.
+ */
+
+struct NativeCapture;
+
+/* Open camera `device` and ask for width x height at fps (the driver may
+ * pick the nearest mode; native_capture_size reports what it delivers).
+ * Returns nullptr and fills error on failure. */
+NativeCapture* native_capture_open(int device, int width, int height, double fps,
+                                   char* error, size_t error_size);
+
+/* Frame size the camera actually delivers. */
+void native_capture_size(const NativeCapture* c, int* width, int* height);
+
+/* Block until the next frame.  On success *bgr points at height rows of
+ * *stride bytes, valid until the next read or close.  Returns false when
+ * the camera fails or changes frame size. */
+bool native_capture_read(NativeCapture* c, const uint8_t** bgr, int* stride);
+
+void native_capture_close(NativeCapture* c);
+
+#endif  // ORPHEUS_MEDIAPIPE_NATIVE_CAPTURE_H_
@@ -0,0 +1,362 @@
+#include "pooled_tasks.h"
+
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "absl/status/status.h"
+#include "absl/status/statusor.h"
+#include "mediapipe/framework/formats/classification.pb.h"
+#include "mediapipe/framework/formats/image.h"
+#include "mediapipe/framework/formats/image_frame.h"
+#include "mediapipe/framework/formats/landmark.pb.h"
+#include "mediapipe/tasks/cc/components/containers/category.h"
+#include "mediapipe/tasks/cc/components/containers/classification_result.h"
+#include "mediapipe/tasks/cc/components/containers/landmark.h"
+#include "mediapipe/tasks/cc/core/base_options.h"
+#include "mediapipe/tasks/cc/vision/core/running_mode.h"
+#include "mediapipe/tasks/cc/vision/gesture_recognizer/gesture_recognizer.h"
+#include "mediapipe/tasks/cc/vision/hand_landmarker/hand_landmarker.h"
+
+namespace containers = mediapipe::tasks::components::containers;
+namespace gesture = mediapipe::tasks::vision::gesture_recognizer;
+namespace hand = mediapipe::tasks::vision::hand_landmarker;
+
+/* Enough for the synchronous tasks (the frame in a graph plus the one
+ * being staged) with room for packets a calculator keeps a little longer. */
+#define IMAGE_POOL_SLOTS 4
+
+struct PooledImage {
+    std::shared_ptr<mediapipe::ImageFrame> frame;
+};
+
+struct ImagePool {
+    PooledImage slots[IMAGE_POOL_SLOTS];
+};
+
+/* Fixed storage behind one result's category lists and names. */
+struct CategoryStore {
+    struct Categories lists[POOLED_MAX_HANDS];
+    struct Category categories[POOLED_MAX_HANDS][POOLED_MAX_CATEGORIES];
+    char names[POOLED_MAX_HANDS][POOLED_MAX_CATEGORIES][POOLED_NAME_LEN];
+};
+
+struct LandmarkStore {
+    struct NormalizedLandmarks lists[POOLED_MAX_HANDS];
+    struct NormalizedLandmark landmarks[POOLED_MAX_HANDS][POOLED_MAX_LANDMARKS];
+    struct Landmarks world_lists[POOLED_MAX_HANDS];
+    struct Landmark world[POOLED_MAX_HANDS][POOLED_MAX_LANDMARKS];
+};
+
+struct PooledRecognizer {
+    std::unique_ptr<gesture::GestureRecognizer> task;
+    CategoryStore gestures;
+    CategoryStore handedness;
+    LandmarkStore landmarks;
+};
+
+struct PooledLandmarker {
+    std::unique_ptr<hand::HandLandmarker> task;
+    CategoryStore handedness;
+    LandmarkStore landmarks;
+};
+
+static void status_error(const absl::Status& status, const char* what,
+                         char* error, size_t error_size) {
+    snprintf(error, error_size, "%s: %.*s", what, (int)status.message().size(),
+             status.message().data());
+}
+
+/* --- Image pool --- */
+
+ImagePool* image_pool_create() {
+    return new ImagePool();
+}
+
+void image_pool_destroy(ImagePool* pool) {
+    delete pool;
+}
+
+PooledImage* image_pool_stage(ImagePool* pool, const uint8_t* rgb, int width, int height) {
+    /* A slot is free once no packet holds its frame any more; prefer one
+     * of the right size, so steady state never reallocates.  The tasks
+     * release their packets before the synchronous call returns. */
+    PooledImage* slot = nullptr;
+    for (int i = 0; i < IMAGE_POOL_SLOTS; i++) {
+        PooledImage* s = &pool->slots[i];
+        if (s->frame && s->frame.use_count() > 1) continue;
+        if (s->frame && s->frame->Width() == width && s->frame->Height() == height) {
+            slot = s;
+            break;
+        }
+        if (slot == nullptr) slot = s;
+    }
+    if (slot == nullptr) return nullptr;
+
+    if (!slot->frame || slot->frame->Width() != width || slot->frame->Height() != height) {
+        slot->frame = std::make_shared<mediapipe::ImageFrame>(
+            mediapipe::ImageFormat::SRGB, width, height,
+            mediapipe::ImageFrame::kDefaultAlignmentBoundary);
+    }
+    uint8_t* dst = slot->frame->MutablePixelData();
+    const size_t step = (size_t)slot->frame->WidthStep();
+    const size_t row = (size_t)width * 3;
+    for (int y = 0; y < height; y++) {
+        memcpy(dst + (size_t)y * step, rgb + (size_t)y * row, row);
+    }
+    return slot;
+}
+
+/* --- Result storage --- */
+
+static char* store_name(CategoryStore* s, int h, int i, const std::string& name) {
+    snprintf(s->names[h][i], POOLED_NAME_LEN, "%s", name.c_str());
+    return s->names[h][i];
+}
+
+static void store_classification_lists(CategoryStore* s,
+                                       const std::vector<mediapipe::ClassificationList>& in,
+                                       struct Categories** out, uint32_t* count) {
+    int hands = (int)in.size() < POOLED_MAX_HANDS ? (int)in.size() : POOLED_MAX_HANDS;
+    for (int h = 0; h < hands; h++) {
+        int n = in[h].classification_size();
+        if (n > POOLED_MAX_CATEGORIES) n = POOLED_MAX_CATEGORIES;
+        for (int i = 0; i < n; i++) {
+            const mediapipe::Classification& c = in[h].classification(i);
+            struct Category* dst = &s->categories[h][i];
+            dst->index = c.index();
+            dst->score = c.score();
+            dst->category_name = store_name(s, h, i, c.label());
+            dst->display_name = nullptr;
+        }
+        s->lists[h].categories = s->categories[h];
+        s->lists[h].categories_count = (uint32_t)n;
+    }
+    *out = s->lists;
+    *count = (uint32_t)hands;
+}
+
+static void store_classifications(CategoryStore* s,
+                                  const std::vector<containers::Classifications>& in,
+                                  struct Categories** out, uint32_t* count) {
+    int hands = (int)in.size() < POOLED_MAX_HANDS ? (int)in.size() : POOLED_MAX_HANDS;
+    for (int h = 0; h < hands; h++) {
+        int n = (int)in[h].categories.size();
+        if (n > POOLED_MAX_CATEGORIES) n = POOLED_MAX_CATEGORIES;
+        for (int i = 0; i < n; i++) {
+            const containers::Category& c = in[h].categories[i];
+            struct Category* dst = &s->categories[h][i];
+            dst->index = c.index;
+            dst->score = c.score;
+            dst->category_name = c.category_name ? store_name(s, h, i, *c.category_name) : nullptr;
+            dst->display_name = nullptr;
+        }
+        s->lists[h].categories = s->categories[h];
+        s->lists[h].categories_count = (uint32_t)n;
+    }
+    *out = s->lists;
+    *count = (uint32_t)hands;
+}
+
+static int clamp_landmarks(int n) {
+    return n < POOLED_MAX_LANDMARKS ? n : POOLED_MAX_LANDMARKS;
+}
+
+/* GestureRecognizer results hold landmark protos... */
+static void store_landmark_lists(LandmarkStore* s,
+                                 const std::vector<mediapipe::NormalizedLandmarkList>& in,
+                                 const std::vector<mediapipe::LandmarkList>& world,
+                                 struct NormalizedLandmarks** out, uint32_t* count,
+                                 struct Landmarks** world_out, uint32_t* world_count) {
+    int hands = (int)in.size() < POOLED_MAX_HANDS ? (int)in.size() : POOLED_MAX_HANDS;
+    for (int h = 0; h < hands; h++) {
+        int n = clamp_landmarks(in[h].landmark_size());
+        for (int i = 0; i < n; i++) {
+            const mediapipe::NormalizedLandmark& l = in[h].landmark(i);
+            struct NormalizedLandmark* dst = &s->landmarks[h][i];
+            dst->x = l.x();
+            dst->y = l.y();
+            dst->z = l.z();
+            dst->has_visibility = l.has_visibility();
+            dst->visibility = l.visibility();
+            dst->has_presence = l.has_presence();
+            dst->presence = l.presence();
+            dst->name = nullptr;
+        }
+        s->lists[h].landmarks = s->landmarks[h];
+        s->lists[h].landmarks_count = (uint32_t)n;
+    }
+    *out = s->lists;
+    *count = (uint32_t)hands;
+
+    int world_hands = (int)world.size() < POOLED_MAX_HANDS ? (int)world.size() : POOLED_MAX_HANDS;
+    for (int h = 0; h < world_hands; h++) {
+        int n = clamp_landmarks(world[h].landmark_size());
+        for (int i = 0; i < n; i++) {
+            const mediapipe::Landmark& l = world[h].landmark(i);
+            struct Landmark* dst = &s->world[h][i];
+            dst->x = l.x();
+            dst->y = l.y();
+            dst->z = l.z();
+            dst->has_visibility = l.has_visibility();
+            dst->visibility = l.visibility();
+            dst->has_presence = l.has_presence();
+            dst->presence = l.presence();
+            dst->name = nullptr;
+        }
+        s->world_lists[h].landmarks = s->world[h];
+        s->world_lists[h].landmarks_count = (uint32_t)n;
+    }
+    *world_out = s->world_lists;
+    *world_count = (uint32_t)world_hands;
+}
+
+/* ...and HandLandmarker results the task containers. */
+static void store_landmarks(LandmarkStore* s,
+                            const std::vector<containers::NormalizedLandmarks>& in,
+                            const std::vector<containers::Landmarks>& world,
+                            struct NormalizedLandmarks** out, uint32_t* count,
+                            struct Landmarks** world_out, uint32_t* world_count) {
+    int hands = (int)in.size() < POOLED_MAX_HANDS ? (int)in.size() : POOLED_MAX_HANDS;
+    for (int h = 0; h < hands; h++) {
+        int n = clamp_landmarks((int)in[h].landmarks.size());
+        for (int i = 0; i < n; i++) {
+            const containers::NormalizedLandmark& l = in[h].landmarks[i];
+            struct NormalizedLandmark* dst = &s->landmarks[h][i];
+            dst->x = l.x;
+            dst->y = l.y;
+            dst->z = l.z;
+            dst->has_visibility = l.visibility.has_value();
+            dst->visibility = l.visibility.value_or(0.0f);
+            dst->has_presence = l.presence.has_value();
+            dst->presence = l.presence.value_or(0.0f);
+            dst->name = nullptr;
+        }
+        s->lists[h].landmarks = s->landmarks[h];
+        s->lists[h].landmarks_count = (uint32_t)n;
+    }
+    *out = s->lists;
+    *count = (uint32_t)hands;
+
+    int world_hands = (int)world.size() < POOLED_MAX_HANDS ? (int)world.size() : POOLED_MAX_HANDS;
+    for (int h = 0; h < world_hands; h++) {
+        int n = clamp_landmarks((int)world[h].landmarks.size());
+        for (int i = 0; i < n; i++) {
+            const containers::Landmark& l = world[h].landmarks[i];
+            struct Landmark* dst = &s->world[h][i];
+            dst->x = l.x;
+            dst->y = l.y;
+            dst->z = l.z;
+            dst->has_visibility = l.visibility.has_value();
+            dst->visibility = l.visibility.value_or(0.0f);
+            dst->has_presence = l.presence.has_value();
+            dst->presence = l.presence.value_or(0.0f);
+            dst->name = nullptr;
+        }
+        s->world_lists[h].landmarks = s->world[h];
+        s->world_lists[h].landmarks_count = (uint32_t)n;
+    }
+    *world_out = s->world_lists;
+    *world_count = (uint32_t)world_hands;
+}
+
+/* --- Tasks --- */
+
+/* C API options -> C++ task options, always VIDEO mode. */
+template <typename CppOptions>
+static std::unique_ptr<CppOptions> task_options(const PooledTaskOptions* o) {
+    auto options = std::make_unique<CppOptions>();
+    const struct BaseOptions* base = o->base;
+    if (base->model_asset_buffer != nullptr) {
+        options->base_options.model_asset_buffer = std::make_unique<std::string>(
+            base->model_asset_buffer, base->model_asset_buffer_count);
+    } else if (base->model_asset_path != nullptr) {
+        options->base_options.model_asset_path = base->model_asset_path;
+    }
+    options->base_options.delegate = o->use_gpu
+        ? mediapipe::tasks::core::BaseOptions::Delegate::GPU
+        : mediapipe::tasks::core::BaseOptions::Delegate::CPU;
+    options->running_mode = mediapipe::tasks::vision::core::RunningMode::VIDEO;
+    options->num_hands = o->num_hands;
+    options->min_hand_detection_confidence = o->min_hand_detection_confidence;
+    options->min_hand_presence_confidence = o->min_hand_presence_confidence;
+    options->min_tracking_confidence = o->min_tracking_confidence;
+    return options;
+}
+
+PooledRecognizer* pooled_recognizer_create(const PooledTaskOptions* options,
+                                           char* error, size_t error_size) {
+    auto task = gesture::GestureRecognizer::Create(
+        task_options<gesture::GestureRecognizerOptions>(options));
+    if (!task.ok()) {
+        status_error(task.status(), "GestureRecognizer create failed", error, error_size);
+        return nullptr;
+    }
+    PooledRecognizer* r = new PooledRecognizer();
+    r->task = std::move(*task);
+    return r;
+}
+
+bool pooled_recognizer_recognize(PooledRecognizer* r, const PooledImage* image,
+                                 int64_t timestamp_ms, GestureRecognizerResult* result,
+                                 char* error, size_t error_size) {
+    auto recognized = r->task->RecognizeForVideo(mediapipe::Image(image->frame), timestamp_ms);
+    if (!recognized.ok()) {
+        status_error(recognized.status(), "GestureRecognizer failed", error, error_size);
+        return false;
+    }
+    memset(result, 0, sizeof(*result));
+    store_classification_lists(&r->gestures, recognized->gestures,
+                               &result->gestures, &result->gestures_count);
+    store_classification_lists(&r->handedness, recognized->handedness,
+                               &result->handedness, &result->handedness_count);
+    store_landmark_lists(&r->landmarks, recognized->hand_landmarks,
+                         recognized->hand_world_landmarks,
+                         &result->hand_landmarks, &result->hand_landmarks_count,
+                         &result->hand_world_landmarks, &result->hand_world_landmarks_count);
+    return true;
+}
+
+void pooled_recognizer_close(PooledRecognizer* r) {
+    if (r == nullptr) return;
+    r->task->Close().IgnoreError();
+    delete r;
+}
+
+PooledLandmarker* pooled_landmarker_create(const PooledTaskOptions* options,
+                                           char* error, size_t error_size) {
+    auto task = hand::HandLandmarker::Create(task_options<hand::HandLandmarkerOptions>(options));
+    if (!task.ok()) {
+        status_error(task.status(), "HandLandmarker create failed", error, error_size);
+        return nullptr;
+    }
+    PooledLandmarker* l = new PooledLandmarker();
+    l->task = std::move(*task);
+    return l;
+}
+
+bool pooled_landmarker_detect(PooledLandmarker* l, const PooledImage* image,
+                              int64_t timestamp_ms, HandLandmarkerResult* result,
+                              char* error, size_t error_size) {
+    auto detected = l->task->DetectForVideo(mediapipe::Image(image->frame), timestamp_ms);
+    if (!detected.ok()) {
+        status_error(detected.status(), "HandLandmarker failed", error, error_size);
+        return false;
+    }
+    memset(result, 0, sizeof(*result));
+    store_classifications(&l->handedness, detected->handedness,
+                          &result->handedness, &result->handedness_count);
+    store_landmarks(&l->landmarks, detected->hand_landmarks, detected->hand_world_landmarks,
+                    &result->hand_landmarks, &result->hand_landmarks_count,
+                    &result->hand_world_landmarks, &result->hand_world_landmarks_count);
+    return true;
+}
+
+void pooled_landmarker_close(PooledLandmarker* l) {
+    if (l == nullptr) return;
+    l->task->Close().IgnoreError();
+    delete l;
+}
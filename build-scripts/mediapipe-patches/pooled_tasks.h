@@ -0,0 +1,81 @@
+#ifndef ORPHEUS_MEDIAPIPE_POOLED_TASKS_H_
+#define ORPHEUS_MEDIAPIPE_POOLED_TASKS_H_
+
+#include <cstddef>
+#include <cstdint>
+
+#include "mediapipe/tasks/c/core/base_options.h"
+#include "mediapipe/tasks/c/vision/gesture_recognizer/gesture_recognizer.h"
+#include "mediapipe/tasks/c/vision/hand_landmarker/hand_landmarker.h"
+
+/*
+ * VIDEO-mode GestureRecognizer and HandLandmarker for the MediaPipe JNI
+ * bridge that allocate nothing per frame in steady state.  No JNI deps.
+ *
+ * The C API copies every frame into a freshly allocated ImageFrame and
+ * converts every result into malloc'd category, landmark and name arrays
+ * that MpXxxCloseResult frees again.  These run the same C++ tasks
+ * directly instead:
+ *   - frames are copied into an ImagePool slot, reused as soon as no
+ *     graph packet references it any more;
+ *   - results are written into fixed per-instance storage and returned as
+ *     the C API's result structs, so the bridge's packers take them as
+ *     they are.  Nothing needs closing; a result stays valid until the
+ *     next call on the same instance.
+ * Allocations left are MediaPipe's own: graph packets and the C++ task
+ * result.  Each object is used by one thread at a time.
+ */
+
+#define POOLED_MAX_HANDS 2
+#define POOLED_MAX_LANDMARKS 21
+#define POOLED_MAX_CATEGORIES 8     /* canned gesture classes; extra ones drop */
+#define POOLED_NAME_LEN 32
+
+struct ImagePool;
+struct PooledImage;
+struct PooledRecognizer;
+struct PooledLandmarker;
+
+/* Model and detection options.  base carries the model path or buffer as
+ * for the C API; it is only read during create.  use_gpu selects the GPU
+ * delegate (Metal on macOS, OpenGL ES on Linux); create fails with it in a
+ * MEDIAPIPE_DISABLE_GPU build or without a usable GPU. */
+struct PooledTaskOptions {
+    const struct BaseOptions* base;
+    int num_hands;
+    float min_hand_detection_confidence;
+    float min_hand_presence_confidence;
+    float min_tracking_confidence;
+    bool use_gpu;
+};
+
+ImagePool* image_pool_create();
+
+void image_pool_destroy(ImagePool* pool);
+
+/* Copy packed RGB pixels into a free pool slot.  The image stays valid
+ * for as long as the caller doesn't stage another one. */
+PooledImage* image_pool_stage(ImagePool* pool, const uint8_t* rgb, int width, int height);
+
+/* Returns nullptr and fills error on failure. */
+PooledRecognizer* pooled_recognizer_create(const PooledTaskOptions* options,
+                                           char* error, size_t error_size);
+
+/* Recognize one frame; fills *result (see above).  Returns false and
+ * fills error on failure. */
+bool pooled_recognizer_recognize(PooledRecognizer* r, const PooledImage* image,
+                                 int64_t timestamp_ms, GestureRecognizerResult* result,
+                                 char* error, size_t error_size);
+
+void pooled_recognizer_close(PooledRecognizer* r);
+
+PooledLandmarker* pooled_landmarker_create(const PooledTaskOptions* options,
+                                           char* error, size_t error_size);
+
+bool pooled_landmarker_detect(PooledLandmarker* l, const PooledImage* image,
+                              int64_t timestamp_ms, HandLandmarkerResult* result,
+                              char* error, size_t error_size);
+
+void pooled_landmarker_close(PooledLandmarker* l);
+
+#endif  // ORPHEUS_MEDIAPIPE_POOLED_TASKS_H_
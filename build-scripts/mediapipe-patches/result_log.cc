@@ -0,0 +1,187 @@
+#include "result_log.h"
+
+#include <atomic>
+#include <cstdio>
+#include <cstring>
+#if defined(_WIN32)
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+static const char kLogMagic[8] = {'O', 'R', 'P', 'H', 'L', 'O', 'G', '1'};
+
+struct ResultLogHeader {
+    char magic[8];
+    uint32_t version;
+    uint32_t header_size;
+    uint32_t record_size;
+    uint32_t capacity;
+    uint32_t record_count;
+    uint32_t dropped;
+    uint32_t gesture_count;
+    uint32_t reserved;
+};
+
+static_assert(sizeof(ResultLogHeader) <= RESULT_LOG_NAMES_OFFSET, "header fields overlap names");
+static_assert(RESULT_LOG_NAMES_OFFSET + RESULT_LOG_MAX_GESTURES * RESULT_LOG_NAME_LEN <=
+              RESULT_LOG_HEADER_SIZE, "gesture names overflow the header");
+
+struct ResultLog {
+#if defined(_WIN32)
+    HANDLE file;
+    HANDLE mapping;
+#else
+    int fd;
+#endif
+    uint8_t* base;
+    size_t mapped_size;
+    int capacity;
+    int count;
+    int dropped;
+    int gesture_count;          /* names interned so far, mirrored in the header */
+};
+
+static ResultLogHeader* log_header(ResultLog* log) {
+    return reinterpret_cast<ResultLogHeader*>(log->base);
+}
+
+static char* log_name(ResultLog* log, int id) {
+    return reinterpret_cast<char*>(log->base + RESULT_LOG_NAMES_OFFSET +
+                                   (size_t)id * RESULT_LOG_NAME_LEN);
+}
+
+/* Map name to its ID, adding it to the header table if new.  -1 for no
+ * gesture or a full table. */
+static int log_intern(ResultLog* log, const char* name) {
+    if (name == nullptr || name[0] == '\0') return -1;
+    for (int i = 0; i < log->gesture_count; i++) {
+        if (strncmp(log_name(log, i), name, RESULT_LOG_NAME_LEN - 1) == 0) return i;
+    }
+    if (log->gesture_count >= RESULT_LOG_MAX_GESTURES) return -1;
+
+    int id = log->gesture_count++;
+    snprintf(log_name(log, id), RESULT_LOG_NAME_LEN, "%s", name);
+    log_header(log)->gesture_count = (uint32_t)log->gesture_count;
+    return id;
+}
+
+ResultLog* result_log_open(const char* path, int capacity, char* error, size_t error_size) {
+    if (capacity <= 0) {
+        snprintf(error, error_size, "result log capacity must be positive");
+        return nullptr;
+    }
+    size_t size = RESULT_LOG_HEADER_SIZE + (size_t)capacity * RESULT_LOG_RECORD_SIZE;
+    ResultLog* log = new ResultLog();
+
+#if defined(_WIN32)
+    log->file = CreateFileA(path, GENERIC_READ | GENERIC_WRITE, FILE_SHARE_READ, nullptr,
+                            CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (log->file == INVALID_HANDLE_VALUE) {
+        snprintf(error, error_size, "cannot create result log %s", path);
+        delete log;
+        return nullptr;
+    }
+    log->mapping = CreateFileMappingA(log->file, nullptr, PAGE_READWRITE,
+                                      (DWORD)((uint64_t)size >> 32), (DWORD)size, nullptr);
+    void* map = log->mapping != nullptr
+        ? MapViewOfFile(log->mapping, FILE_MAP_WRITE, 0, 0, size) : nullptr;
+    if (map == nullptr) {
+        snprintf(error, error_size, "cannot map %zu bytes of result log %s", size, path);
+        if (log->mapping != nullptr) CloseHandle(log->mapping);
+        CloseHandle(log->file);
+        delete log;
+        return nullptr;
+    }
+#else
+    log->fd = open(path, O_RDWR | O_CREAT | O_TRUNC, 0644);
+    if (log->fd < 0) {
+        snprintf(error, error_size, "cannot create result log %s", path);
+        delete log;
+        return nullptr;
+    }
+    void* map = MAP_FAILED;
+    if (ftruncate(log->fd, (off_t)size) == 0) {
+        map = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, log->fd, 0);
+    }
+    if (map == MAP_FAILED) {
+        snprintf(error, error_size, "cannot map %zu bytes of result log %s", size, path);
+        close(log->fd);
+        delete log;
+        return nullptr;
+    }
+#endif
+
+    log->base = static_cast<uint8_t*>(map);
+    log->mapped_size = size;
+    log->capacity = capacity;
+
+    ResultLogHeader* header = log_header(log);
+    memset(log->base, 0, RESULT_LOG_HEADER_SIZE);
+    memcpy(header->magic, kLogMagic, sizeof(kLogMagic));
+    header->version = RESULT_LOG_VERSION;
+    header->header_size = RESULT_LOG_HEADER_SIZE;
+    header->record_size = RESULT_LOG_RECORD_SIZE;
+    header->capacity = (uint32_t)capacity;
+    return log;
+}
+
+void result_log_append(ResultLog* log, int64_t timestamp_ms, int64_t frame_ns, int hand_count,
+                       const float* handedness, const char* const* gesture_names,
+                       const float* gesture_scores, const float* xyz, int xyz_stride) {
+    if (log->count >= log->capacity) {
+        log_header(log)->dropped = (uint32_t)++log->dropped;
+        return;
+    }
+    if (hand_count > RESULT_LOG_MAX_HANDS) hand_count = RESULT_LOG_MAX_HANDS;
+
+    uint8_t* record = log->base + RESULT_LOG_HEADER_SIZE +
+                      (size_t)log->count * RESULT_LOG_RECORD_SIZE;
+    memset(record, 0, RESULT_LOG_RECORD_SIZE);
+    int32_t count = hand_count;
+    memcpy(record, &timestamp_ms, sizeof(timestamp_ms));
+    memcpy(record + 8, &frame_ns, sizeof(frame_ns));
+    memcpy(record + 16, &count, sizeof(count));
+
+    for (int h = 0; h < hand_count; h++) {
+        uint8_t* hand = record + 24 + (size_t)h * RESULT_LOG_HAND_SIZE;
+        int32_t gesture_id = log_intern(log, gesture_names != nullptr ? gesture_names[h] : nullptr);
+        float score = gesture_id >= 0 ? gesture_scores[h] : 0.0f;
+        memcpy(hand, &handedness[h], sizeof(float));
+        memcpy(hand + 4, &gesture_id, sizeof(gesture_id));
+        memcpy(hand + 8, &score, sizeof(score));
+        memcpy(hand + 12, xyz + (size_t)h * xyz_stride, sizeof(float) * RESULT_LOG_LANDMARK_FLOATS);
+    }
+
+    /* Publish the record (and any name it interned) before counting it. */
+    std::atomic_thread_fence(std::memory_order_release);
+    log_header(log)->record_count = (uint32_t)++log->count;
+}
+
+int result_log_count(const ResultLog* log) {
+    return log->count;
+}
+
+void result_log_close(ResultLog* log) {
+    if (log == nullptr) return;
+    size_t used = RESULT_LOG_HEADER_SIZE + (size_t)log->count * RESULT_LOG_RECORD_SIZE;
+#if defined(_WIN32)
+    FlushViewOfFile(log->base, used);
+    UnmapViewOfFile(log->base);
+    CloseHandle(log->mapping);
+    LARGE_INTEGER end;
+    end.QuadPart = (LONGLONG)used;
+    if (SetFilePointerEx(log->file, end, nullptr, FILE_BEGIN)) SetEndOfFile(log->file);
+    CloseHandle(log->file);
+#else
+    msync(log->base, used, MS_SYNC);
+    munmap(log->base, log->mapped_size);
+    if (ftruncate(log->fd, (off_t)used) != 0) {
+        /* Keeps the unused tail; readers go by the record count. */
+    }
+    close(log->fd);
+#endif
+    delete log;
+}
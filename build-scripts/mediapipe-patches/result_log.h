@@ -0,0 +1,63 @@
+#ifndef ORPHEUS_MEDIAPIPE_RESULT_LOG_H_
+#define ORPHEUS_MEDIAPIPE_RESULT_LOG_H_
+
+#include <cstddef>
+#include <cstdint>
+
+/*
+ * Memory-mapped binary log of packed hand results for the MediaPipe JNI
+ * bridge, for replaying a session into the gesture engines without a
+ * camera (ResultLogReader / ReplayHandTracker on the Kotlin side).
+ * No JNI or MediaPipe dependencies.
+ *
+ * The file is sized for `capacity` records up front and mapped once, so an
+ * append is a fixed-size memcpy; results past capacity are counted as
+ * dropped.  Closing truncates the file to the records written.
+ *
+ * Layout, little-endian:
+ *   header (RESULT_LOG_HEADER_SIZE bytes)
+ *     char magic[8] "ORPHLOG1", uint32 version, header size, record size,
+ *     capacity, record count, dropped, gesture count, reserved;
+ *     at RESULT_LOG_NAMES_OFFSET, RESULT_LOG_MAX_GESTURES names of
+ *     RESULT_LOG_NAME_LEN bytes, NUL-padded
+ *   records (RESULT_LOG_RECORD_SIZE bytes each)
+ *     int64 timestamp_ms, int64 frame time (ns, bridge clock), int32 hand
+ *     count, int32 reserved, then 2 hands of float handedness (1 = user's
+ *     right), int32 gesture ID (-1 = none), float gesture score, float
+ *     21*xyz
+ * The record count is updated after each record, so a log cut short by a
+ * crash still reads up to the last complete result.
+ */
+
+#define RESULT_LOG_VERSION 1
+#define RESULT_LOG_HEADER_SIZE 4096
+#define RESULT_LOG_NAMES_OFFSET 64
+#define RESULT_LOG_MAX_HANDS 2
+#define RESULT_LOG_LANDMARK_FLOATS 63
+#define RESULT_LOG_MAX_GESTURES 32
+#define RESULT_LOG_NAME_LEN 48
+#define RESULT_LOG_HAND_SIZE (12 + RESULT_LOG_LANDMARK_FLOATS * 4)
+#define RESULT_LOG_RECORD_SIZE (24 + RESULT_LOG_MAX_HANDS * RESULT_LOG_HAND_SIZE)
+
+struct ResultLog;
+
+/* Create (or replace) the log file at path with room for capacity records.
+ * Returns nullptr and fills error on failure. */
+ResultLog* result_log_open(const char* path, int capacity, char* error, size_t error_size);
+
+/* Append one result.  frame_ns is when its frame entered the bridge (the
+ * timestamps need not be times: desktop trackers count frames).
+ * handedness, gesture_names (nullptr or "" = none), gesture_scores and xyz
+ * (21*xyz per hand, xyz_stride floats apart) hold hand_count entries.
+ * One thread at a time. */
+void result_log_append(ResultLog* log, int64_t timestamp_ms, int64_t frame_ns, int hand_count,
+                       const float* handedness, const char* const* gesture_names,
+                       const float* gesture_scores, const float* xyz, int xyz_stride);
+
+/* Records written so far. */
+int result_log_count(const ResultLog* log);
+
+/* Unmap, truncate to the written records and close.  nullptr is a no-op. */
+void result_log_close(ResultLog* log);
+
+#endif  // ORPHEUS_MEDIAPIPE_RESULT_LOG_H_
@@ -21,9 +21,13 @@ class OrpheusAudioEngine @Inject constructor() : AudioEngine {
     private val lineOutLeftProxy = com.jsyn.unitgen.PassThrough()
     private val lineOutRightProxy = com.jsyn.unitgen.PassThrough()
 
+    // Runs control listeners on the audio thread; not connected to the graph.
+    private val controlTicker = JsynControlTicker()
+
     init {
         synth.add(lineOutLeftProxy)
         synth.add(lineOutRightProxy)
+        synth.add(controlTicker)
 
         // Connect proxies to LineOut
         lineOutLeftProxy.output.connect(0, lineOut.input, 0)
@@ -34,9 +38,11 @@ class OrpheusAudioEngine @Inject constructor() : AudioEngine {
         synth.add(lineOut)
         synth.start()
         lineOut.start()
+        controlTicker.start()
     }
 
     override fun stop() {
+        controlTicker.stop()
         lineOut.stop()
         synth.stop()
     }
@@ -120,4 +126,12 @@ class OrpheusAudioEngine @Inject constructor() : AudioEngine {
     override fun getCpuLoad(): Float = (synth.usage * 100f).toFloat()
 
     override fun getCurrentTime(): Double = synth.currentTime
+
+    override fun addControlListener(listener: ControlListener, intervalFrames: Int) {
+        controlTicker.add(listener, intervalFrames)
+    }
+
+    override fun removeControlListener(listener: ControlListener) {
+        controlTicker.remove(listener)
+    }
 }
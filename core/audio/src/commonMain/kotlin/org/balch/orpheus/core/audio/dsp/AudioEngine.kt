@@ -32,4 +32,27 @@ interface AudioEngine {
 
     /** Get current audio time in seconds */
     fun getCurrentTime(): Double
+
+    // Control rate
+    /**
+     * Call [listener] on the audio thread about every [intervalFrames] frames, for
+     * realtime control sources polled once per block (e.g. the latest hand state)
+     * without coroutines. Listeners must not block or allocate. Engines without an
+     * audio-thread hook never call it.
+     */
+    fun addControlListener(listener: ControlListener, intervalFrames: Int = DEFAULT_CONTROL_INTERVAL_FRAMES)
+
+    /** Stop calling [listener]; it may still run once if a block is in progress. */
+    fun removeControlListener(listener: ControlListener)
+
+    companion object {
+        /** About 1.3 ms at 48 kHz. */
+        const val DEFAULT_CONTROL_INTERVAL_FRAMES = 64
+    }
+}
+
+/** Audio-thread callback registered with [AudioEngine.addControlListener]. */
+fun interface ControlListener {
+    /** [frames] rendered since the previous call. */
+    fun onControlBlock(frames: Int)
 }
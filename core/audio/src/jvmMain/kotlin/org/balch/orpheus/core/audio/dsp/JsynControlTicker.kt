@@ -0,0 +1,44 @@
+package org.balch.orpheus.core.audio.dsp
+
+/**
+ * Portless JSyn unit that calls [ControlListener]s from the audio thread, each about
+ * every `intervalFrames` frames (rounded up to JSyn's 8-frame blocks).
+ *
+ * Listeners live in an array replaced on add/remove, so the audio thread iterates
+ * without locks or iterators.
+ */
+class JsynControlTicker : com.jsyn.unitgen.UnitGenerator() {
+
+    private class Entry(val listener: ControlListener, val intervalFrames: Int) {
+        var pendingFrames = 0
+    }
+
+    @Volatile
+    private var entries: Array<Entry> = emptyArray()
+
+    @Synchronized
+    fun add(listener: ControlListener, intervalFrames: Int) {
+        require(intervalFrames > 0) { "intervalFrames must be positive" }
+        entries = entries.filter { it.listener !== listener }.toTypedArray() +
+            Entry(listener, intervalFrames)
+    }
+
+    @Synchronized
+    fun remove(listener: ControlListener) {
+        entries = entries.filter { it.listener !== listener }.toTypedArray()
+    }
+
+    override fun generate(start: Int, limit: Int) {
+        val frames = limit - start
+        val current = entries
+        for (i in current.indices) {
+            val entry = current[i]
+            entry.pendingFrames += frames
+            if (entry.pendingFrames >= entry.intervalFrames) {
+                val elapsed = entry.pendingFrames
+                entry.pendingFrames = 0
+                entry.listener.onControlBlock(elapsed)
+            }
+        }
+    }
+}
@@ -2,7 +2,6 @@ package org.balch.orpheus.core.gestures
 
 import com.diamondedge.logging.logging
 import kotlin.math.abs
-import kotlin.math.sqrt
 
 /**
  * Rule-based ASL sign classifier using 21-point hand landmarks.
@@ -23,14 +22,18 @@ class AslSignClassifier(
     /**
      * Classify an ASL sign from hand landmarks and pre-computed finger states.
      * Returns (sign, confidence) or (null, 0) if no sign is recognized.
+     *
+     * @param features precomputed geometry for [landmarks]; derived when null.
      */
     fun classify(
         landmarks: List<HandLandmark>,
         fingers: List<FingerState>,
         handedness: Handedness,
+        features: HandFeatures? = null,
     ): Pair<AslSign?, Float> {
         require(landmarks.size == 21) { "Expected 21 landmarks, got ${landmarks.size}" }
         require(fingers.size == 5) { "Expected 5 finger states, got ${fingers.size}" }
+        val geometry = features ?: HandFeatures.compute(landmarks)
 
         val thumb = fingers[0]
         val index = fingers[1]
@@ -66,13 +69,13 @@ class AslSignClassifier(
         val middleRingSpread = abs(middleTip.x - ringTip.x)
 
         // Thumb-to-fingertip distances (for signs where thumb touches a finger)
-        val thumbIndexDist = dist(thumbTip, indexTip)
-        val thumbMiddleDist = dist(thumbTip, middleTip)
-        val thumbRingDist = dist(thumbTip, ringTip)
-        val thumbPinkyDist = dist(thumbTip, pinkyTip)
+        val thumbIndexDist = geometry.pinchDistance(Finger.INDEX)
+        val thumbMiddleDist = geometry.pinchDistance(Finger.MIDDLE)
+        val thumbRingDist = geometry.pinchDistance(Finger.RING)
+        val thumbPinkyDist = geometry.pinchDistance(Finger.PINKY)
 
         // Reference distance: wrist to middle MCP (normalizes for hand size)
-        val refDist = dist(wrist, middleMcp).coerceAtLeast(0.01f)
+        val refDist = geometry.handScale.coerceAtLeast(0.01f)
 
         // Normalized touch thresholds
         val touchThreshold = refDist * 0.35f
@@ -302,10 +305,4 @@ class AslSignClassifier(
             thumbTip.x < indexMcp.x && thumbTip.x > pinkyMcp.x
         }
     }
-
-    private fun dist(a: HandLandmark, b: HandLandmark): Float {
-        val dx = a.x - b.x
-        val dy = a.y - b.y
-        return sqrt(dx * dx + dy * dy)
-    }
 }
@@ -16,13 +16,19 @@ class GestureInterpreter(
 ) {
     private val log = logging("GestureInterpreter")
 
+    /**
+     * @param features precomputed geometry for [landmarks] (e.g. from the native
+     *   tracker); derived with [HandFeatures.compute] when null.
+     */
     fun interpret(
         landmarks: List<HandLandmark>,
         handedness: Handedness,
         gestureName: String? = null,
         gestureConfidence: Float = 0f,
+        features: HandFeatures? = null,
     ): GestureState {
         require(landmarks.size == 21) { "Expected 21 landmarks, got ${landmarks.size}" }
+        val geometry = features ?: HandFeatures.compute(landmarks)
 
         val thumbTip = landmarks[LandmarkIndex.THUMB_TIP]
         val indexTip = landmarks[LandmarkIndex.INDEX_TIP]
@@ -33,7 +39,7 @@ class GestureInterpreter(
         val ringMcp = landmarks[LandmarkIndex.RING_MCP]
 
         // Pinch: distance between thumb tip and index tip
-        val pinchDist = distance(thumbTip, indexTip)
+        val pinchDist = geometry.pinchDistance(Finger.INDEX)
         val isPinching = pinchDist < pinchThreshold
         val pinchStrength = (1f - (pinchDist / maxPinchDistance).coerceIn(0f, 1f))
 
@@ -46,14 +52,14 @@ class GestureInterpreter(
         val palmY = (wrist.y + middleMcp.y) / 2f
         // Apparent hand size: distance from wrist to middle MCP.
         // When hand moves toward camera, this grows; away, it shrinks.
-        val apparentSize = distance(wrist, middleMcp)
+        val apparentSize = geometry.handScale
 
         // Hand openness: average fingertip distance from palm center,
         // normalized by wrist-to-middle-MCP reference length.
         // 0.0 = tight fist, 1.0 = fully spread hand.
         val palmCenterX = palmX
         val palmCenterY = palmY
-        val refDist = distance(wrist, middleMcp)
+        val refDist = geometry.handScale
         val handOpenness = if (refDist > 0.001f) {
             val avgTipDist = LandmarkIndex.FINGERTIPS.map { idx ->
                 val tip = landmarks[idx]
@@ -104,7 +110,7 @@ class GestureInterpreter(
         val fingerCount = fingers.count { it.finger != Finger.THUMB && it.isExtended }
 
         // ASL sign: fuse rule-based and native ML classifiers
-        val ruleResult = aslClassifier.classify(landmarks, fingers, handedness)
+        val ruleResult = aslClassifier.classify(landmarks, fingers, handedness, geometry)
         val nativeSign = gestureName?.let { AslSign.fromLabel(it) }
         val nativeConf = if (nativeSign != null) gestureConfidence else 0f
 
@@ -198,10 +204,4 @@ class GestureInterpreter(
 
         return null to 0f
     }
-
-    private fun distance(a: HandLandmark, b: HandLandmark): Float {
-        val dx = a.x - b.x
-        val dy = a.y - b.y
-        return sqrt(dx * dx + dy * dy)
-    }
 }
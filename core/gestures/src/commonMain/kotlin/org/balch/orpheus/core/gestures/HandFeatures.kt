@@ -0,0 +1,119 @@
+package org.balch.orpheus.core.gestures
+
+import kotlin.math.acos
+import kotlin.math.sqrt
+
+/**
+ * Fixed geometric feature vector for one hand, computed once per frame and shared
+ * by [GestureInterpreter] and [AslSignClassifier] instead of each recomputing
+ * distances from the landmarks.
+ *
+ * On desktop the native bridge computes it alongside the landmarks (hand_features.cc,
+ * same layout); elsewhere [compute] derives it in Kotlin. Distances use x/y only,
+ * matching the consumers' thresholds; angles and the palm normal use x/y/z.
+ *
+ * @property values raw vector of [SIZE] floats, indexed by the constants below.
+ */
+class HandFeatures(val values: FloatArray) {
+
+    init {
+        require(values.size == SIZE) { "Expected $SIZE features, got ${values.size}" }
+    }
+
+    /** Wrist to middle MCP distance; grows as the hand approaches the camera. */
+    val handScale: Float get() = values[HAND_SCALE]
+
+    /** Fingertip to wrist distance in units of [handScale]. */
+    fun tipToWrist(finger: Finger): Float = values[TIP_TO_WRIST + finger.ordinal]
+
+    /** Angle in radians between the finger's first and last bone: 0 straight, PI folded back. */
+    fun curl(finger: Finger): Float = values[CURL + finger.ordinal]
+
+    val palmNormalX: Float get() = values[PALM_NORMAL]
+    val palmNormalY: Float get() = values[PALM_NORMAL + 1]
+    val palmNormalZ: Float get() = values[PALM_NORMAL + 2]
+
+    /** Thumb tip to [finger]'s tip distance; [finger] must not be [Finger.THUMB]. */
+    fun pinchDistance(finger: Finger): Float {
+        require(finger != Finger.THUMB) { "Pinch distance is measured from the thumb" }
+        return values[PINCH + finger.ordinal - 1]
+    }
+
+    companion object {
+        const val HAND_SCALE = 0
+        const val TIP_TO_WRIST = 1
+        const val CURL = 6
+        const val PALM_NORMAL = 11
+        const val PINCH = 14
+        const val SIZE = 18
+
+        private const val MIN_SCALE = 0.001f
+
+        /** First landmark of each finger chain (thumb CMC, then the MCPs); tips are base + 3. */
+        private val FINGER_BASE = intArrayOf(1, 5, 9, 13, 17)
+
+        /** Kotlin equivalent of the native feature pass, for trackers that don't supply one. */
+        fun compute(landmarks: List<HandLandmark>): HandFeatures {
+            require(landmarks.size == 21) { "Expected 21 landmarks, got ${landmarks.size}" }
+            val v = FloatArray(SIZE)
+            val wrist = landmarks[LandmarkIndex.WRIST]
+
+            val scale = dist2d(wrist, landmarks[LandmarkIndex.MIDDLE_MCP])
+            v[HAND_SCALE] = scale
+            val invScale = 1f / scale.coerceAtLeast(MIN_SCALE)
+
+            for (f in 0 until 5) {
+                val base = FINGER_BASE[f]
+                val tip = landmarks[base + 3]
+                v[TIP_TO_WRIST + f] = dist2d(tip, wrist) * invScale
+                v[CURL + f] = angle(
+                    landmarks[base], landmarks[base + 1],
+                    landmarks[base + 2], tip,
+                )
+            }
+
+            val indexMcp = landmarks[LandmarkIndex.INDEX_MCP]
+            val pinkyMcp = landmarks[LandmarkIndex.PINKY_MCP]
+            val ax = indexMcp.x - wrist.x
+            val ay = indexMcp.y - wrist.y
+            val az = indexMcp.z - wrist.z
+            val bx = pinkyMcp.x - wrist.x
+            val by = pinkyMcp.y - wrist.y
+            val bz = pinkyMcp.z - wrist.z
+            val nx = ay * bz - az * by
+            val ny = az * bx - ax * bz
+            val nz = ax * by - ay * bx
+            val len = sqrt(nx * nx + ny * ny + nz * nz)
+            val invLen = if (len > 1e-12f) 1f / len else 0f
+            v[PALM_NORMAL] = nx * invLen
+            v[PALM_NORMAL + 1] = ny * invLen
+            v[PALM_NORMAL + 2] = nz * invLen
+
+            val thumbTip = landmarks[LandmarkIndex.THUMB_TIP]
+            for (f in 1 until 5) {
+                v[PINCH + f - 1] = dist2d(thumbTip, landmarks[FINGER_BASE[f] + 3])
+            }
+            return HandFeatures(v)
+        }
+
+        private fun dist2d(a: HandLandmark, b: HandLandmark): Float {
+            val dx = a.x - b.x
+            val dy = a.y - b.y
+            return sqrt(dx * dx + dy * dy)
+        }
+
+        /** Angle between bone a0->a1 and bone b0->b1, 0 if either is degenerate. */
+        private fun angle(a0: HandLandmark, a1: HandLandmark, b0: HandLandmark, b1: HandLandmark): Float {
+            val ax = a1.x - a0.x
+            val ay = a1.y - a0.y
+            val az = a1.z - a0.z
+            val bx = b1.x - b0.x
+            val by = b1.y - b0.y
+            val bz = b1.z - b0.z
+            val denom = sqrt((ax * ax + ay * ay + az * az) * (bx * bx + by * by + bz * bz))
+            if (denom <= 1e-12f) return 0f
+            val c = ((ax * bx + ay * by + az * bz) / denom).coerceIn(-1f, 1f)
+            return acos(c)
+        }
+    }
+}
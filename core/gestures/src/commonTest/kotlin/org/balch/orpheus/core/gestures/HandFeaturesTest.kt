@@ -0,0 +1,94 @@
+package org.balch.orpheus.core.gestures
+
+import kotlin.math.PI
+import kotlin.math.abs
+import kotlin.test.Test
+import kotlin.test.assertEquals
+import kotlin.test.assertFailsWith
+
+class HandFeaturesTest {
+
+    /** Build 21 landmarks with all at (0.5, 0.5, 0) by default. */
+    private fun landmarks(
+        vararg overrides: Pair<Int, HandLandmark>
+    ): List<HandLandmark> {
+        val base = List(21) { HandLandmark(0.5f, 0.5f, 0f) }
+        return base.toMutableList().apply {
+            overrides.forEach { (i, lm) -> this[i] = lm }
+        }
+    }
+
+    /** Flat hand pointing up: straight fingers fanned above the wrist. */
+    private fun openHand(): List<HandLandmark> {
+        val lms = MutableList(21) { HandLandmark(0.5f, 0.8f, 0f) }
+        val baseX = floatArrayOf(0.35f, 0.40f, 0.50f, 0.60f, 0.70f)
+        for (f in 0 until 5) {
+            for (j in 0 until 4) {
+                lms[1 + f * 4 + j] = HandLandmark(baseX[f], 0.6f - j * 0.1f, 0f)
+            }
+        }
+        return lms
+    }
+
+    @Test
+    fun `hand scale is wrist to middle MCP distance`() {
+        val lms = landmarks(
+            LandmarkIndex.WRIST to HandLandmark(0.5f, 0.8f, 0f),
+            LandmarkIndex.MIDDLE_MCP to HandLandmark(0.5f, 0.5f, 0f),
+        )
+        assertEquals(0.3f, HandFeatures.compute(lms).handScale, 1e-5f)
+    }
+
+    @Test
+    fun `tip to wrist is normalized by hand scale`() {
+        val features = HandFeatures.compute(openHand())
+        // Middle tip at y=0.3, wrist at y=0.8, middle MCP at y=0.6.
+        assertEquals(0.5f / 0.2f, features.tipToWrist(Finger.MIDDLE), 1e-4f)
+    }
+
+    @Test
+    fun `straight fingers have zero curl`() {
+        val features = HandFeatures.compute(openHand())
+        Finger.entries.forEach { assertEquals(0f, features.curl(it), 1e-4f) }
+    }
+
+    @Test
+    fun `finger folded back has curl of pi`() {
+        val lms = openHand().toMutableList()
+        // Index: MCP (0.4,0.6) -> PIP (0.4,0.5), DIP (0.4,0.45) -> TIP (0.4,0.55)
+        lms[LandmarkIndex.INDEX_DIP] = HandLandmark(0.4f, 0.45f, 0f)
+        lms[LandmarkIndex.INDEX_TIP] = HandLandmark(0.4f, 0.55f, 0f)
+        assertEquals(PI.toFloat(), HandFeatures.compute(lms).curl(Finger.INDEX), 1e-4f)
+    }
+
+    @Test
+    fun `palm normal of a flat hand points along z`() {
+        val features = HandFeatures.compute(openHand())
+        assertEquals(0f, features.palmNormalX, 1e-5f)
+        assertEquals(0f, features.palmNormalY, 1e-5f)
+        assertEquals(1f, abs(features.palmNormalZ), 1e-5f)
+    }
+
+    @Test
+    fun `pinch distances are measured from the thumb tip`() {
+        val lms = landmarks(
+            LandmarkIndex.THUMB_TIP to HandLandmark(0.5f, 0.5f, 0f),
+            LandmarkIndex.INDEX_TIP to HandLandmark(0.53f, 0.54f, 0f),
+        )
+        val features = HandFeatures.compute(lms)
+        assertEquals(0.05f, features.pinchDistance(Finger.INDEX), 1e-5f)
+        assertEquals(0f, features.pinchDistance(Finger.PINKY), 1e-5f)
+        assertFailsWith<IllegalArgumentException> { features.pinchDistance(Finger.THUMB) }
+    }
+
+    @Test
+    fun `interpreter uses supplied features`() {
+        val lms = landmarks()
+        val values = HandFeatures.compute(lms).values.copyOf()
+        values[HandFeatures.HAND_SCALE] = 0.25f
+        val state = GestureInterpreter().interpret(
+            lms, Handedness.RIGHT, features = HandFeatures(values),
+        )
+        assertEquals(0.25f, state.apparentSize, 1e-6f)
+    }
+}
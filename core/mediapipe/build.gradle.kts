@@ -12,6 +12,14 @@ kotlin {
     }
 
     sourceSets {
+        // MediaPipeJni and its result ring: the desktop bridge and its Android build
+        // share one native library and one binding.
+        val jniMain by creating {
+            dependsOn(commonMain.get())
+        }
+        jvmMain.get().dependsOn(jniMain)
+        androidMain.get().dependsOn(jniMain)
+
         commonMain.dependencies {
             api(project(":core:gestures"))
             implementation(project(":core:foundation"))
@@ -3,6 +3,7 @@ package org.balch.orpheus.core.mediapipe
 import android.content.Context
 import android.content.pm.PackageManager
 import android.graphics.Bitmap
+import android.graphics.ImageFormat
 import android.graphics.Matrix
 import android.os.Handler
 import android.os.Looper
@@ -17,6 +18,7 @@ import androidx.lifecycle.LifecycleOwner
 import androidx.lifecycle.LifecycleRegistry
 import com.google.mediapipe.framework.image.BitmapImageBuilder
 import com.google.mediapipe.tasks.core.BaseOptions
+import com.google.mediapipe.tasks.core.Delegate
 import com.google.mediapipe.tasks.vision.core.RunningMode
 import com.google.mediapipe.tasks.vision.gesturerecognizer.GestureRecognizer
 import com.google.mediapipe.tasks.vision.gesturerecognizer.GestureRecognizerResult
@@ -30,8 +32,15 @@ import kotlinx.coroutines.flow.asSharedFlow
 import kotlinx.coroutines.flow.asStateFlow
 import org.balch.orpheus.core.gestures.HandLandmark
 import org.balch.orpheus.core.gestures.Handedness
+import java.io.IOException
+import java.nio.Buffer
 import java.nio.ByteBuffer
+import java.nio.ByteOrder
 import java.util.concurrent.Executors
+import java.util.concurrent.TimeUnit
+import java.util.concurrent.locks.ReentrantReadWriteLock
+import kotlin.concurrent.read
+import kotlin.concurrent.write
 
 /**
  * Android implementation of [HandTracker] using MediaPipe GestureRecognizer in LIVE_STREAM mode,
@@ -40,16 +49,39 @@ import java.util.concurrent.Executors
  * This tracker self-manages the front camera via CameraX — no external camera setup needed.
  * Call [start] to begin tracking and [stop] to release the camera.
  *
+ * With [nativeBridge], when the APK bundles `libmediapipe_jni.so` (built by
+ * `build-native-mediapipe.sh --android`), the desktop's native bridge runs instead of
+ * MediaPipe Tasks: CameraX's upright YUV_420_888 planes go straight to
+ * [MediaPipeJni.preprocessYuvFrame], which fills the RGBA preview and the inference
+ * frame natively, and results arrive through a [ResultRing] with the same smoothing,
+ * gesture schedule, prediction ([sampleLandmarks]) and lock-free snapshot
+ * ([readLatest]) as on desktop. Without the library, or when the native tracker can't
+ * be created, the Tasks path below is used.
+ *
  * @param context Android application context.
  * @param gestureModelAssetPath path to the gesture_recognizer.task model in assets.
  * @param landmarkerModelAssetPath fallback path to the hand_landmarker.task model in assets.
+ * @param options hand count, confidence thresholds and delegate for either model.
+ * @param nativeBridge use the native bridge where it is bundled.
  */
 class AndroidHandTracker(
     private val context: Context,
     private val gestureModelAssetPath: String = "models/gesture_recognizer.task",
     private val landmarkerModelAssetPath: String = "models/hand_landmarker.task",
+    private val options: HandTrackerOptions = HandTrackerOptions(),
+    private val nativeBridge: Boolean = true,
 ) : HandTracker {
 
+    private companion object {
+        const val TAG = "AndroidHandTracker"
+
+        /** Synthetic frames run through a new native tracker before the camera's first. */
+        const val WARM_UP_ITERATIONS = 3
+
+        /** Preview arrays in rotation, as in the desktop's CameraFramePool. */
+        const val PREVIEW_DEPTH = 3
+    }
+
     private val _results = MutableSharedFlow<HandTrackingResult?>(extraBufferCapacity = 1)
     override val results: Flow<HandTrackingResult?> = _results.asSharedFlow()
 
@@ -65,39 +97,227 @@ class AndroidHandTracker(
     private var lifecycleOwner: TrackerLifecycleOwner? = null
     private var analysisExecutor = Executors.newSingleThreadExecutor()
 
-    // Pre-allocated buffers to reduce GC pressure at 30fps
+    // Pre-allocated buffers to reduce GC pressure at 30fps. Buffer position calls go
+    // through java.nio.Buffer: the covariant ByteBuffer/FloatBuffer overrides
+    // compileSdk resolves to only exist from API 34.
     private var reusableMirrorBitmap: Bitmap? = null
-    private var reusableFrameBuffer: ByteBuffer? = null
+
+    // Rotating RGBA arrays behind published [CameraFrame]s: one is rewritten every
+    // PREVIEW_DEPTH frames, so a consumer still drawing a frame that old sees newer
+    // pixels instead of each frame allocating its own. Analysis thread only.
+    private val previewPixels = arrayOfNulls<ByteArray>(PREVIEW_DEPTH)
+    private var previewIndex = -1
+    private var previewSequence = 0L
+
+    // Native bridge path: the tracker is created, fed and closed only on the
+    // analysis thread, sized for the first frame the camera delivers.
+    @Volatile
+    private var nativeMode: Boolean = false
+
+    @Volatile
+    private var nativePtr: Long = 0
+    private var nativeGestures: Boolean = false
+    private var nativeGeometry: MediaPipeJni.CaptureGeometry? = null
+    private var nativeFailed: Boolean = false
+
+    // Serializes closing the native handle (write lock) against [sampleLandmarks]
+    // and [readLatest] polling, as on desktop.
+    private val handleLock = ReentrantReadWriteLock()
+
+    // Per polling thread: [readLatest] needs a direct buffer to copy into.
+    private val latestBuffers = ThreadLocal.withInitial {
+        ByteBuffer.allocateDirect(ResultRing.SLOT_FLOATS * Float.SIZE_BYTES)
+            .order(ByteOrder.nativeOrder())
+            .asFloatBuffer()
+    }
+
+    // Direct buffers the native side writes the RGBA preview and inference frame into.
+    private var previewBuffer: ByteBuffer? = null
+    private var rgbBuffer: ByteBuffer? = null
+
+    private val resultRing = ResultRing()
+
+    /** Native result delivery (gesture worker or MediaPipe thread). */
+    private val slotCallback = object : MediaPipeJni.SlotCallback {
+        override fun onSlot(slot: Int, timestampMs: Long) {
+            _results.tryEmit(resultRing.result(slot, timestampMs))
+        }
+    }
 
     override fun start() {
-        if (gestureRecognizer != null || handLandmarker != null) return
+        if (gestureRecognizer != null || handLandmarker != null || nativeMode) return
 
         // Recreate executor if it was shut down by a previous stop() call
         if (analysisExecutor.isShutdown) {
+            val previous = analysisExecutor
             analysisExecutor = Executors.newSingleThreadExecutor()
+            // The last session's native close may still be queued there; it must run
+            // before this session's first frame creates a tracker.
+            analysisExecutor.execute { previous.awaitTermination(Long.MAX_VALUE, TimeUnit.NANOSECONDS) }
+        }
+
+        nativeMode = nativeBridge && loadNativeBridge()
+        if (!nativeMode && !createTaskTracker()) return
+
+        // Set up CameraX with a synthetic LifecycleOwner
+        val owner = TrackerLifecycleOwner()
+        lifecycleOwner = owner
+        owner.start()
+
+        bindCamera(owner)
+    }
+
+    /**
+     * Bind the front camera's analysis stream to [owner] once the camera provider
+     * resolves, in the format the current path reads: upright YUV_420_888 for the
+     * native bridge, RGBA_8888 for MediaPipe Tasks. Main thread.
+     */
+    private fun bindCamera(owner: TrackerLifecycleOwner) {
+        val cameraProviderFuture = ProcessCameraProvider.getInstance(context)
+        cameraProviderFuture.addListener({
+            // Guard against rapid toggle — if stop() was called before provider resolved
+            if (lifecycleOwner !== owner) return@addListener
+
+            val cameraProvider = cameraProviderFuture.get()
+
+            val resolutionSelector = ResolutionSelector.Builder()
+                .setResolutionStrategy(
+                    ResolutionStrategy(
+                        android.util.Size(640, 480),
+                        ResolutionStrategy.FALLBACK_RULE_CLOSEST_LOWER_THEN_HIGHER,
+                    )
+                )
+                .build()
+
+            // The native bridge converts YUV itself; CameraX only rotates it upright.
+            val imageAnalysis = ImageAnalysis.Builder()
+                .setResolutionSelector(resolutionSelector)
+                .setBackpressureStrategy(ImageAnalysis.STRATEGY_KEEP_ONLY_LATEST)
+                .setOutputImageFormat(
+                    if (nativeMode) {
+                        ImageAnalysis.OUTPUT_IMAGE_FORMAT_YUV_420_888
+                    } else {
+                        ImageAnalysis.OUTPUT_IMAGE_FORMAT_RGBA_8888
+                    }
+                )
+                .setOutputImageRotationEnabled(nativeMode)
+                .build()
+
+            imageAnalysis.setAnalyzer(analysisExecutor) { imageProxy ->
+                // Guard against stop() called while analysis is in flight
+                if (lifecycleOwner == null) {
+                    imageProxy.close()
+                    return@setAnalyzer
+                }
+                when {
+                    nativeMode -> processNativeFrame(imageProxy, owner)
+                    // Still bound for the native path until the Tasks fallback rebinds.
+                    imageProxy.format == ImageFormat.YUV_420_888 -> imageProxy.close()
+                    else -> processImageProxy(imageProxy)
+                }
+            }
+
+            val cameraSelector = CameraSelector.Builder()
+                .requireLensFacing(CameraSelector.LENS_FACING_FRONT)
+                .build()
+
+            cameraProvider.unbindAll()
+            cameraProvider.bindToLifecycle(owner, cameraSelector, imageAnalysis)
+        }, { command -> Handler(Looper.getMainLooper()).post(command) })
+    }
+
+    override fun stop() {
+        lifecycleOwner?.stop()
+        lifecycleOwner = null
+        // Queued behind any frame still in flight on the analysis thread, which may be
+        // loading models or warming up a native tracker: the caller (main thread)
+        // doesn't wait for it.
+        val closeNative = nativeMode
+        if (!analysisExecutor.isShutdown) {
+            analysisExecutor.execute {
+                if (closeNative) closeNativeTracker()
+                // A session that fell back to Tasks leaves it set; the next one retries.
+                nativeFailed = false
+                previewPixels.fill(null)
+            }
         }
+        nativeMode = false
+        gestureRecognizer?.close()
+        gestureRecognizer = null
+        handLandmarker?.close()
+        handLandmarker = null
+        useGestureRecognizer = false
+        analysisExecutor.shutdown()
+        reusableMirrorBitmap?.recycle()
+        reusableMirrorBitmap = null
+    }
+
+    override fun stats(): HandTrackerStats? {
+        if (!MediaPipeJni.isInitialized || MediaPipeJni.isLegacyBridge) return null
+        return HandTrackerStats.fromPacked(MediaPipeJni.getStats())
+    }
+
+    override fun sampleLandmarks(out: FloatArray): Int = handleLock.read {
+        val ptr = nativePtr
+        if (ptr == 0L) 0 else MediaPipeJni.sampleLandmarks(ptr, out)
+    }
+
+    override fun readLatest(out: FloatArray): Long {
+        require(out.size >= HandTracker.LATEST_FLOATS) {
+            "out must hold ${HandTracker.LATEST_FLOATS} floats"
+        }
+        val lock = handleLock.readLock()
+        if (!lock.tryLock()) return -1
+        try {
+            val ptr = nativePtr
+            if (ptr == 0L) return 0
+            val buffer = latestBuffers.get()
+            val sequence = MediaPipeJni.readLatest(ptr, buffer)
+            // Relative get: the absolute bulk overload needs API 35.
+            if (sequence > 0) {
+                (buffer as Buffer).position(0)
+                buffer.get(out, 0, HandTracker.LATEST_FLOATS)
+            }
+            return sequence
+        } finally {
+            lock.unlock()
+        }
+    }
 
+    override fun latestGestureName(id: Int): String? = handleLock.read {
+        val ptr = nativePtr
+        if (ptr == 0L) null else MediaPipeJni.latestGestureName(ptr, id)
+    }
+
+    /**
+     * Create the MediaPipe Tasks GestureRecognizer, or the HandLandmarker if the gesture
+     * model is missing.
+     *
+     * @return false (logged) if neither could be created.
+     */
+    private fun createTaskTracker(): Boolean {
         // Try GestureRecognizer first — it provides landmarks + gesture classification in one pass.
         // Fall back to HandLandmarker if the gesture model is missing.
         val started = try {
             val baseOptions = BaseOptions.builder()
                 .setModelAssetPath(gestureModelAssetPath)
+                .setDelegate(options.delegate.toMediaPipe())
                 .build()
 
-            val options = GestureRecognizer.GestureRecognizerOptions.builder()
+            val recognizerOptions = GestureRecognizer.GestureRecognizerOptions.builder()
                 .setBaseOptions(baseOptions)
                 .setRunningMode(RunningMode.LIVE_STREAM)
-                .setNumHands(2)
-                .setMinHandDetectionConfidence(0.5f)
-                .setMinHandPresenceConfidence(0.5f)
-                .setMinTrackingConfidence(0.5f)
+                .setNumHands(options.numHands)
+                .setMinHandDetectionConfidence(options.minHandDetectionConfidence)
+                .setMinHandPresenceConfidence(options.minHandPresenceConfidence)
+                .setMinTrackingConfidence(options.minTrackingConfidence)
                 .setResultListener(::onGestureResult)
                 .setErrorListener { _ ->
                     _results.tryEmit(null)
                 }
                 .build()
 
-            gestureRecognizer = GestureRecognizer.createFromOptions(context, options)
+            gestureRecognizer = GestureRecognizer.createFromOptions(context, recognizerOptions)
             useGestureRecognizer = true
             android.util.Log.i("AndroidHandTracker", "Using GestureRecognizer")
             true
@@ -110,88 +330,199 @@ class AndroidHandTracker(
             try {
                 val baseOptions = BaseOptions.builder()
                     .setModelAssetPath(landmarkerModelAssetPath)
+                    .setDelegate(options.delegate.toMediaPipe())
                     .build()
 
-                val options = HandLandmarker.HandLandmarkerOptions.builder()
+                val landmarkerOptions = HandLandmarker.HandLandmarkerOptions.builder()
                     .setBaseOptions(baseOptions)
                     .setRunningMode(RunningMode.LIVE_STREAM)
-                    .setNumHands(2)
-                    .setMinHandDetectionConfidence(0.5f)
-                    .setMinHandPresenceConfidence(0.5f)
-                    .setMinTrackingConfidence(0.5f)
+                    .setNumHands(options.numHands)
+                    .setMinHandDetectionConfidence(options.minHandDetectionConfidence)
+                    .setMinHandPresenceConfidence(options.minHandPresenceConfidence)
+                    .setMinTrackingConfidence(options.minTrackingConfidence)
                     .setResultListener(::onLandmarkerResult)
                     .setErrorListener { _ ->
                         _results.tryEmit(null)
                     }
                     .build()
 
-                handLandmarker = HandLandmarker.createFromOptions(context, options)
+                handLandmarker = HandLandmarker.createFromOptions(context, landmarkerOptions)
                 useGestureRecognizer = false
                 android.util.Log.i("AndroidHandTracker", "Using HandLandmarker (fallback)")
             } catch (e: Throwable) {
                 android.util.Log.e("AndroidHandTracker", "Failed to create HandLandmarker", e)
                 _results.tryEmit(null)
-                return
+                return false
             }
         }
+        return true
+    }
 
-        // Set up CameraX with a synthetic LifecycleOwner
-        val owner = TrackerLifecycleOwner()
-        lifecycleOwner = owner
-        owner.start()
+    /** Load the native bridge, or false (logged) for the Tasks path. */
+    private fun loadNativeBridge(): Boolean = try {
+        MediaPipeJni.initialize(options.delegate)
+        // The YUV path needs the current natives; a version-0 build has none of them.
+        check(!MediaPipeJni.isLegacyBridge) { "bundled bridge predates versioning" }
+        android.util.Log.i(TAG, "Using the native MediaPipe bridge")
+        true
+    } catch (e: Throwable) {
+        android.util.Log.i(TAG, "Native MediaPipe bridge not bundled, using MediaPipe Tasks: ${e.message}")
+        false
+    }
 
-        val cameraProviderFuture = ProcessCameraProvider.getInstance(context)
-        cameraProviderFuture.addListener({
-            // Guard against rapid toggle — if stop() was called before provider resolved
-            val currentOwner = lifecycleOwner ?: return@addListener
+    /**
+     * Run one YUV_420_888 frame through the native bridge: an RGBA preview for
+     * [cameraFrame] and the mirrored, hand-cropped inference frame, both written natively
+     * from the camera's planes, then async detection. Analysis thread only.
+     */
+    private fun processNativeFrame(imageProxy: ImageProxy, owner: TrackerLifecycleOwner) {
+        try {
+            val width = imageProxy.width
+            val height = imageProxy.height
+            if (!acquireNativeTracker(MediaPipeJni.CaptureGeometry(width, height, mirrored = true), owner)) return
+
+            val timestampMs = imageProxy.imageInfo.timestamp / 1_000_000 // ns → ms
+            val (y, u, v) = imageProxy.planes
+            val preview = reusableDirectBuffer(previewBuffer, width * height * 4).also { previewBuffer = it }
+            val squareSize = MediaPipeJni.squareSize(width, height)
+            val rgb = reusableDirectBuffer(rgbBuffer, squareSize * squareSize * 3).also { rgbBuffer = it }
+            val size = MediaPipeJni.preprocessYuvFrame(
+                nativePtr, y.buffer, y.rowStride, u.buffer, v.buffer, u.rowStride, u.pixelStride,
+                width, height, true, preview, rgb, timestampMs, previewRgba = true,
+            )
+            publishPreview(preview, width, height)
 
-            val cameraProvider = cameraProviderFuture.get()
+            if (nativeGestures) {
+                // A rejected frame just means the worker is still busy or recovering.
+                MediaPipeJni.recognizeGestureAsync(nativePtr, rgb, size, size, timestampMs)
+            } else {
+                MediaPipeJni.detectAsync(nativePtr, rgb, size, size, timestampMs)
+            }
+        } catch (e: Exception) {
+            android.util.Log.w(TAG, "Native frame failed", e)
+            _results.tryEmit(null)
+        } finally {
+            imageProxy.close()
+        }
+    }
 
-            val resolutionSelector = ResolutionSelector.Builder()
-                .setResolutionStrategy(
-                    ResolutionStrategy(
-                        android.util.Size(640, 480),
-                        ResolutionStrategy.FALLBACK_RULE_CLOSEST_LOWER_THEN_HIGHER,
-                    )
-                )
-                .build()
+    /**
+     * Make [nativePtr] a tracker for [geometry], creating (and warming up) a new one when
+     * the camera's frame size changes. If that fails, [owner]'s session falls back to
+     * MediaPipe Tasks ([fallBackToTasks]).
+     *
+     * @return false if no tracker could be created; that is logged once.
+     */
+    private fun acquireNativeTracker(geometry: MediaPipeJni.CaptureGeometry, owner: TrackerLifecycleOwner): Boolean {
+        if (nativePtr != 0L && nativeGeometry == geometry) return true
+        if (nativeFailed) return false
+        closeNativeTracker()
+        try {
+            createNativeTracker(geometry)
+            nativeGeometry = geometry
+            MediaPipeJni.warmUp(nativePtr, WARM_UP_ITERATIONS)
+            return true
+        } catch (e: Exception) {
+            android.util.Log.e(TAG, "Failed to create the native hand tracker", e)
+            closeNativeTracker()
+            nativeFailed = true
+            Handler(Looper.getMainLooper()).post { fallBackToTasks(owner) }
+            return false
+        }
+    }
 
-            val imageAnalysis = ImageAnalysis.Builder()
-                .setResolutionSelector(resolutionSelector)
-                .setBackpressureStrategy(ImageAnalysis.STRATEGY_KEEP_ONLY_LATEST)
-                .setOutputImageFormat(ImageAnalysis.OUTPUT_IMAGE_FORMAT_RGBA_8888)
-                .build()
+    /**
+     * The native tracker couldn't be created: run [owner]'s session on MediaPipe Tasks
+     * instead, as when the bridge fails to load in [start], and rebind the camera for
+     * RGBA frames. Main thread; a no-op once that session has stopped.
+     */
+    private fun fallBackToTasks(owner: TrackerLifecycleOwner) {
+        if (lifecycleOwner !== owner || !nativeMode) return
+        android.util.Log.w(TAG, "Native hand tracker unavailable, falling back to MediaPipe Tasks")
+        nativeMode = false
+        if (!createTaskTracker()) return
+        bindCamera(owner)
+    }
 
-            imageAnalysis.setAnalyzer(analysisExecutor) { imageProxy ->
-                // Guard against stop() called while analysis is in flight
-                if (lifecycleOwner == null) {
-                    imageProxy.close()
-                    return@setAnalyzer
-                }
-                processImageProxy(imageProxy)
+    /**
+     * Create the native GestureRecognizer for [geometry], or the HandLandmarker if the
+     * gesture model is missing, with the desktop's ring, smoothing and gesture schedule.
+     */
+    private fun createNativeTracker(geometry: MediaPipeJni.CaptureGeometry) {
+        val landmarkerModel = assetBuffer(landmarkerModelAssetPath)
+        val gestureModel = assetBuffer(gestureModelAssetPath)
+        if (gestureModel != null) {
+            nativePtr = MediaPipeJni.createGestureRecognizer(gestureModel, options, geometry)
+            nativeGestures = true
+            if (landmarkerModel != null) {
+                MediaPipeJni.setGestureSchedule(nativePtr, landmarkerModel, MediaPipeJni.GestureSchedule())
             }
+        } else {
+            nativePtr = MediaPipeJni.createLandmarker(
+                landmarkerModel ?: throw IOException("No hand landmarker model at $landmarkerModelAssetPath"),
+                options, geometry,
+            )
+            nativeGestures = false
+            // Bounded latency beats processing every frame.
+            MediaPipeJni.setFlowControl(nativePtr, 1, MediaPipeJni.DropPolicy.DROP_OLDEST)
+        }
+        if (options.delegate == InferenceDelegate.GPU) {
+            android.util.Log.i(TAG, "Hand tracking inference on ${MediaPipeJni.delegate(nativePtr)}")
+        }
+        MediaPipeJni.setResultRing(nativePtr, resultRing, slotCallback)
+        MediaPipeJni.setLandmarkSmoothing(nativePtr, MediaPipeJni.LandmarkSmoothing())
+    }
 
-            val cameraSelector = CameraSelector.Builder()
-                .requireLensFacing(CameraSelector.LENS_FACING_FRONT)
-                .build()
+    /** Close the native tracker, if any. Analysis thread only. */
+    private fun closeNativeTracker() = handleLock.write {
+        val ptr = nativePtr
+        if (ptr == 0L) return@write
+        try {
+            if (nativeGestures) {
+                MediaPipeJni.closeGestureRecognizer(ptr)
+            } else {
+                MediaPipeJni.closeLandmarker(ptr)
+            }
+        } catch (_: Exception) { /* Ignore cleanup errors. */ }
+        nativePtr = 0
+        nativeGeometry = null
+        nativeFailed = false
+    }
 
-            cameraProvider.unbindAll()
-            cameraProvider.bindToLifecycle(currentOwner, cameraSelector, imageAnalysis)
-        }, { command -> Handler(Looper.getMainLooper()).post(command) })
+    /** [path]'s bytes from the APK assets in a direct buffer, or null if it isn't bundled. */
+    private fun assetBuffer(path: String): ByteBuffer? = try {
+        val bytes = context.assets.open(path).use { it.readBytes() }
+        ByteBuffer.allocateDirect(bytes.size).apply { put(bytes); (this as Buffer).flip() }
+    } catch (_: IOException) {
+        null
     }
 
-    override fun stop() {
-        lifecycleOwner?.stop()
-        lifecycleOwner = null
-        gestureRecognizer?.close()
-        gestureRecognizer = null
-        handLandmarker?.close()
-        handLandmarker = null
-        useGestureRecognizer = false
-        analysisExecutor.shutdown()
-        reusableMirrorBitmap?.recycle()
-        reusableMirrorBitmap = null
-        reusableFrameBuffer = null
+    private fun reusableDirectBuffer(existing: ByteBuffer?, bytes: Int): ByteBuffer =
+        if (existing != null && existing.capacity() >= bytes) existing else ByteBuffer.allocateDirect(bytes)
+
+    /** Publish the RGBA [preview] written by the native side, copied into the next pooled array. */
+    private fun publishPreview(preview: ByteBuffer, width: Int, height: Int) {
+        val pixels = nextPreviewPixels(width, height)
+        (preview as Buffer).rewind()
+        preview.get(pixels)
+        publishPreviewPixels(pixels, width, height)
+    }
+
+    /** Advance to the next pooled preview array, sized for a [width] x [height] frame. */
+    private fun nextPreviewPixels(width: Int, height: Int): ByteArray {
+        previewIndex = (previewIndex + 1) % PREVIEW_DEPTH
+        val bytes = width * height * 4
+        previewPixels[previewIndex]?.let { if (it.size == bytes) return it }
+        return ByteArray(bytes).also { previewPixels[previewIndex] = it }
+    }
+
+    private fun publishPreviewPixels(pixels: ByteArray, width: Int, height: Int) {
+        _cameraFrame.value = CameraFrame(
+            pixels = pixels,
+            width = width,
+            height = height,
+            sequence = previewSequence++,
+        )
     }
 
     /**
@@ -211,14 +542,14 @@ class AndroidHandTracker(
         val rawBitmap = Bitmap.createBitmap(width, height, Bitmap.Config.ARGB_8888)
         if (rowStride == width * pixelStride) {
             // No padding — direct copy
-            buffer.rewind()
+            (buffer as Buffer).rewind()
             rawBitmap.copyPixelsFromBuffer(buffer)
         } else {
             // Row stride has padding — copy row by row
             val rowBuffer = ByteArray(rowStride)
             val pixels = IntArray(width)
             for (y in 0 until height) {
-                buffer.position(y * rowStride)
+                (buffer as Buffer).position(y * rowStride)
                 buffer.get(rowBuffer, 0, rowStride)
                 for (x in 0 until width) {
                     val i = x * pixelStride
@@ -367,27 +698,9 @@ class AndroidHandTracker(
     }
 
     private fun publishCameraFrame(bitmap: Bitmap) {
-        val width = bitmap.width
-        val height = bitmap.height
-        val requiredSize = width * height * 4
-        val buffer = reusableFrameBuffer.let { existing ->
-            if (existing != null && existing.capacity() >= requiredSize) {
-                existing.clear()
-                existing
-            } else {
-                ByteBuffer.allocate(requiredSize).also { reusableFrameBuffer = it }
-            }
-        }
-        bitmap.copyPixelsToBuffer(buffer)
-        // CameraFrame needs its own copy since the buffer is reused
-        val pixels = ByteArray(requiredSize)
-        buffer.rewind()
-        buffer.get(pixels)
-        _cameraFrame.value = CameraFrame(
-            pixels = pixels,
-            width = width,
-            height = height,
-        )
+        val pixels = nextPreviewPixels(bitmap.width, bitmap.height)
+        bitmap.copyPixelsToBuffer(ByteBuffer.wrap(pixels))
+        publishPreviewPixels(pixels, bitmap.width, bitmap.height)
     }
 
     /**
@@ -417,3 +730,8 @@ class AndroidHandTracker(
         }
     }
 }
+
+private fun InferenceDelegate.toMediaPipe(): Delegate = when (this) {
+    InferenceDelegate.CPU -> Delegate.CPU
+    InferenceDelegate.GPU -> Delegate.GPU
+}
@@ -0,0 +1,22 @@
+package org.balch.orpheus.core.mediapipe
+
+import java.util.logging.Logger
+
+private val logger = Logger.getLogger(MediaPipeJni::class.java.name)
+
+/**
+ * Load the library from the APK's `jniLibs` (built by `build-native-mediapipe.sh
+ * --android`). Throws [UnsatisfiedLinkError] when the app was packaged without it.
+ */
+internal actual fun loadMediaPipeLibrary(delegate: InferenceDelegate): MediaPipeLibrary {
+    if (delegate == InferenceDelegate.GPU) {
+        try {
+            System.loadLibrary("mediapipe_jni_gpu")
+            return MediaPipeLibrary("libmediapipe_jni_gpu.so", gpu = true)
+        } catch (_: UnsatisfiedLinkError) {
+            logger.info("No libmediapipe_jni_gpu.so in the APK, GPU requests will run on CPU")
+        }
+    }
+    System.loadLibrary("mediapipe_jni")
+    return MediaPipeLibrary("libmediapipe_jni.so", gpu = false)
+}
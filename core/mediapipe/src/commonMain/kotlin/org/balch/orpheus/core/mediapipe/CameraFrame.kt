@@ -3,23 +3,41 @@ package org.balch.orpheus.core.mediapipe
 /**
  * Platform-agnostic camera frame data.
  * Pixels are stored as BGRA_8888 packed into a ByteArray
- * (matches Skia ColorType.BGRA_8888 on Desktop and Android Bitmap ARGB_8888).
+ * (matches Skia ColorType.BGRA_8888 on Desktop and Android Bitmap ARGB_8888),
+ * or — for pooled desktop frames — in native memory at [pixelAddress], in which
+ * case [pixels] is empty.
+ *
+ * @property pixelAddress address of `width * height * 4` BGRA bytes, or 0.
+ * @property pixelOwner keeps the memory at [pixelAddress] alive while the frame is.
+ * @property sequence distinguishes pooled frames that reuse the same memory.
  */
 data class CameraFrame(
     val pixels: ByteArray,
     val width: Int,
     val height: Int,
+    val pixelAddress: Long = 0L,
+    val pixelOwner: Any? = null,
+    val sequence: Long = 0L,
 ) {
     override fun equals(other: Any?): Boolean {
         if (this === other) return true
         if (other !is CameraFrame) return false
-        return width == other.width && height == other.height && pixels.contentEquals(other.pixels)
+        return width == other.width && height == other.height &&
+            pixelAddress == other.pixelAddress && sequence == other.sequence &&
+            pixels.contentEquals(other.pixels)
     }
 
     override fun hashCode(): Int {
         var result = pixels.contentHashCode()
         result = 31 * result + width
         result = 31 * result + height
+        result = 31 * result + pixelAddress.hashCode()
+        result = 31 * result + sequence.hashCode()
         return result
     }
+
+    companion object {
+        /** [pixels] of frames whose data lives at [pixelAddress]. */
+        val NO_PIXELS = ByteArray(0)
+    }
 }
@@ -2,13 +2,18 @@ package org.balch.orpheus.core.mediapipe
 
 import kotlinx.coroutines.flow.Flow
 import kotlinx.coroutines.flow.StateFlow
+import org.balch.orpheus.core.gestures.HandFeatures
 
 /**
  * Platform-specific hand tracking provider.
  * Implementations handle camera capture and MediaPipe inference.
  */
 interface HandTracker {
-    /** Emits hand tracking results, or null when no hand is detected. */
+    /**
+     * Emits hand tracking results, or null when no hand is detected. Each result is a
+     * new immutable object graph (about two dozen small objects per hand), so realtime
+     * threads poll [readLatest] or [sampleLandmarks] instead.
+     */
     val results: Flow<HandTrackingResult?>
 
     /** Emits camera preview frames for UI rendering. */
@@ -22,4 +27,41 @@ interface HandTracker {
 
     /** Stop camera capture and hand tracking. */
     fun stop()
+
+    /** Native per-frame timing and throughput counters, or null where unavailable. */
+    fun stats(): HandTrackerStats? = null
+
+    /**
+     * Landmarks extrapolated to the current time, for consumers polling faster than
+     * the camera (e.g. a control-rate thread). Written into [out] (at least
+     * [SAMPLE_FLOATS]) as `[numHands, per-hand(handedness, 21*xyz)]`, handedness
+     * `>= 0.5` for the user's right hand. Returns the hand count, 0 where unsupported.
+     */
+    fun sampleLandmarks(out: FloatArray): Int = 0
+
+    /**
+     * The newest result, copied without locks or allocation so an audio or
+     * control-rate thread can poll it once per block instead of collecting [results].
+     * Written into [out] (at least [LATEST_FLOATS]) as `[numHands, per-hand(handedness,
+     * gestureId, gestureScore, 21*xyz, features, aslClassId, aslScore)]`, per hand
+     * [LATEST_HAND_FLOATS] floats; resolve `gestureId` with [latestGestureName].
+     *
+     * Returns the result's number (increasing by one per result), 0 when there is
+     * none (or where unsupported) and -1 when the read gave up, leaving [out] as it was.
+     */
+    fun readLatest(out: FloatArray): Long = 0
+
+    /** Name behind a [readLatest] gesture ID, or null. Not for realtime threads. */
+    fun latestGestureName(id: Int): String? = null
+
+    companion object {
+        /** `1 + 2 hands * (handedness + 21 * xyz)`. */
+        const val SAMPLE_FLOATS = 1 + 2 * 64
+
+        /** `handedness, gestureId, gestureScore, 21 * xyz, features, aslClassId, aslScore`. */
+        const val LATEST_HAND_FLOATS = 3 + 21 * 3 + HandFeatures.SIZE + 2
+
+        /** `1 + 2 hands * LATEST_HAND_FLOATS`. */
+        const val LATEST_FLOATS = 1 + 2 * LATEST_HAND_FLOATS
+    }
 }
@@ -0,0 +1,41 @@
+package org.balch.orpheus.core.mediapipe
+
+/** Hardware the hand-tracking models run on. */
+enum class InferenceDelegate {
+    /** TFLite CPU path (XNNPACK). Always available. */
+    CPU,
+
+    /** GPU delegate (OpenGL/Metal). Falls back to CPU where the platform build lacks it. */
+    GPU,
+}
+
+/**
+ * Model options applied when a [HandTracker] creates its MediaPipe task.
+ *
+ * Single-hand mode and a higher [minTrackingConfidence] let MediaPipe skip the palm
+ * detector on most frames (it only re-runs when tracking is lost), which roughly
+ * halves inference cost.
+ */
+data class HandTrackerOptions(
+    /** Maximum hands to detect, 1..[MAX_HANDS]. */
+    val numHands: Int = MAX_HANDS,
+    /** Minimum palm-detector score for a new hand to be accepted. */
+    val minHandDetectionConfidence: Float = 0.5f,
+    /** Minimum hand-presence score of the landmark model. */
+    val minHandPresenceConfidence: Float = 0.5f,
+    /** Minimum score to keep tracking between frames instead of re-detecting. */
+    val minTrackingConfidence: Float = 0.5f,
+    val delegate: InferenceDelegate = InferenceDelegate.CPU,
+) {
+    init {
+        require(numHands in 1..MAX_HANDS) { "numHands must be in 1..$MAX_HANDS" }
+        require(minHandDetectionConfidence in 0f..1f) { "minHandDetectionConfidence must be in 0..1" }
+        require(minHandPresenceConfidence in 0f..1f) { "minHandPresenceConfidence must be in 0..1" }
+        require(minTrackingConfidence in 0f..1f) { "minTrackingConfidence must be in 0..1" }
+    }
+
+    companion object {
+        /** Result formats carry at most two hands. */
+        const val MAX_HANDS = 2
+    }
+}
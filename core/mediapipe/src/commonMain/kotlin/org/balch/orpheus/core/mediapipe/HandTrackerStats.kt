@@ -0,0 +1,94 @@
+package org.balch.orpheus.core.mediapipe
+
+/**
+ * Latency distribution of one hand-tracking pipeline stage.
+ * Percentiles are histogram bucket lower bounds (~25% resolution).
+ */
+data class StageLatency(
+    val count: Long,
+    val meanNanos: Long,
+    val p50Nanos: Long,
+    val p95Nanos: Long,
+    val p99Nanos: Long,
+    val maxNanos: Long,
+) {
+    companion object {
+        val EMPTY = StageLatency(0, 0, 0, 0, 0, 0)
+    }
+}
+
+/**
+ * Cumulative per-frame timing and throughput counters of the native tracker,
+ * aggregated across all tracker instances since start (or the last reset).
+ */
+data class HandTrackerStats(
+    /** Wrapping the RGB frame in a MediaPipe image (pixel copy). */
+    val imageCreate: StageLatency,
+    /** Model inference: synchronous recognize, or async submit to result. */
+    val inference: StageLatency,
+    /** Packing landmarks into the result ring / arrays. */
+    val resultPacking: StageLatency,
+    /** Native to Kotlin result callback. */
+    val jniCallback: StageLatency,
+    val framesSubmitted: Long,
+    val resultsDelivered: Long,
+    val framesDropped: Long,
+    /** Frames that ran full gesture recognition. */
+    val gesturesFull: Long,
+    /** Frames that only tracked landmarks and kept the previous gesture label. */
+    val gesturesTracked: Long,
+) {
+    /** Fraction of gesture frames that ran full recognition (1 without skip-frame scheduling). */
+    val recognitionRate: Float
+        get() {
+            val total = gesturesFull + gesturesTracked
+            return if (total > 0) gesturesFull.toFloat() / total else 1f
+        }
+
+    companion object {
+        private const val VERSION = 2L
+        private const val COUNTERS = 5
+        private const val HEADER_SIZE = 3
+        private const val STAGE_COUNT = 4
+        private const val STAGE_FIELDS = 6
+
+        /**
+         * Parse the packed layout produced by the native bridge:
+         * `[version, stageCount, stageFields, per-stage(count, mean, p50, p95, p99, max),
+         * framesSubmitted, resultsDelivered, framesDropped, gesturesFull, gesturesTracked]`.
+         *
+         * @return null if the layout doesn't match this version.
+         */
+        fun fromPacked(packed: LongArray): HandTrackerStats? {
+            if (packed.size < HEADER_SIZE + STAGE_COUNT * STAGE_FIELDS + COUNTERS) return null
+            if (packed[0] != VERSION || packed[1] != STAGE_COUNT.toLong() ||
+                packed[2] != STAGE_FIELDS.toLong()
+            ) return null
+
+            fun stage(index: Int): StageLatency {
+                val base = HEADER_SIZE + index * STAGE_FIELDS
+                return StageLatency(
+                    count = packed[base],
+                    meanNanos = packed[base + 1],
+                    p50Nanos = packed[base + 2],
+                    p95Nanos = packed[base + 3],
+                    p99Nanos = packed[base + 4],
+                    maxNanos = packed[base + 5],
+                )
+            }
+
+            val counters = HEADER_SIZE + STAGE_COUNT * STAGE_FIELDS
+            return HandTrackerStats(
+                imageCreate = stage(0),
+                inference = stage(1),
+                resultPacking = stage(2),
+                jniCallback = stage(3),
+                framesSubmitted = packed[counters],
+                resultsDelivered = packed[counters + 1],
+                framesDropped = packed[counters + 2],
+                gesturesFull = packed[counters + 3],
+                gesturesTracked = packed[counters + 4],
+            )
+        }
+    }
+}
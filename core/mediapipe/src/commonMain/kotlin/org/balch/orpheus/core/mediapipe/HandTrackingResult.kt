@@ -1,16 +1,24 @@
 package org.balch.orpheus.core.mediapipe
 
+import org.balch.orpheus.core.gestures.HandFeatures
 import org.balch.orpheus.core.gestures.HandLandmark
 import org.balch.orpheus.core.gestures.Handedness
 
 /**
  * A single tracked hand with its landmarks and handedness.
+ *
+ * @property features geometry computed by the tracker alongside the landmarks, or
+ *   null when the tracker doesn't provide it (consumers then derive it themselves).
+ * @property aslLabel sign label from the tracker's custom ASL classifier, if it has one.
  */
 data class TrackedHand(
     val landmarks: List<HandLandmark>,
     val handedness: Handedness,
     val gestureName: String? = null,
     val gestureConfidence: Float = 0f,
+    val features: HandFeatures? = null,
+    val aslLabel: String? = null,
+    val aslConfidence: Float = 0f,
 )
 
 /**
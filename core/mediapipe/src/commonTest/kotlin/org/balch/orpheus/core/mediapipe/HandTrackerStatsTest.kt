@@ -0,0 +1,63 @@
+package org.balch.orpheus.core.mediapipe
+
+import kotlin.test.Test
+import kotlin.test.assertEquals
+import kotlin.test.assertNotNull
+import kotlin.test.assertNull
+
+/** Pins [HandTrackerStats.fromPacked] to the long[] nativeGetStats (mediapipe_jni.cc) builds. */
+class HandTrackerStatsTest {
+
+    /**
+     * nativeGetStats' layout: STATS_VERSION, STAGE_COUNT, STATS_STAGE_FIELDS, then per
+     * StatsStage (count, mean, p50, p95, p99, max), then the five frame counters.
+     * Every value is distinct so a shifted index shows up.
+     */
+    private fun packed(version: Long = 2, stageCount: Long = 4, stageFields: Long = 6): LongArray {
+        val stages = (0 until 4).flatMap { s -> List(6) { f -> 100L * (s + 1) + f } }
+        val counters = listOf(9001L, 9002L, 9003L, 9004L, 9005L)
+        return (listOf(version, stageCount, stageFields) + stages + counters).toLongArray()
+    }
+
+    @Test
+    fun `packed stats are 32 longs`() {
+        // 3 + STAGE_COUNT(4) * STATS_STAGE_FIELDS(6) + 5 counters.
+        assertEquals(32, packed().size)
+    }
+
+    @Test
+    fun `stages decode in StatsStage order`() {
+        val stats = assertNotNull(HandTrackerStats.fromPacked(packed()))
+
+        assertEquals(StageLatency(100, 101, 102, 103, 104, 105), stats.imageCreate)
+        assertEquals(StageLatency(200, 201, 202, 203, 204, 205), stats.inference)
+        assertEquals(StageLatency(300, 301, 302, 303, 304, 305), stats.resultPacking)
+        assertEquals(StageLatency(400, 401, 402, 403, 404, 405), stats.jniCallback)
+    }
+
+    @Test
+    fun `counters follow the stages`() {
+        val stats = assertNotNull(HandTrackerStats.fromPacked(packed()))
+
+        assertEquals(9001, stats.framesSubmitted)
+        assertEquals(9002, stats.resultsDelivered)
+        assertEquals(9003, stats.framesDropped)
+        assertEquals(9004, stats.gesturesFull)
+        assertEquals(9005, stats.gesturesTracked)
+    }
+
+    @Test
+    fun `other layouts are rejected`() {
+        assertNull(HandTrackerStats.fromPacked(packed(version = 1)))
+        assertNull(HandTrackerStats.fromPacked(packed(stageCount = 5)))
+        assertNull(HandTrackerStats.fromPacked(packed(stageFields = 7)))
+        assertNull(HandTrackerStats.fromPacked(packed().copyOf(31)))
+    }
+
+    @Test
+    fun `recognition rate is full over all gesture frames`() {
+        val stats = assertNotNull(HandTrackerStats.fromPacked(packed()))
+        assertEquals(9004f / (9004 + 9005), stats.recognitionRate)
+        assertEquals(1f, stats.copy(gesturesFull = 0, gesturesTracked = 0).recognitionRate)
+    }
+}
@@ -0,0 +1,1241 @@
+package org.balch.orpheus.core.mediapipe
+
+import java.io.File
+import java.nio.ByteBuffer
+import java.nio.FloatBuffer
+import java.util.logging.Logger
+
+/**
+ * JNI bindings for the MediaPipe Hand Landmarker and Gesture Recognizer C APIs.
+ *
+ * Loads a single combined native library (platform-specific: `.dylib`/`.so`/`.dll`) that
+ * statically links MediaPipe, protobuf, and our JNI shim — no external Homebrew
+ * dependencies required at runtime on macOS; the Linux and Windows builds use the
+ * system OpenCV (see build-native-mediapipe.sh). Android loads the same bridge as an
+ * arm64-v8a `.so` without OpenCV, so native capture is desktop-only there.
+ *
+ * HandLandmarker uses LIVE_STREAM mode (async results via [ResultCallback]).
+ * GestureRecognizer uses VIDEO mode (synchronous) to avoid a crash in MediaPipe's
+ * async packet lifecycle for Eigen::Matrix holders. With per-frame callbacks, gesture
+ * names are passed as strings directly; in [ResultRing] mode they are interned once
+ * as small integer IDs and results are written into pre-allocated slots.
+ */
+object MediaPipeJni {
+
+    /**
+     * Callback interface for LIVE_STREAM async results.
+     * Called on a MediaPipe native thread — implementations must be thread-safe.
+     *
+     * @param result float array `[numHands, per-hand(handedness, 21*xyz, features)]`
+     *               (82 floats per hand, features as in
+     *               [org.balch.orpheus.core.gestures.HandFeatures]), or null if
+     *               no hand detected.
+     * @param timestampMs the timestamp of the frame that produced this result.
+     */
+    interface ResultCallback {
+        fun onResult(result: FloatArray?, timestampMs: Long)
+    }
+
+    /**
+     * Callback interface for gesture recognition results.
+     * Called on the caller's thread (VIDEO mode is synchronous).
+     *
+     * @param result float array `[numHands, per-hand(handedness, gestureScore, 21*xyz,
+     *               features)]` (83 floats per hand), or null if no hand detected.
+     * @param gestureNames gesture name strings per hand (one per detected hand), or null.
+     * @param timestampMs frame timestamp.
+     */
+    interface GestureResultCallback {
+        fun onResult(result: FloatArray?, gestureNames: Array<String?>?, timestampMs: Long)
+    }
+
+    /**
+     * Callback for result-ring mode (see [setResultRing]).
+     * Called on the thread that produced the result — implementations must be thread-safe.
+     *
+     * @param slot index of the [ResultRing] slot that was just written.
+     * @param timestampMs frame timestamp.
+     */
+    interface SlotCallback {
+        fun onSlot(slot: Int, timestampMs: Long)
+    }
+
+    /**
+     * Preview side of native capture (see [startCapture]). Called on the native
+     * capture thread; results still arrive through the tracker's own callbacks.
+     * The native side caches this interface's method IDs in `JNI_OnLoad` — keep
+     * the signatures in sync with mediapipe_jni.cc.
+     */
+    interface CaptureCallback {
+        /**
+         * Direct buffer of at least `width * height * 4` bytes to receive this frame's
+         * mirrored BGRA preview, e.g. [CameraFramePool.next], or null to skip the preview.
+         */
+        fun previewBuffer(width: Int, height: Int): ByteBuffer?
+
+        /** The buffer last returned by [previewBuffer] now holds frame [timestampMs]. */
+        fun onPreview(width: Int, height: Int, timestampMs: Long)
+
+        /** The camera failed; the capture thread has exited. */
+        fun onCaptureStopped(reason: String)
+    }
+
+    /**
+     * What [detectAsync] does with a frame while the landmarker already has the
+     * maximum number of frames in flight (see [setFlowControl]).
+     */
+    enum class DropPolicy(internal val nativeValue: Int) {
+        /** Discard the incoming frame. */
+        DROP_NEWEST(0),
+
+        /** Hold the incoming frame (replacing any held one) and submit it as soon as a result arrives. */
+        DROP_OLDEST(1),
+    }
+
+    /**
+     * Camera frame geometry a tracker is created for. With it, results arrive in
+     * final form: x/y normalized to the [width] x [height] capture frame (letterbox
+     * padding and ROI crop undone natively) and handedness as the user sees it.
+     *
+     * @param mirrored frames are flipped horizontally before inference, so
+     *   MediaPipe's "Right" label is the user's left hand.
+     */
+    data class CaptureGeometry(val width: Int, val height: Int, val mirrored: Boolean) {
+        companion object {
+            /** Results stay normalized to the letterboxed square; labels as reported. */
+            val NONE = CaptureGeometry(0, 0, false)
+        }
+    }
+
+    /**
+     * One-Euro smoothing applied natively to every landmark before results are
+     * packed (see [setLandmarkSmoothing]). Coordinates are filtered in output
+     * space, so [beta] is per normalized unit per second.
+     *
+     * @param minCutoffHz cutoff at rest; lower is steadier but laggier.
+     * @param beta how fast the cutoff rises with speed; higher tracks fast moves tighter.
+     * @param derivativeCutoffHz cutoff of the speed estimate itself.
+     */
+    data class LandmarkSmoothing(
+        val minCutoffHz: Float = 1.0f,
+        val beta: Float = 5.0f,
+        val derivativeCutoffHz: Float = 1.0f,
+    ) {
+        init {
+            require(minCutoffHz > 0f) { "minCutoffHz must be positive" }
+            require(beta >= 0f) { "beta must be non-negative" }
+            require(derivativeCutoffHz > 0f) { "derivativeCutoffHz must be positive" }
+        }
+    }
+
+    /**
+     * Skip-frame cadence of a gesture recognizer (see [setGestureSchedule]): full
+     * recognition runs at least every [interval] frames, and early when a hand's
+     * pose drifts by more than [motionThreshold]; frames in between only track
+     * landmarks and keep the last gesture label.
+     *
+     * @param motionThreshold mean wrist-relative landmark displacement in units of
+     *   hand scale (wrist to middle MCP); moving a held pose doesn't count.
+     */
+    data class GestureSchedule(
+        val interval: Int = 3,
+        val motionThreshold: Float = 0.15f,
+    ) {
+        init {
+            require(interval >= 1) { "interval must be at least 1" }
+            require(motionThreshold > 0f) { "motionThreshold must be positive" }
+        }
+    }
+
+    /**
+     * Camera opened natively by [openCamera].
+     *
+     * @param width frame width the camera actually delivers.
+     * @param height frame height the camera actually delivers.
+     */
+    data class NativeCamera(val handle: Long, val width: Int, val height: Int)
+
+    /**
+     * Native worker pool for [detectBatch], created by [createBatch].
+     *
+     * [results] receives one slot per frame of the latest batch, in submission order;
+     * its gesture names are kept in sync by [detectBatch].
+     */
+    class Batch internal constructor(internal val handle: Long, maxFrames: Int) {
+        val results = ResultRing(maxFrames)
+        internal var knownGestureNames = 0
+    }
+
+    /**
+     * Adapts [SlotCallback] to the native callback, recording interned gesture names.
+     * The native side caches this class and its method IDs in `JNI_OnLoad` — keep
+     * the name and signatures in sync with mediapipe_jni.cc.
+     */
+    private class RingCallback(
+        private val ring: ResultRing,
+        private val callback: SlotCallback,
+    ) {
+        @Suppress("unused") // Called from JNI.
+        fun onSlot(slot: Int, timestampMs: Long) = callback.onSlot(slot, timestampMs)
+
+        @Suppress("unused") // Called from JNI.
+        fun onGestureName(id: Int, name: String) = ring.setGestureName(id, name)
+    }
+
+    private val logger = Logger.getLogger(MediaPipeJni::class.java.name)
+    @Volatile
+    private var initialized = false
+
+    /**
+     * JNI surface version these bindings declare; must match the library's
+     * `BRIDGE_VERSION` (mediapipe_jni.cc). Bump both with every native added,
+     * removed or re-signatured.
+     */
+    const val BRIDGE_VERSION = 1
+
+    /**
+     * Bridge version of the loaded library: [BRIDGE_VERSION], or 0 for a library built
+     * from the original bridge sources, before versioning. Such a library only has the
+     * baseline natives, see [isLegacyBridge].
+     */
+    @Volatile
+    var bridgeVersion: Int = 0
+        private set
+
+    /** Whether [initialize] has loaded the native library. */
+    val isInitialized: Boolean get() = initialized
+
+    /**
+     * Whether the loaded library is a version-0 build. It then only supports
+     * [createLegacyLandmarker], [createLegacyGestureRecognizer], the `ByteArray`
+     * [detectAsync] and [recognizeGesture], and the close calls; everything else
+     * needs a library rebuilt with build-native-mediapipe.sh.
+     */
+    val isLegacyBridge: Boolean get() = initialized && bridgeVersion == 0
+
+    /** Whether the loaded library is the GPU-enabled variant (see [initialize]). */
+    @Volatile
+    var isGpuBuild: Boolean = false
+        private set
+
+    /**
+     * Load the native library: on desktop from the persistent NativeCache, extracting
+     * (and on macOS signing) it only when that content isn't cached yet; on Android
+     * from the APK's `jniLibs` (see [loadMediaPipeLibrary]).
+     * Safe to call multiple times — subsequent calls are no-ops.
+     *
+     * A single combined library provides both HandLandmarker and GestureRecognizer.
+     * With [delegate] GPU the GPU-enabled variant (`mediapipe_jni_gpu`, built by
+     * `build-native-mediapipe.sh --gpu`) is preferred where it is bundled; only one
+     * variant can be loaded per process, so the first call decides.
+     *
+     * A version-0 library (one built before [BRIDGE_VERSION] existed) is accepted in
+     * [isLegacyBridge] mode, so trackers keep running on it until it is rebuilt.
+     *
+     * @throws IllegalStateException if no library can be loaded, or the bundled one is
+     *   some other bridge version than these bindings; rebuild it with
+     *   build-native-mediapipe.sh.
+     */
+    @Synchronized
+    fun initialize(delegate: InferenceDelegate = InferenceDelegate.CPU) {
+        if (initialized) return
+
+        val library = try {
+            loadMediaPipeLibrary(delegate)
+        } catch (e: LinkageError) {
+            throw IllegalStateException("Cannot load the MediaPipe bridge: ${e.message}", e)
+        }
+        // Probe before anything else calls in: a stale library lacks newer natives and
+        // would otherwise fail with UnsatisfiedLinkError (an Error) mid-session.
+        val version = try {
+            nativeBridgeVersion()
+        } catch (_: UnsatisfiedLinkError) {
+            0
+        }
+        check(version == BRIDGE_VERSION || version == 0) {
+            "${library.name} is bridge version $version, these bindings need $BRIDGE_VERSION: " +
+                "rebuild it with build-native-mediapipe.sh"
+        }
+        if (version == 0) {
+            bridgeVersion = 0
+            isGpuBuild = false
+            initialized = true
+            logger.warning(
+                "Loaded ${library.name} built before bridge versioning: baseline natives only " +
+                    "until it is rebuilt with build-native-mediapipe.sh",
+            )
+            return
+        }
+        // Last native call here; the flags are set only once it has succeeded.
+        val isa = try {
+            frameKernelsIsa()
+        } catch (e: LinkageError) {
+            throw IllegalStateException("${library.name} has no frame kernels: ${e.message}", e)
+        }
+
+        bridgeVersion = version
+        isGpuBuild = library.gpu
+        initialized = true
+        logger.info("Loaded ${library.name} ($isa frame kernels)")
+    }
+
+    // A version-0 library exports nativeCreateLandmarker and nativeCreateGestureRecognizer
+    // with the baseline signatures. JNI binds natives by name, so calling the current
+    // overloads there would pass the wrong arguments instead of failing to link.
+    private fun checkCurrentBridge() {
+        check(!isLegacyBridge) {
+            "The loaded MediaPipe bridge predates this call: rebuild it with build-native-mediapipe.sh"
+        }
+    }
+
+    /**
+     * Route results of one landmarker/recognizer into [ring] instead of per-frame
+     * FloatArray/String[] callbacks. The native side packs each result into the
+     * next slot and calls [callback] with only the slot index.
+     *
+     * Each handle owns its own ring, so several trackers can run side by side.
+     * Must be called before the first frame is submitted to [handle]; the ring is
+     * released when the handle is closed. Pass nulls to clear.
+     *
+     * @param handle native pointer from [createLandmarker] or [createGestureRecognizer].
+     */
+    fun setResultRing(handle: Long, ring: ResultRing?, callback: SlotCallback?) {
+        if (ring == null || callback == null) {
+            nativeSetResultRing(handle, null, 0, 0, null)
+        } else {
+            nativeSetResultRing(
+                handle, ring.byteBuffer, ring.slotCount, ResultRing.SLOT_FLOATS,
+                RingCallback(ring, callback),
+            )
+        }
+    }
+
+    /**
+     * Enable [smoothing] of [handle]'s landmarks, or disable it with null.
+     * Each hand keeps filter state per handedness and restarts when it leaves
+     * the frame; changing the parameters restarts every hand.
+     *
+     * @param handle native pointer from [createLandmarker] or [createGestureRecognizer].
+     */
+    fun setLandmarkSmoothing(handle: Long, smoothing: LandmarkSmoothing?) {
+        val s = smoothing ?: LandmarkSmoothing()
+        nativeSetLandmarkSmoothing(
+            handle, smoothing != null, s.minCutoffHz, s.beta, s.derivativeCutoffHz,
+        )
+    }
+
+    /** Default [setResultLog] capacity: an hour of results at 30 fps. */
+    const val DEFAULT_RESULT_LOG_RECORDS = 108_000
+
+    /**
+     * Log every result of [handle] to a new memory-mapped [file] (replaced if it
+     * exists) for replay with [ReplayHandTracker], or stop and close the log with
+     * null. The file is sized for [maxRecords] results up front and truncated to
+     * the ones written when closed; later results are counted as dropped.
+     *
+     * @param handle native pointer from [createLandmarker] or [createGestureRecognizer].
+     * @throws RuntimeException if the file can't be created or mapped.
+     */
+    fun setResultLog(handle: Long, file: File?, maxRecords: Int = DEFAULT_RESULT_LOG_RECORDS) {
+        require(maxRecords > 0) { "maxRecords must be positive" }
+        nativeSetResultLog(handle, file?.absolutePath, maxRecords)
+    }
+
+    /**
+     * Load a custom ASL classifier for [handle], or unload it with null. The model
+     * runs natively on every hand of every result; class IDs and scores land in
+     * [ResultRing] slots ([ResultRing.aslClassId]). Per-frame callbacks don't carry them.
+     *
+     * @param modelPath `.tflite` file with one float32 input of 68 elements (see
+     *   asl_classifier.h) and one float32 output of class scores.
+     * @throws RuntimeException if the model can't be loaded or doesn't fit.
+     */
+    fun loadAslClassifier(handle: Long, modelPath: String?) {
+        nativeLoadAslClassifier(handle, modelPath)
+    }
+
+    /** Size of the array [sampleLandmarks] writes into. */
+    const val SAMPLE_FLOATS = 1 + ResultRing.MAX_HANDS * 64
+
+    /** Current time on the native clock that [sampleLandmarks] expects. */
+    fun nanoTime(): Long = nativeNanoTime()
+
+    /**
+     * Landmarks of [handle]'s tracked hands extrapolated to [nowNanos], from a
+     * velocity fit over the last few results. Cheap and allocation-free, so a
+     * control-rate thread can poll it between camera frames. Extrapolation is
+     * capped at 100 ms past the newest result; after that the hand holds.
+     *
+     * @param out at least [SAMPLE_FLOATS] floats, written as
+     *   `[numHands, per-hand(handedness, 21*xyz)]`.
+     * @param nowNanos target time on the [nanoTime] clock.
+     * @return number of hands written.
+     */
+    fun sampleLandmarks(handle: Long, out: FloatArray, nowNanos: Long = nanoTime()): Int {
+        require(out.size >= SAMPLE_FLOATS) { "out must hold $SAMPLE_FLOATS floats" }
+        return nativeSampleLandmarks(handle, nowNanos, out)
+    }
+
+    /**
+     * Copy [handle]'s newest result into [out] in [ResultRing] slot format, without
+     * locks, allocation or callbacks: the native side publishes every result through
+     * a seqlock, so an audio or control-rate thread can poll this once per block.
+     * Reads take bounded time; if a result was being written throughout, -1 is
+     * returned and [out] is left as it was.
+     *
+     * Gesture IDs in [out] are the snapshot's own (not a ring's); resolve them with
+     * [latestGestureName] off the realtime thread.
+     *
+     * @param out direct buffer in native byte order (e.g. a view of
+     *   `ByteBuffer.allocateDirect(...).order(ByteOrder.nativeOrder())`) of at least
+     *   [ResultRing.SLOT_FLOATS] floats, written from index 0 regardless of position.
+     * @return the result's number (from 1, increasing by one per result), 0 before
+     *   the first result, or -1 if the read gave up.
+     */
+    fun readLatest(handle: Long, out: FloatBuffer): Long = nativeReadLatest(handle, out)
+
+    /** Name behind a gesture ID in [readLatest] output, or null for -1 / unknown IDs. */
+    fun latestGestureName(handle: Long, id: Int): String? =
+        if (id < 0) null else nativeLatestGestureName(handle, id)
+
+    /**
+     * Create a HandLandmarker in LIVE_STREAM mode.
+     * Results arrive asynchronously via [callback].
+     *
+     * Every call returns an independent instance with its own callback and
+     * result ring; up to 8 landmarkers may be live at once.
+     *
+     * @param modelPath absolute path to the hand_landmarker.task model file.
+     * @param callback receives detection results on a native thread.
+     * @param options hand count, confidence thresholds and delegate.
+     * @param geometry capture frame the results are mapped to.
+     * @return native pointer (opaque handle).
+     */
+    fun createLandmarker(
+        modelPath: String,
+        callback: ResultCallback,
+        options: HandTrackerOptions = HandTrackerOptions(),
+        geometry: CaptureGeometry = CaptureGeometry.NONE,
+    ): Long {
+        return createLandmarker(modelPath, null, options, geometry, callback)
+    }
+
+    /**
+     * Create a HandLandmarker in LIVE_STREAM mode that delivers into a
+     * [ResultRing]; register it with [setResultRing] before the first frame.
+     */
+    fun createLandmarker(
+        modelPath: String,
+        options: HandTrackerOptions = HandTrackerOptions(),
+        geometry: CaptureGeometry = CaptureGeometry.NONE,
+    ): Long {
+        return createLandmarker(modelPath, null, options, geometry, null)
+    }
+
+    /**
+     * Like the ring-mode [createLandmarker], but from the model's bytes
+     * (`base_options.model_asset_buffer`) so no model file is needed.
+     *
+     * @param modelBuffer direct buffer holding hand_landmarker.task, e.g. memory-mapped;
+     *   MediaPipe copies what it needs, so it may be reused once this returns.
+     */
+    fun createLandmarker(
+        modelBuffer: ByteBuffer,
+        options: HandTrackerOptions = HandTrackerOptions(),
+        geometry: CaptureGeometry = CaptureGeometry.NONE,
+    ): Long {
+        require(modelBuffer.isDirect) { "modelBuffer must be a direct ByteBuffer" }
+        return createLandmarker(null, modelBuffer, options, geometry, null)
+    }
+
+    private fun createLandmarker(
+        modelPath: String?,
+        modelBuffer: ByteBuffer?,
+        options: HandTrackerOptions,
+        geometry: CaptureGeometry,
+        callback: ResultCallback?,
+    ): Long = with(options) {
+        checkCurrentBridge()
+        nativeCreateLandmarker(
+            modelPath, modelBuffer, numHands,
+            minHandDetectionConfidence, minHandPresenceConfidence, minTrackingConfidence,
+            delegate.ordinal, geometry.width, geometry.height, geometry.mirrored, callback,
+        )
+    }
+
+    /**
+     * Send a frame for async hand detection. Returns immediately.
+     * Results will arrive later via the [ResultCallback] passed to [createLandmarker].
+     *
+     * @param landmarkerPtr native pointer from [createLandmarker].
+     * @param rgbPixels RGB byte array (3 bytes per pixel, width*height*3 total).
+     * @param width frame width in pixels.
+     * @param height frame height in pixels.
+     * @param timestampMs monotonically increasing timestamp.
+     */
+    fun detectAsync(
+        landmarkerPtr: Long,
+        rgbPixels: ByteArray,
+        width: Int,
+        height: Int,
+        timestampMs: Long,
+    ) {
+        nativeDetectAsync(landmarkerPtr, rgbPixels, width, height, timestampMs)
+    }
+
+    /**
+     * Send a frame held in a direct [ByteBuffer] for async hand detection.
+     * The native side reads the buffer in place (no JVM array copy), so callers
+     * can reuse one buffer for every frame.
+     *
+     * @param landmarkerPtr native pointer from [createLandmarker].
+     * @param rgbPixels direct buffer of RGB bytes (at least width*height*3).
+     * @param width frame width in pixels.
+     * @param height frame height in pixels.
+     * @param timestampMs monotonically increasing timestamp.
+     */
+    fun detectAsync(
+        landmarkerPtr: Long,
+        rgbPixels: ByteBuffer,
+        width: Int,
+        height: Int,
+        timestampMs: Long,
+    ) {
+        require(rgbPixels.isDirect) { "rgbPixels must be a direct ByteBuffer" }
+        nativeDetectAsyncBuffer(landmarkerPtr, rgbPixels, width, height, timestampMs)
+    }
+
+    /**
+     * Bound the number of frames outstanding in the LIVE_STREAM graph so latency
+     * stays flat when inference falls behind the camera. By default every frame
+     * is submitted.
+     *
+     * @param landmarkerPtr native pointer from [createLandmarker].
+     * @param maxInFlight frames allowed in the graph at once (1..8), or 0 for unlimited.
+     * @param policy which frame to drop when the limit is reached.
+     */
+    fun setFlowControl(landmarkerPtr: Long, maxInFlight: Int, policy: DropPolicy) {
+        nativeSetFlowControl(landmarkerPtr, maxInFlight, policy.nativeValue)
+    }
+
+    /**
+     * Frames dropped so far by the [setFlowControl] limit, plus frames the graph
+     * skipped internally without producing a result.
+     */
+    fun droppedFrames(landmarkerPtr: Long): Long {
+        return nativeGetDroppedFrames(landmarkerPtr)
+    }
+
+    /**
+     * Delegate [handle]'s inference actually runs on: CPU whenever the library
+     * lacks GPU support, GPU task creation failed, or for LIVE_STREAM landmarkers.
+     */
+    fun delegate(handle: Long): InferenceDelegate = InferenceDelegate.entries[nativeGetDelegate(handle)]
+
+    /**
+     * Close the HandLandmarker and release native resources.
+     */
+    fun closeLandmarker(landmarkerPtr: Long) {
+        nativeCloseLandmarker(landmarkerPtr)
+    }
+
+    /**
+     * Mirror, letterbox and convert an ARGB frame to packed RGB in one native pass,
+     * writing into the caller's reused direct buffer.
+     *
+     * Replaces the Java2D mirror → pad-to-square → per-pixel RGB loop: the output
+     * is a black-letterboxed square of side `max(width, height)` (non-square input
+     * aborts in MediaPipe's landmark_projection_calculator).
+     *
+     * @param argbPixels ARGB pixels (e.g. a TYPE_INT_ARGB raster), row stride = width.
+     * @param width source width in pixels.
+     * @param height source height in pixels.
+     * @param mirror flip horizontally so the camera acts like a mirror.
+     * @param rgbOut direct buffer of at least `size * size * 3` bytes (see [squareSize]).
+     * @return side length of the square frame written into [rgbOut].
+     */
+    fun preprocessArgb(
+        argbPixels: IntArray,
+        width: Int,
+        height: Int,
+        mirror: Boolean,
+        rgbOut: ByteBuffer,
+    ): Int {
+        require(rgbOut.isDirect) { "rgbOut must be a direct ByteBuffer" }
+        return nativePreprocessArgb(argbPixels, width, height, mirror, rgbOut)
+    }
+
+    /**
+     * Snapshot of the native timing histograms (image create, inference, result
+     * packing, JNI callback) and frame counters, aggregated across all instances.
+     * Parse with [HandTrackerStats.fromPacked].
+     */
+    fun getStats(): LongArray = nativeGetStats()
+
+    /** Clear the histograms and counters behind [getStats]. */
+    fun resetStats() {
+        nativeResetStats()
+    }
+
+    /**
+     * Like [preprocessArgb], but bound to a tracker: crops a square around the hands
+     * of that tracker's previous result (with a margin) and resamples it to a small
+     * fixed size, falling back to the full letterboxed square when tracking is lost.
+     * Landmarks of cropped frames are mapped back to full-square coordinates before
+     * delivery, so results look exactly as with [preprocessArgb].
+     *
+     * Submit the frame to the same tracker with the same [timestampMs] and the
+     * returned side length.
+     *
+     * @param handle native pointer from [createLandmarker] or [createGestureRecognizer].
+     * @param rgbOut direct buffer of at least the full `size * size * 3` bytes (see [squareSize]).
+     * @return side length of the square frame written into [rgbOut].
+     */
+    fun preprocessArgbRoi(
+        handle: Long,
+        argbPixels: IntArray,
+        width: Int,
+        height: Int,
+        mirror: Boolean,
+        rgbOut: ByteBuffer,
+        timestampMs: Long,
+    ): Int {
+        require(rgbOut.isDirect) { "rgbOut must be a direct ByteBuffer" }
+        return nativePreprocessArgbRoi(handle, argbPixels, width, height, mirror, rgbOut, timestampMs)
+    }
+
+    /**
+     * Like [preprocessArgbRoi], but straight from a camera frame: reads packed BGR24
+     * rows (FFmpeg's default output) in place and, in the same native call, writes
+     * the mirrored BGRA preview into [previewOut] — no BufferedImage, ARGB copy or
+     * preview array on the JVM side.
+     *
+     * @param bgrPixels direct buffer of [height] rows of [strideBytes] bytes.
+     * @param previewOut direct buffer of at least `width * height * 4` bytes, e.g. a
+     *   [CameraFramePool] slot.
+     * @param rgbOut direct buffer of at least the full `size * size * 3` bytes (see [squareSize]).
+     * @return side length of the square frame written into [rgbOut].
+     */
+    fun preprocessBgrFrame(
+        handle: Long,
+        bgrPixels: ByteBuffer,
+        width: Int,
+        height: Int,
+        strideBytes: Int,
+        mirror: Boolean,
+        previewOut: ByteBuffer,
+        rgbOut: ByteBuffer,
+        timestampMs: Long,
+    ): Int {
+        require(bgrPixels.isDirect) { "bgrPixels must be a direct ByteBuffer" }
+        require(rgbOut.isDirect) { "rgbOut must be a direct ByteBuffer" }
+        return nativePreprocessBgrFrame(
+            handle, bgrPixels, width, height, strideBytes, mirror, previewOut, rgbOut, timestampMs,
+        )
+    }
+
+    /**
+     * Like [preprocessBgrFrame], but for YUV 4:2:0 camera frames (NV12, NV21 or I420,
+     * as webcams and CameraX `ImageProxy` deliver them): the planes are read in place
+     * and converted to the BGRA preview natively, so no RGB copy is ever made on the
+     * JVM side. Plane arguments follow Android's `YUV_420_888` description.
+     *
+     * @param yPlane direct buffer of [height] rows of [yRowStride] bytes.
+     * @param uPlane direct buffer of the U samples; for NV12 the interleaved chroma buffer.
+     * @param vPlane direct buffer of the V samples; for NV12 the interleaved buffer one
+     *   byte in (e.g. a [ByteBuffer.slice] at 1).
+     * @param uvRowStride bytes between chroma rows.
+     * @param uvPixelStride bytes between chroma samples: 1 for planar I420, 2 for NV12/NV21.
+     * @param previewOut direct buffer of at least `width * height * 4` bytes.
+     * @param previewRgba write [previewOut] as R, G, B, A (Android `ARGB_8888` bitmaps)
+     *   instead of the BGRA the desktop preview uses.
+     * @param rgbOut direct buffer of at least the full `size * size * 3` bytes (see [squareSize]).
+     * @return side length of the square frame written into [rgbOut].
+     */
+    fun preprocessYuvFrame(
+        handle: Long,
+        yPlane: ByteBuffer,
+        yRowStride: Int,
+        uPlane: ByteBuffer,
+        vPlane: ByteBuffer,
+        uvRowStride: Int,
+        uvPixelStride: Int,
+        width: Int,
+        height: Int,
+        mirror: Boolean,
+        previewOut: ByteBuffer,
+        rgbOut: ByteBuffer,
+        timestampMs: Long,
+        previewRgba: Boolean = false,
+    ): Int {
+        require(yPlane.isDirect && uPlane.isDirect && vPlane.isDirect) { "YUV planes must be direct ByteBuffers" }
+        require(rgbOut.isDirect) { "rgbOut must be a direct ByteBuffer" }
+        return nativePreprocessYuvFrame(
+            handle, yPlane, yRowStride, uPlane, vPlane, uvRowStride, uvPixelStride,
+            width, height, mirror, previewOut, previewRgba, rgbOut, timestampMs,
+        )
+    }
+
+    /** Native address of a direct [buffer], for wrapping it without a copy. */
+    fun directBufferAddress(buffer: ByteBuffer): Long {
+        require(buffer.isDirect) { "buffer must be a direct ByteBuffer" }
+        return nativeDirectBufferAddress(buffer)
+    }
+
+    /**
+     * Instruction set the native frame kernels use on this CPU: "neon", "avx512",
+     * "avx2", "ssse3" or "scalar" (chosen at runtime on x86_64).
+     */
+    fun frameKernelsIsa(): String = nativeFrameKernelsIsa()
+
+    /** Side length of the letterboxed square produced by [preprocessArgb]. */
+    fun squareSize(width: Int, height: Int): Int = maxOf(width, height)
+
+    /**
+     * Create a GestureRecognizer in VIDEO mode (synchronous).
+     *
+     * @param modelPath absolute path to the gesture_recognizer.task model file.
+     * @param callback receives recognition results on the calling thread.
+     * @param options hand count, confidence thresholds and delegate.
+     * @param geometry capture frame the results are mapped to.
+     * @return native pointer (opaque handle).
+     */
+    fun createGestureRecognizer(
+        modelPath: String,
+        callback: GestureResultCallback,
+        options: HandTrackerOptions = HandTrackerOptions(),
+        geometry: CaptureGeometry = CaptureGeometry.NONE,
+    ): Long {
+        return createGestureRecognizer(modelPath, null, options, geometry, callback)
+    }
+
+    /**
+     * Create a GestureRecognizer in VIDEO mode that delivers into a
+     * [ResultRing]; register it with [setResultRing] before the first frame.
+     */
+    fun createGestureRecognizer(
+        modelPath: String,
+        options: HandTrackerOptions = HandTrackerOptions(),
+        geometry: CaptureGeometry = CaptureGeometry.NONE,
+    ): Long {
+        return createGestureRecognizer(modelPath, null, options, geometry, null)
+    }
+
+    /**
+     * Like the ring-mode [createGestureRecognizer], but from the model's bytes
+     * (`base_options.model_asset_buffer`) so no model file is needed.
+     *
+     * @param modelBuffer direct buffer holding gesture_recognizer.task, e.g.
+     *   memory-mapped; MediaPipe copies what it needs, so it may be reused once this returns.
+     */
+    fun createGestureRecognizer(
+        modelBuffer: ByteBuffer,
+        options: HandTrackerOptions = HandTrackerOptions(),
+        geometry: CaptureGeometry = CaptureGeometry.NONE,
+    ): Long {
+        require(modelBuffer.isDirect) { "modelBuffer must be a direct ByteBuffer" }
+        return createGestureRecognizer(null, modelBuffer, options, geometry, null)
+    }
+
+    private fun createGestureRecognizer(
+        modelPath: String?,
+        modelBuffer: ByteBuffer?,
+        options: HandTrackerOptions,
+        geometry: CaptureGeometry,
+        callback: GestureResultCallback?,
+    ): Long = with(options) {
+        checkCurrentBridge()
+        nativeCreateGestureRecognizer(
+            modelPath, modelBuffer, numHands,
+            minHandDetectionConfidence, minHandPresenceConfidence, minTrackingConfidence,
+            delegate.ordinal, geometry.width, geometry.height, geometry.mirrored, callback,
+        )
+    }
+
+    /**
+     * Process a video frame for gesture recognition. Blocks until recognition completes,
+     * then calls the [GestureResultCallback] on the calling thread before returning.
+     *
+     * @param recognizerPtr native pointer from [createGestureRecognizer].
+     * @param rgbPixels RGB byte array (3 bytes per pixel, width*height*3 total).
+     * @param width frame width in pixels.
+     * @param height frame height in pixels.
+     * @param timestampMs monotonically increasing timestamp.
+     */
+    fun recognizeGesture(
+        recognizerPtr: Long,
+        rgbPixels: ByteArray,
+        width: Int,
+        height: Int,
+        timestampMs: Long,
+    ): Boolean {
+        return nativeRecognizeGestureForVideo(recognizerPtr, rgbPixels, width, height, timestampMs)
+    }
+
+    /**
+     * Direct [ByteBuffer] variant of [recognizeGesture]. The buffer is read in place
+     * (no JVM array copy) and may be reused by the caller once this returns.
+     *
+     * @param recognizerPtr native pointer from [createGestureRecognizer].
+     * @param rgbPixels direct buffer of RGB bytes (at least width*height*3).
+     * @param width frame width in pixels.
+     * @param height frame height in pixels.
+     * @param timestampMs monotonically increasing timestamp.
+     */
+    fun recognizeGesture(
+        recognizerPtr: Long,
+        rgbPixels: ByteBuffer,
+        width: Int,
+        height: Int,
+        timestampMs: Long,
+    ): Boolean {
+        require(rgbPixels.isDirect) { "rgbPixels must be a direct ByteBuffer" }
+        return nativeRecognizeGestureForVideoBuffer(recognizerPtr, rgbPixels, width, height, timestampMs)
+    }
+
+    /**
+     * Pipelined variant of [recognizeGesture]: copies the frame into a native
+     * latest-frame-wins mailbox and returns immediately. A per-recognizer worker
+     * thread runs the (synchronous, VIDEO-mode) recognizer and delivers results
+     * from that thread, so capture and inference overlap. A frame the worker has
+     * not picked up yet is replaced by the next one.
+     *
+     * Don't mix with [recognizeGesture] on the same recognizer.
+     *
+     * @param recognizerPtr native pointer from [createGestureRecognizer].
+     * @param rgbPixels direct buffer of RGB bytes (at least width*height*3); may be
+     *   reused by the caller once this returns.
+     * @param width frame width in pixels.
+     * @param height frame height in pixels.
+     * @param timestampMs monotonically increasing timestamp.
+     * @return whether the most recently completed recognition succeeded.
+     */
+    fun recognizeGestureAsync(
+        recognizerPtr: Long,
+        rgbPixels: ByteBuffer,
+        width: Int,
+        height: Int,
+        timestampMs: Long,
+    ): Boolean {
+        require(rgbPixels.isDirect) { "rgbPixels must be a direct ByteBuffer" }
+        return nativeRecognizeGestureAsync(recognizerPtr, rgbPixels, width, height, timestampMs)
+    }
+
+    /**
+     * Run full gesture recognition on [recognizerPtr] only as often as [schedule]
+     * asks, tracking landmarks with a HandLandmarker in between; disable with a
+     * null schedule. Tracking-only frames are delivered like any other, with each
+     * hand's gesture name and score carried over from the last full recognition.
+     * [HandTrackerStats.recognitionRate] reports the resulting rate.
+     *
+     * @param landmarkerModelPath hand_landmarker.task used for tracking-only frames.
+     * @throws RuntimeException if the landmarker can't be created.
+     */
+    fun setGestureSchedule(recognizerPtr: Long, landmarkerModelPath: String, schedule: GestureSchedule?) {
+        if (schedule == null) {
+            nativeSetGestureSchedule(recognizerPtr, null, null, 1, 1f)
+        } else {
+            nativeSetGestureSchedule(
+                recognizerPtr, landmarkerModelPath, null, schedule.interval, schedule.motionThreshold,
+            )
+        }
+    }
+
+    /**
+     * [setGestureSchedule] with the tracking landmarker created from the bytes of
+     * hand_landmarker.task in the direct [landmarkerModel] buffer.
+     */
+    fun setGestureSchedule(recognizerPtr: Long, landmarkerModel: ByteBuffer, schedule: GestureSchedule?) {
+        require(landmarkerModel.isDirect) { "landmarkerModel must be a direct ByteBuffer" }
+        if (schedule == null) {
+            nativeSetGestureSchedule(recognizerPtr, null, null, 1, 1f)
+        } else {
+            nativeSetGestureSchedule(
+                recognizerPtr, null, landmarkerModel, schedule.interval, schedule.motionThreshold,
+            )
+        }
+    }
+
+    /**
+     * [createLandmarker] for an [isLegacyBridge] library: default options, no
+     * [ResultRing], and one landmarker at a time. [callback] receives the baseline
+     * layout `[numHands, per-hand(handedness, 21*xyz)]` (64 floats per hand), normalized
+     * to the submitted square with handedness as MediaPipe reports it. Feed it with
+     * the `ByteArray` [detectAsync].
+     *
+     * @param modelPath absolute path to the hand_landmarker.task model file.
+     */
+    fun createLegacyLandmarker(modelPath: String, callback: ResultCallback): Long {
+        check(isLegacyBridge) { "Only a version-0 bridge needs the legacy landmarker" }
+        return nativeCreateLandmarker(modelPath, callback)
+    }
+
+    /**
+     * [createGestureRecognizer] for an [isLegacyBridge] library. [callback] receives
+     * the baseline layout `[numHands, per-hand(handedness, gestureScore, 21*xyz)]`
+     * (65 floats per hand), normalized to the submitted square with handedness as
+     * MediaPipe reports it. Feed it with the `ByteArray` [recognizeGesture].
+     *
+     * @param modelPath absolute path to the gesture_recognizer.task model file.
+     */
+    fun createLegacyGestureRecognizer(modelPath: String, numHands: Int, callback: GestureResultCallback): Long {
+        check(isLegacyBridge) { "Only a version-0 bridge needs the legacy gesture recognizer" }
+        return nativeCreateGestureRecognizer(modelPath, numHands, callback)
+    }
+
+    /**
+     * Close the GestureRecognizer and release native resources.
+     * Stops the [recognizeGestureAsync] worker first, if one was started.
+     */
+    fun closeGestureRecognizer(recognizerPtr: Long) {
+        nativeCloseGestureRecognizer(recognizerPtr)
+    }
+
+    /**
+     * Open camera [deviceIndex] in the native library (OpenCV VideoCapture on the
+     * platform backend), asking for [width] x [height] at [fps]; the driver may pick
+     * the nearest mode, so use the returned size. Pass the camera to [startCapture]
+     * or release it with [closeCamera].
+     *
+     * @throws RuntimeException if the camera can't be opened.
+     */
+    fun openCamera(deviceIndex: Int, width: Int, height: Int, fps: Int): NativeCamera {
+        val size = IntArray(2)
+        val handle = nativeOpenCamera(deviceIndex, width, height, fps, size)
+        return NativeCamera(handle, size[0], size[1])
+    }
+
+    /** Release a camera that was not handed to [startCapture]. */
+    fun closeCamera(camera: NativeCamera) {
+        nativeCloseCamera(camera.handle)
+    }
+
+    /**
+     * Feed tracker [handle] (landmarker or gesture recognizer) from [camera] on a
+     * native thread: capture, preview conversion, preprocessing and submission all
+     * happen natively, and frames never cross JNI. The tracker takes ownership of
+     * [camera]; [stopCapture] or closing the tracker stops the thread and closes it.
+     * Don't submit frames from the JVM to the same tracker meanwhile.
+     *
+     * @param mirror flip frames horizontally (match the tracker's [CaptureGeometry]).
+     */
+    fun startCapture(handle: Long, camera: NativeCamera, mirror: Boolean, callback: CaptureCallback) {
+        nativeStartCapture(handle, camera.handle, mirror, callback)
+    }
+
+    /**
+     * Stop the capture thread started by [startCapture], if any, and close its camera.
+     * Must not be called from a [CaptureCallback].
+     */
+    fun stopCapture(handle: Long) {
+        nativeStopCapture(handle)
+    }
+
+    /**
+     * Warm up tracker [handle] on a native background thread: [iterations] frames
+     * (at most 32) run through its graphs before the first real frame, so model
+     * initialization and first-inference allocations don't stall the camera stream.
+     * The first real frame cancels the remaining warm-up; closing the handle aborts
+     * it. Results of warm-up frames are never delivered.
+     *
+     * Without [rgbFrame] a mid-gray square of the capture size is used, which warms
+     * palm detection and the graph itself; a frame showing a hand also warms the
+     * landmark and gesture models.
+     *
+     * @param rgbFrame optional packed RGB frame of [width] x [height] in a direct buffer.
+     * @return false (and nothing runs) if [handle] has already seen frames or been
+     *   warmed up.
+     */
+    fun warmUp(
+        handle: Long,
+        iterations: Int,
+        rgbFrame: ByteBuffer? = null,
+        width: Int = 0,
+        height: Int = 0,
+    ): Boolean {
+        require(rgbFrame == null || rgbFrame.isDirect) { "rgbFrame must be a direct ByteBuffer" }
+        return nativeWarmUp(handle, iterations, rgbFrame, width, height)
+    }
+
+    /**
+     * Start a new camera session on a tracker kept open across [stopCapture] (or a
+     * JVM capture loop ending): forgets the previous session's ROI, smoothing,
+     * prediction and gesture-schedule state. Timestamps must keep increasing over
+     * the handle's lifetime, so continue from the returned value; [startCapture]
+     * does so by itself.
+     *
+     * @return first timestamp the new session may submit.
+     */
+    fun resetSession(handle: Long): Long = nativeResetSession(handle)
+
+    /** Most frames one [detectBatch] call takes. */
+    const val MAX_BATCH_FRAMES = 16
+
+    /**
+     * Create a batch object whose frames run on [workers] native threads (0..8) plus
+     * the calling thread. A worker per additional performance core is a good fit;
+     * frames beyond the thread count queue up within the batch.
+     */
+    fun createBatch(workers: Int, maxFrames: Int = MAX_BATCH_FRAMES): Batch {
+        require(maxFrames in 1..MAX_BATCH_FRAMES) { "maxFrames must be 1..$MAX_BATCH_FRAMES" }
+        return Batch(nativeCreateBatch(workers), maxFrames)
+    }
+
+    /**
+     * Recognize one frame for each of several gesture recognizers — one per camera,
+     * or per ROI of one camera — in a single JNI crossing, spread across [batch]'s
+     * native workers. Blocks until all are done.
+     *
+     * Frame `i` is packed RGB in the direct buffer [frames] at byte offset
+     * `layout[3i]`, `layout[3i + 1]` x `layout[3i + 2]` pixels, for
+     * `recognizers[i]` at `timestampsMs[i]` (increasing per recognizer, as for
+     * [recognizeGesture]). Its result lands in slot `i` of [Batch.results]; a frame
+     * that failed leaves an empty slot and `recognized[i] = false`. Results go only
+     * there, not to the recognizers' callbacks or rings.
+     *
+     * Recognizers must be distinct and not driven elsewhere meanwhile — no
+     * [startCapture] or [recognizeGestureAsync] on them.
+     *
+     * @return number of frames recognized.
+     */
+    fun detectBatch(
+        batch: Batch,
+        recognizers: LongArray,
+        frames: ByteBuffer,
+        layout: IntArray,
+        timestampsMs: LongArray,
+        recognized: BooleanArray,
+    ): Int {
+        require(frames.isDirect) { "frames must be a direct ByteBuffer" }
+        val results = batch.results
+        val gestureNames = nativeDetectBatch(
+            batch.handle, recognizers, frames, layout, timestampsMs,
+            results.byteBuffer, results.slotCount, recognized,
+        )
+        while (batch.knownGestureNames < gestureNames) {
+            val id = batch.knownGestureNames++
+            nativeBatchGestureName(batch.handle, id)?.let { results.setGestureName(id, it) }
+        }
+        return (0 until recognizers.size).count { recognized[it] }
+    }
+
+    /** Stop [batch]'s workers. Its recognizers stay open. */
+    fun closeBatch(batch: Batch) {
+        nativeCloseBatch(batch.handle)
+    }
+
+    // --- JNI native declarations ---
+
+    private external fun nativeSetResultRing(
+        handle: Long,
+        ringBuffer: ByteBuffer?,
+        slotCount: Int,
+        slotFloats: Int,
+        callback: RingCallback?,
+    )
+
+    private external fun nativeSetLandmarkSmoothing(
+        handle: Long,
+        enabled: Boolean,
+        minCutoff: Float,
+        beta: Float,
+        derivativeCutoff: Float,
+    )
+
+    private external fun nativeGetDelegate(handle: Long): Int
+    private external fun nativeSetResultLog(handle: Long, path: String?, maxRecords: Int)
+    private external fun nativeLoadAslClassifier(handle: Long, modelPath: String?)
+    private external fun nativeNanoTime(): Long
+    private external fun nativeReadLatest(handle: Long, out: FloatBuffer): Long
+    private external fun nativeLatestGestureName(handle: Long, id: Int): String?
+    private external fun nativeSampleLandmarks(handle: Long, nowNanos: Long, out: FloatArray): Int
+
+    private external fun nativeCreateLandmarker(
+        modelPath: String?,
+        modelBuffer: ByteBuffer?,
+        numHands: Int,
+        detectionConfidence: Float,
+        presenceConfidence: Float,
+        trackingConfidence: Float,
+        delegate: Int,
+        captureWidth: Int,
+        captureHeight: Int,
+        mirrored: Boolean,
+        callback: ResultCallback?,
+    ): Long
+    private external fun nativeDetectAsync(
+        landmarkerPtr: Long,
+        pixelData: ByteArray,
+        width: Int,
+        height: Int,
+        timestampMs: Long,
+    )
+    private external fun nativeDetectAsyncBuffer(
+        landmarkerPtr: Long,
+        pixelBuffer: ByteBuffer,
+        width: Int,
+        height: Int,
+        timestampMs: Long,
+    )
+    private external fun nativePreprocessArgbRoi(
+        trackerPtr: Long,
+        argbPixels: IntArray,
+        width: Int,
+        height: Int,
+        mirror: Boolean,
+        rgbOut: ByteBuffer,
+        timestampMs: Long,
+    ): Int
+
+    private external fun nativePreprocessBgrFrame(
+        trackerPtr: Long,
+        bgrPixels: ByteBuffer,
+        width: Int,
+        height: Int,
+        srcStride: Int,
+        mirror: Boolean,
+        previewOut: ByteBuffer,
+        rgbOut: ByteBuffer,
+        timestampMs: Long,
+    ): Int
+
+    private external fun nativePreprocessYuvFrame(
+        trackerPtr: Long,
+        yPlane: ByteBuffer,
+        yRowStride: Int,
+        uPlane: ByteBuffer,
+        vPlane: ByteBuffer,
+        uvRowStride: Int,
+        uvPixelStride: Int,
+        width: Int,
+        height: Int,
+        mirror: Boolean,
+        previewOut: ByteBuffer,
+        previewRgba: Boolean,
+        rgbOut: ByteBuffer,
+        timestampMs: Long,
+    ): Int
+
+    private external fun nativeDirectBufferAddress(buffer: ByteBuffer): Long
+    private external fun nativeBridgeVersion(): Int
+
+    private external fun nativeFrameKernelsIsa(): String
+
+    private external fun nativeGetStats(): LongArray
+    private external fun nativeResetStats()
+    private external fun nativeSetFlowControl(landmarkerPtr: Long, maxInFlight: Int, policy: Int)
+    private external fun nativeGetDroppedFrames(landmarkerPtr: Long): Long
+    private external fun nativeCloseLandmarker(landmarkerPtr: Long)
+
+    private external fun nativePreprocessArgb(
+        argbPixels: IntArray,
+        width: Int,
+        height: Int,
+        mirror: Boolean,
+        rgbOut: ByteBuffer,
+    ): Int
+
+    private external fun nativeCreateGestureRecognizer(
+        modelPath: String?,
+        modelBuffer: ByteBuffer?,
+        numHands: Int,
+        detectionConfidence: Float,
+        presenceConfidence: Float,
+        trackingConfidence: Float,
+        delegate: Int,
+        captureWidth: Int,
+        captureHeight: Int,
+        mirrored: Boolean,
+        callback: GestureResultCallback?,
+    ): Long
+
+    private external fun nativeRecognizeGestureForVideo(
+        recognizerPtr: Long,
+        pixelData: ByteArray,
+        width: Int,
+        height: Int,
+        timestampMs: Long,
+    ): Boolean
+
+    private external fun nativeRecognizeGestureForVideoBuffer(
+        recognizerPtr: Long,
+        pixelBuffer: ByteBuffer,
+        width: Int,
+        height: Int,
+        timestampMs: Long,
+    ): Boolean
+
+    private external fun nativeRecognizeGestureAsync(
+        recognizerPtr: Long,
+        pixelBuffer: ByteBuffer,
+        width: Int,
+        height: Int,
+        timestampMs: Long,
+    ): Boolean
+
+    private external fun nativeSetGestureSchedule(
+        recognizerPtr: Long,
+        modelPath: String?,
+        modelBuffer: ByteBuffer?,
+        interval: Int,
+        motionThreshold: Float,
+    )
+
+    private external fun nativeCloseGestureRecognizer(recognizerPtr: Long)
+
+    private external fun nativeOpenCamera(
+        deviceIndex: Int,
+        width: Int,
+        height: Int,
+        fps: Int,
+        sizeOut: IntArray,
+    ): Long
+
+    private external fun nativeCloseCamera(cameraPtr: Long)
+
+    private external fun nativeStartCapture(
+        trackerPtr: Long,
+        cameraPtr: Long,
+        mirror: Boolean,
+        callback: CaptureCallback,
+    )
+
+    private external fun nativeStopCapture(trackerPtr: Long)
+
+    private external fun nativeWarmUp(
+        trackerPtr: Long,
+        iterations: Int,
+        rgbFrame: ByteBuffer?,
+        width: Int,
+        height: Int,
+    ): Boolean
+
+    private external fun nativeResetSession(trackerPtr: Long): Long
+
+    private external fun nativeCreateBatch(workers: Int): Long
+
+    private external fun nativeDetectBatch(
+        batchPtr: Long,
+        recognizers: LongArray,
+        frames: ByteBuffer,
+        layout: IntArray,
+        timestampsMs: LongArray,
+        out: ByteBuffer,
+        outSlots: Int,
+        recognized: BooleanArray,
+    ): Int
+
+    private external fun nativeBatchGestureName(batchPtr: Long, id: Int): String?
+
+    private external fun nativeCloseBatch(batchPtr: Long)
+
+    // Baseline signatures of the version-0 library (see checkCurrentBridge).
+
+    private external fun nativeCreateLandmarker(modelPath: String, callback: ResultCallback): Long
+
+    private external fun nativeCreateGestureRecognizer(
+        modelPath: String,
+        numHands: Int,
+        callback: GestureResultCallback,
+    ): Long
+}
@@ -0,0 +1,12 @@
+package org.balch.orpheus.core.mediapipe
+
+/** The native library [loadMediaPipeLibrary] loaded, as named in [MediaPipeJni.initialize]'s log. */
+internal class MediaPipeLibrary(val name: String, val gpu: Boolean)
+
+/**
+ * Load `mediapipe_jni`, or `mediapipe_jni_gpu` for [InferenceDelegate.GPU] where that
+ * variant is bundled, into the process.
+ *
+ * @throws IllegalStateException or [UnsatisfiedLinkError] if no variant can be loaded.
+ */
+internal expect fun loadMediaPipeLibrary(delegate: InferenceDelegate): MediaPipeLibrary
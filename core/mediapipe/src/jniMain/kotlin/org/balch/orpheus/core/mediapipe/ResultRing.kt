@@ -0,0 +1,125 @@
+package org.balch.orpheus.core.mediapipe
+
+import org.balch.orpheus.core.gestures.HandFeatures
+import org.balch.orpheus.core.gestures.HandLandmark
+import org.balch.orpheus.core.gestures.Handedness
+import java.nio.ByteBuffer
+import java.nio.ByteOrder
+import java.nio.FloatBuffer
+
+/**
+ * Fixed ring of packed result slots shared with the native bridge.
+ *
+ * Registered via [MediaPipeJni.setResultRing]; the native side writes each frame's
+ * result into the next slot in place and only signals the slot index, so the
+ * hand-off from native code allocates nothing on the JVM. Reading a slot through the
+ * accessors below is allocation-free too; decoding it with [result] is not.
+ *
+ * Slot format: `[numHands, per-hand(handedness, gestureId, gestureScore, 21*xyz,
+ * features, aslClassId, aslScore)]`, per hand [HAND_FLOATS] floats, at most
+ * [MAX_HANDS] hands. `gestureId` is -1 when there is no gesture; names are resolved
+ * through [gestureName]. `features` is the [HandFeatures] vector the native side
+ * computed for the hand. `aslClassId` is -1 unless a custom classifier is loaded
+ * (see [MediaPipeJni.loadAslClassifier]).
+ *
+ * A slot stays valid until the native side wraps around to it again, i.e. for
+ * [slotCount] - 1 further results.
+ */
+class ResultRing(val slotCount: Int = DEFAULT_SLOT_COUNT) {
+
+    companion object {
+        const val MAX_HANDS = 2
+        const val LANDMARK_COUNT = 21
+        const val HAND_FLOATS = 3 + LANDMARK_COUNT * 3 + HandFeatures.SIZE + 2
+        const val SLOT_FLOATS = 1 + MAX_HANDS * HAND_FLOATS
+        const val DEFAULT_SLOT_COUNT = 4
+        private const val MAX_GESTURES = 32
+    }
+
+    init {
+        require(slotCount > 0) { "slotCount must be positive" }
+    }
+
+    /** Backing memory handed to the native side (native byte order). */
+    internal val byteBuffer: ByteBuffer = ByteBuffer
+        .allocateDirect(slotCount * SLOT_FLOATS * Float.SIZE_BYTES)
+        .order(ByteOrder.nativeOrder())
+
+    private val floats: FloatBuffer = byteBuffer.asFloatBuffer()
+
+    private val gestureNames = arrayOfNulls<String>(MAX_GESTURES)
+
+    fun numHands(slot: Int): Int = floats.get(slotBase(slot)).toInt()
+
+    /**
+     * `>= 0.5` for the user's right hand. Mirrored trackers have MediaPipe's label
+     * inverted natively (see [MediaPipeJni.CaptureGeometry]).
+     */
+    fun handedness(slot: Int, hand: Int): Float = floats.get(handBase(slot, hand))
+
+    fun gestureId(slot: Int, hand: Int): Int = floats.get(handBase(slot, hand) + 1).toInt()
+
+    fun gestureScore(slot: Int, hand: Int): Float = floats.get(handBase(slot, hand) + 2)
+
+    fun landmarkX(slot: Int, hand: Int, index: Int): Float = floats.get(landmarkBase(slot, hand, index))
+
+    fun landmarkY(slot: Int, hand: Int, index: Int): Float = floats.get(landmarkBase(slot, hand, index) + 1)
+
+    fun landmarkZ(slot: Int, hand: Int, index: Int): Float = floats.get(landmarkBase(slot, hand, index) + 2)
+
+    /** Feature [index] of the hand, see [HandFeatures] for the layout. */
+    fun feature(slot: Int, hand: Int, index: Int): Float =
+        floats.get(handBase(slot, hand) + 3 + LANDMARK_COUNT * 3 + index)
+
+    /** Custom ASL classifier class ID, or -1 when there is none. */
+    fun aslClassId(slot: Int, hand: Int): Int = floats.get(aslBase(slot, hand)).toInt()
+
+    fun aslScore(slot: Int, hand: Int): Float = floats.get(aslBase(slot, hand) + 1)
+
+    /** Name for an interned gesture ID, or null for -1 / unknown IDs. */
+    fun gestureName(id: Int): String? = gestureNames.getOrNull(id)
+
+    /**
+     * Slot [slot] as [HandTracker.results] emits it: null for a frame without hands.
+     * Coordinates and handedness are already final (see [MediaPipeJni.CaptureGeometry]).
+     *
+     * The result is a fresh immutable copy, since collectors may keep it after the slot
+     * is reused. That costs per hand 21 [HandLandmark]s, their list, a [TrackedHand] and
+     * its [HandFeatures] array, plus the result and its hand list. Consumers that must
+     * not allocate read the slot through the accessors or poll [HandTracker.readLatest].
+     *
+     * @param aslLabels labels of the loaded ASL classifier, indexed by class ID.
+     */
+    fun result(slot: Int, frameSequence: Long, aslLabels: List<String> = emptyList()): HandTrackingResult? {
+        val numHands = numHands(slot)
+        if (numHands == 0) return null
+        val hands = List(numHands) { h ->
+            val handedness = if (handedness(slot, h) >= 0.5f) Handedness.RIGHT else Handedness.LEFT
+            val landmarks = List(LANDMARK_COUNT) { i ->
+                HandLandmark(x = landmarkX(slot, h, i), y = landmarkY(slot, h, i), z = landmarkZ(slot, h, i))
+            }
+            val features = HandFeatures(FloatArray(HandFeatures.SIZE) { feature(slot, h, it) })
+            val aslLabel = aslLabels.getOrNull(aslClassId(slot, h))
+            TrackedHand(
+                landmarks, handedness, gestureName(gestureId(slot, h)), gestureScore(slot, h), features,
+                aslLabel = aslLabel,
+                aslConfidence = if (aslLabel != null) aslScore(slot, h) else 0f,
+            )
+        }
+        return HandTrackingResult(hands = hands, frameSequence = frameSequence)
+    }
+
+    /** Records a name the native side interned (ring callback or [MediaPipeJni.detectBatch]). */
+    internal fun setGestureName(id: Int, name: String) {
+        if (id in gestureNames.indices) gestureNames[id] = name
+    }
+
+    private fun slotBase(slot: Int): Int = slot * SLOT_FLOATS
+
+    private fun handBase(slot: Int, hand: Int): Int = slotBase(slot) + 1 + hand * HAND_FLOATS
+
+    private fun aslBase(slot: Int, hand: Int): Int =
+        handBase(slot, hand) + 3 + LANDMARK_COUNT * 3 + HandFeatures.SIZE
+
+    private fun landmarkBase(slot: Int, hand: Int, index: Int): Int = handBase(slot, hand) + 3 + index * 3
+}
@@ -0,0 +1,57 @@
+package org.balch.orpheus.core.mediapipe
+
+import java.nio.ByteBuffer
+
+/**
+ * Rotating set of direct BGRA preview surfaces the native bridge fills in place
+ * (see [MediaPipeJni.preprocessBgrFrame]), so publishing a camera preview costs no
+ * per-frame pixel array on the JVM.
+ *
+ * Each [CameraFrame] from [publish] wraps its surface by native address and keeps
+ * the buffer reachable. A surface is rewritten every [depth] frames, so a consumer
+ * still drawing a frame that old sees newer pixels rather than freed memory.
+ * Only the capture thread may call [next] and [publish].
+ */
+class CameraFramePool(private val depth: Int = DEFAULT_DEPTH) {
+
+    companion object {
+        const val DEFAULT_DEPTH = 3
+    }
+
+    init {
+        require(depth >= 2) { "depth must be at least 2" }
+    }
+
+    private val buffers = arrayOfNulls<ByteBuffer>(depth)
+    private val addresses = LongArray(depth)
+    private var current = -1
+    private var sequence = 0L
+
+    /**
+     * Advance to the next surface, sized for a [width] x [height] frame, and return
+     * it for the native side to write into.
+     */
+    fun next(width: Int, height: Int): ByteBuffer {
+        current = (current + 1) % depth
+        val bytes = width * height * 4
+        val existing = buffers[current]
+        if (existing != null && existing.capacity() >= bytes) return existing
+        return ByteBuffer.allocateDirect(bytes).also {
+            buffers[current] = it
+            addresses[current] = MediaPipeJni.directBufferAddress(it)
+        }
+    }
+
+    /** Wrap the surface last returned by [next] as a preview frame. */
+    fun publish(width: Int, height: Int): CameraFrame {
+        val buffer = checkNotNull(buffers.getOrNull(current)) { "next() not called" }
+        return CameraFrame(
+            pixels = CameraFrame.NO_PIXELS,
+            width = width,
+            height = height,
+            pixelAddress = addresses[current],
+            pixelOwner = buffer,
+            sequence = sequence++,
+        )
+    }
+}
@@ -1,10 +1,12 @@
 package org.balch.orpheus.core.mediapipe
 
 import com.diamondedge.logging.logging
+import kotlinx.coroutines.CancellationException
 import kotlinx.coroutines.CoroutineScope
 import kotlinx.coroutines.Dispatchers
 import kotlinx.coroutines.Job
 import kotlinx.coroutines.SupervisorJob
+import kotlinx.coroutines.awaitCancellation
 import kotlinx.coroutines.cancel
 import kotlinx.coroutines.flow.Flow
 import kotlinx.coroutines.flow.MutableSharedFlow
@@ -24,6 +26,12 @@ import org.bytedeco.javacv.Java2DFrameConverter
 import java.awt.geom.AffineTransform
 import java.awt.image.BufferedImage
 import java.awt.image.DataBufferInt
+import java.io.File
+import java.nio.ByteBuffer
+import java.nio.ByteOrder
+import java.util.concurrent.locks.ReentrantReadWriteLock
+import kotlin.concurrent.read
+import kotlin.concurrent.write
 
 /**
  * Desktop implementation of [HandTracker] using JavaCV for camera capture
@@ -31,11 +39,49 @@ import java.awt.image.DataBufferInt
  *
  * Camera capture and hand detection are decoupled:
  * - The capture loop grabs frames and publishes camera preview at full framerate.
- * - Each frame is sent to MediaPipe via [MediaPipeJni.detectAsync] (non-blocking).
+ * - Each frame is sent to MediaPipe via [MediaPipeJni.recognizeGestureAsync] or
+ *   [MediaPipeJni.detectAsync] (both non-blocking).
  * - Detection results arrive asynchronously via a native callback.
+ *
+ * With [nativeCapture] (or `-Dorpheus.camera.native=true`) the camera is read by
+ * the native library instead ([MediaPipeJni.startCapture]) and frames never reach
+ * the JVM; JavaCV remains the fallback if the native camera can't be opened.
+ *
+ * Each tracker owns its own native handle and [ResultRing], so one instance
+ * per [deviceIndex] can run concurrently.
+ *
+ * A new native tracker is warmed up in the background ([MediaPipeJni.warmUp]);
+ * [prepare] does that ahead of [start]. With [keepAlive] (or
+ * `-Dorpheus.tracker.keepAlive=true`) [stop] leaves it open and idle, and the next
+ * [start] continues on it instead of paying graph start-up again; [release]
+ * closes it.
+ *
+ * With [HandTrackerOptions.delegate] GPU (or `-Dorpheus.tracker.gpu=true`) the
+ * GPU-enabled native library is loaded where bundled and gesture recognition runs
+ * on Metal / OpenGL ES, leaving the CPU cores to the synth; anything that can't
+ * run there stays on CPU.
+ *
+ * With [resultLog] (or `-Dorpheus.tracker.resultLog=<path>`) every result is also
+ * written to that file ([MediaPipeJni.setResultLog]) for replay through
+ * [ReplayHandTracker]; each new native tracker starts the file afresh.
+ *
+ * On a version-0 native library ([MediaPipeJni.isLegacyBridge]) the tracker falls
+ * back to the original pipeline: JavaCV capture, Kotlin mirror and letterbox, and
+ * per-frame callbacks. Warm-up, keep-alive, ROI crop, smoothing, native capture,
+ * result logging, stats, [sampleLandmarks] and [readLatest] are then unavailable.
  */
 class DesktopHandTracker(
     private val deviceIndex: Int = 0,
+    private val options: HandTrackerOptions = HandTrackerOptions(
+        delegate = if (System.getProperty("orpheus.tracker.gpu") == "true") {
+            InferenceDelegate.GPU
+        } else {
+            InferenceDelegate.CPU
+        },
+    ),
+    private val nativeCapture: Boolean = System.getProperty("orpheus.camera.native") == "true",
+    private val keepAlive: Boolean = System.getProperty("orpheus.tracker.keepAlive") == "true",
+    private val resultLog: File? = System.getProperty("orpheus.tracker.resultLog")?.let(::File),
 ) : HandTracker {
 
     private val log = logging("DesktopHandTracker")
@@ -51,10 +97,20 @@ class DesktopHandTracker(
                 else -> null
             }
         }
+
+        private const val CAPTURE_WIDTH = 640
+        private const val CAPTURE_HEIGHT = 480
+        private const val CAPTURE_FPS = 30
+
+        /** Synthetic frames run through a new tracker before the camera's first. */
+        private const val WARM_UP_ITERATIONS = 3
     }
 
     private var scope = CoroutineScope(SupervisorJob() + Dispatchers.IO)
+
+    @Volatile
     private var captureJob: Job? = null
+    private var prepareJob: Job? = null
 
     private val _results = MutableSharedFlow<HandTrackingResult?>(extraBufferCapacity = 1)
     override val results: Flow<HandTrackingResult?> = _results.asSharedFlow()
@@ -82,106 +138,137 @@ class DesktopHandTracker(
     @Volatile
     private var nativePtr: Long = 0
 
+    // Serializes closing the native handle (write lock) against [sampleLandmarks]
+    // and [readLatest] polling (read lock; [readLatest] only tries, so a realtime
+    // caller never waits on a close).
+    private val handleLock = ReentrantReadWriteLock()
+
+    // Per polling thread: [readLatest] needs a direct buffer to copy into.
+    private val latestBuffers = ThreadLocal.withInitial {
+        ByteBuffer.allocateDirect(ResultRing.SLOT_FLOATS * Float.SIZE_BYTES)
+            .order(ByteOrder.nativeOrder())
+            .asFloatBuffer()
+    }
+
     @Volatile
     private var useGestureRecognizer: Boolean = false
 
-    // Stored after camera init so landmark coordinates can be remapped from
-    // the padded-square space back to the original camera aspect ratio.
-    @Volatile
-    private var captureWidth: Int = 0
+    // Geometry [nativePtr] was created for; a kept-alive tracker is reused only
+    // when the camera delivers the same size.
+    private var trackerGeometry: MediaPipeJni.CaptureGeometry? = null
+
+    // Reused direct buffer for the RGB inference frame — handed to the native
+    // side without a JVM array copy. Only touched from the capture coroutine.
+    private var rgbBuffer: ByteBuffer? = null
+
+    // Preview surfaces for BGR24 frames, filled natively alongside the RGB frame.
+    private val framePool = CameraFramePool()
+
+    // Pre-allocated result slots the native bridge writes into (see [ResultRing]).
+    private val resultRing = ResultRing()
+
+    // Labels of the bundled custom ASL classifier, indexed by class ID; empty without one.
     @Volatile
-    private var captureHeight: Int = 0
+    private var aslLabels: List<String> = emptyList()
 
     /**
-     * Callback from MediaPipe native thread (hand landmarker fallback).
-     * Parses the float array and emits to [_results].
+     * Callback from the native bridge (MediaPipe thread for the hand landmarker
+     * fallback, native gesture worker thread for the gesture recognizer).
+     * Emits the packed slot to [_results].
      */
-    private val resultCallback = object : MediaPipeJni.ResultCallback {
-        override fun onResult(result: FloatArray?, timestampMs: Long) {
-            if (result != null) {
-                _results.tryEmit(parseResult(result, timestampMs))
-            } else {
-                _results.tryEmit(null)
-            }
+    private val slotCallback = object : MediaPipeJni.SlotCallback {
+        override fun onSlot(slot: Int, timestampMs: Long) {
+            _results.tryEmit(resultRing.result(slot, timestampMs, aslLabels))
+        }
+    }
+
+    /** Preview side of native capture; called on the native capture thread. */
+    private val captureCallback = object : MediaPipeJni.CaptureCallback {
+        override fun previewBuffer(width: Int, height: Int): ByteBuffer = framePool.next(width, height)
+
+        override fun onPreview(width: Int, height: Int, timestampMs: Long) {
+            _cameraFrame.value = framePool.publish(width, height)
+        }
+
+        override fun onCaptureStopped(reason: String) {
+            System.err.println("[Orpheus] Native camera capture stopped: $reason")
+            _cameraFrame.value = null
+            _results.tryEmit(null)
         }
     }
 
     /**
-     * Callback from MediaPipe native thread (gesture recognizer).
-     * Parses the gesture float array and emits to [_results].
+     * Create and warm up the native tracker in the background for the default
+     * capture size, so the first [start] doesn't wait for graph start-up. [start]
+     * reuses it when the camera delivers that size.
      */
-    private val gestureResultCallback = object : MediaPipeJni.GestureResultCallback {
-        override fun onResult(result: FloatArray?, gestureNames: Array<String?>?, timestampMs: Long) {
-            if (result != null) {
-                _results.tryEmit(parseGestureResult(result, gestureNames, timestampMs))
-            } else {
-                _results.tryEmit(null)
+    fun prepare() {
+        if (captureJob?.isActive == true || prepareJob != null) return
+        prepareJob = scope.launch {
+            try {
+                MediaPipeJni.initialize(options.delegate)
+                if (MediaPipeJni.isLegacyBridge) return@launch
+                acquireTracker(MediaPipeJni.CaptureGeometry(CAPTURE_WIDTH, CAPTURE_HEIGHT, mirrored = true))
+            } catch (e: Exception) {
+                System.err.println("[Orpheus] Hand tracker preparation failed: ${e.message}")
             }
         }
     }
 
     override fun start() {
         if (captureJob?.isActive == true) return
+        val prepared = prepareJob
+        prepareJob = null
 
         captureJob = scope.launch {
             var grabber: FFmpegFrameGrabber? = null
+            var keepTracker = keepAlive
             try {
-                // Initialize JNI — try GestureRecognizer first, fall back
-                // to HandLandmarker if model is unavailable.
-                MediaPipeJni.initialize()
-
-                val gestureModelPath = try {
-                    ModelExtractor.getGestureModelPath()
-                } catch (_: Exception) { null }
+                prepared?.join()
+                MediaPipeJni.initialize(options.delegate)
+                if (MediaPipeJni.isLegacyBridge) {
+                    keepTracker = false
+                    runLegacyCapture()
+                    return@launch
+                }
 
-                if (gestureModelPath != null) {
-                    useGestureRecognizer = true
-                    nativePtr = MediaPipeJni.createGestureRecognizer(
-                        gestureModelPath, gestureResultCallback,
-                    )
-                } else {
-                    useGestureRecognizer = false
-                    val modelPath = ModelExtractor.getModelPath()
-                    nativePtr = MediaPipeJni.createLandmarker(modelPath, resultCallback)
+                val camera = if (nativeCapture) openNativeCamera() else null
+                if (camera != null) {
+                    runNativeCapture(camera)
+                    return@launch
                 }
 
                 grabber = FFmpegFrameGrabber("$deviceIndex").apply {
                     format = CAMERA_FORMAT
-                    imageWidth = 640
-                    imageHeight = 480
-                    frameRate = 30.0
+                    imageWidth = CAPTURE_WIDTH
+                    imageHeight = CAPTURE_HEIGHT
+                    frameRate = CAPTURE_FPS.toDouble()
                     start()
                 }
 
-                captureWidth = grabber.imageWidth
-                captureHeight = grabber.imageHeight
+                // Frames are mirrored before inference; the native packer maps
+                // landmarks to this capture aspect and resolves handedness.
+                var frameSequence = acquireTracker(
+                    MediaPipeJni.CaptureGeometry(grabber.imageWidth, grabber.imageHeight, mirrored = true),
+                )
 
                 val converter = Java2DFrameConverter()
-                var frameSequence = 0L
                 var consecutiveErrors = 0
 
                 while (isActive) {
                     val frame: Frame? = grabber.grab()
                     if (frame != null && frame.image != null) {
-                        val rawImage = converter.convert(frame)
-                        if (rawImage != null) {
-                            // Mirror horizontally so the preview feels like a natural mirror
-                            // and MediaPipe landmarks are in mirrored coordinates
-                            val bufferedImage = mirrorHorizontal(rawImage)
-
-                            // Publish camera frame for UI preview (non-blocking)
-                            _cameraFrame.value = bufferedImageToCameraFrame(bufferedImage)
-
-                            // Center-crop to square for MediaPipe (non-square causes abort
-                            // in landmark_projection_calculator with NORM_RECT)
-                            val squareImage = padToSquare(bufferedImage)
-
-                            val rgbBytes = bufferedImageToRgb(squareImage)
+                        val timestampMs = frameSequence++
+                        val rgbPixels = reusableRgbBuffer(frame.imageWidth, frame.imageHeight)
+                        val squareSize = preprocessFrame(frame, converter, rgbPixels, timestampMs)
+                        if (squareSize > 0) {
                             if (useGestureRecognizer) {
-                                val ok = MediaPipeJni.recognizeGesture(
-                                    nativePtr, rgbBytes,
-                                    squareImage.width, squareImage.height,
-                                    frameSequence++,
+                                // Non-blocking: inference runs on the native worker
+                                // while this loop grabs the next frame.
+                                val ok = MediaPipeJni.recognizeGestureAsync(
+                                    nativePtr, rgbPixels,
+                                    squareSize, squareSize,
+                                    timestampMs,
                                 )
                                 if (!ok) {
                                     consecutiveErrors++
@@ -195,36 +282,198 @@ class DesktopHandTracker(
                                 consecutiveErrors = 0
                             } else {
                                 MediaPipeJni.detectAsync(
-                                    nativePtr, rgbBytes,
-                                    squareImage.width, squareImage.height,
-                                    frameSequence++,
+                                    nativePtr, rgbPixels,
+                                    squareSize, squareSize,
+                                    timestampMs,
                                 )
                             }
                         }
                     }
                 }
+            } catch (_: CancellationException) {
+                // stop() — cleanup below.
             } catch (e: Exception) {
                 System.err.println("[Orpheus] DesktopHandTracker capture error: ${e.message}")
+                keepTracker = false
             } finally {
                 try {
                     grabber?.stop()
                     grabber?.release()
                 } catch (_: Exception) { /* Ignore cleanup errors. */ }
 
-                if (nativePtr != 0L) {
+                if (keepTracker && nativePtr != 0L) {
+                    // Idle until the next start(); only the camera goes.
                     try {
-                        if (useGestureRecognizer) {
-                            MediaPipeJni.closeGestureRecognizer(nativePtr)
-                        } else {
-                            MediaPipeJni.closeLandmarker(nativePtr)
-                        }
-                    } catch (_: Exception) { /* Ignore cleanup errors. */ }
-                    nativePtr = 0
+                        MediaPipeJni.stopCapture(nativePtr)
+                    } catch (_: Exception) {
+                        closeTracker()
+                    }
+                } else {
+                    closeTracker()
                 }
             }
         }
     }
 
+    /**
+     * Make [nativePtr] a tracker for [geometry]: the open one if it was created for
+     * the same geometry, starting a new session on it, else a new one that warms
+     * up in the background.
+     *
+     * @return first timestamp of this session's frames.
+     */
+    private fun acquireTracker(geometry: MediaPipeJni.CaptureGeometry): Long {
+        if (nativePtr != 0L && trackerGeometry == geometry) {
+            return MediaPipeJni.resetSession(nativePtr)
+        }
+        closeTracker()
+        createTracker(geometry)
+        trackerGeometry = geometry
+        MediaPipeJni.warmUp(nativePtr, WARM_UP_ITERATIONS)
+        return 0L
+    }
+
+    /** Close the native tracker, if any. */
+    private fun closeTracker() = handleLock.write {
+        if (nativePtr == 0L) return@write
+        try {
+            if (useGestureRecognizer) {
+                MediaPipeJni.closeGestureRecognizer(nativePtr)
+            } else {
+                MediaPipeJni.closeLandmarker(nativePtr)
+            }
+        } catch (_: Exception) { /* Ignore cleanup errors. */ }
+        nativePtr = 0
+        trackerGeometry = null
+    }
+
+    /**
+     * Create the native tracker for [geometry] and attach the result ring, smoothing,
+     * ASL classifier and gesture schedule. Tries GestureRecognizer first and falls
+     * back to HandLandmarker if the model is unavailable.
+     */
+    private fun createTracker(geometry: MediaPipeJni.CaptureGeometry) {
+        // Models are passed as in-memory bytes: nothing is written to disk.
+        val gestureModel = try {
+            ModelExtractor.getGestureModelBuffer()
+        } catch (_: Exception) { null }
+
+        if (gestureModel != null) {
+            useGestureRecognizer = true
+            nativePtr = MediaPipeJni.createGestureRecognizer(gestureModel, options, geometry)
+            enableGestureSchedule()
+        } else {
+            useGestureRecognizer = false
+            nativePtr = MediaPipeJni.createLandmarker(ModelExtractor.getModelBuffer(), options, geometry)
+            // Bounded latency beats processing every frame: keep one frame
+            // in the graph and always feed it the freshest capture.
+            MediaPipeJni.setFlowControl(nativePtr, 1, MediaPipeJni.DropPolicy.DROP_OLDEST)
+        }
+        if (options.delegate == InferenceDelegate.GPU) {
+            System.err.println("[Orpheus] Hand tracking inference on ${MediaPipeJni.delegate(nativePtr)}")
+        }
+        MediaPipeJni.setResultRing(nativePtr, resultRing, slotCallback)
+        startResultLog()
+        // Take MediaPipe's frame-to-frame jitter out once, natively,
+        // before any gesture engine sees the landmarks.
+        MediaPipeJni.setLandmarkSmoothing(nativePtr, MediaPipeJni.LandmarkSmoothing())
+        loadAslClassifier()
+    }
+
+    /** Attach [resultLog] to the new tracker; a log that can't be created is skipped (logged). */
+    private fun startResultLog() {
+        val file = resultLog ?: return
+        try {
+            MediaPipeJni.setResultLog(nativePtr, file)
+        } catch (e: Exception) {
+            System.err.println("[Orpheus] Result log disabled: ${e.message}")
+        }
+    }
+
+    /** Open the camera natively, or null (logged) to fall back to JavaCV. */
+    private fun openNativeCamera(): MediaPipeJni.NativeCamera? = try {
+        MediaPipeJni.openCamera(deviceIndex, CAPTURE_WIDTH, CAPTURE_HEIGHT, CAPTURE_FPS)
+    } catch (e: Exception) {
+        System.err.println("[Orpheus] Native camera capture unavailable, using JavaCV: ${e.message}")
+        null
+    }
+
+    /**
+     * Hand [camera] to a native capture thread on the tracker for its geometry and
+     * suspend until cancelled; [start]'s cleanup stops the thread and closes the
+     * camera (and, without [keepAlive], the tracker).
+     */
+    private suspend fun runNativeCapture(camera: MediaPipeJni.NativeCamera) {
+        try {
+            acquireTracker(MediaPipeJni.CaptureGeometry(camera.width, camera.height, mirrored = true))
+            MediaPipeJni.startCapture(nativePtr, camera, true, captureCallback)
+        } catch (e: Exception) {
+            MediaPipeJni.closeCamera(camera)
+            throw e
+        }
+        awaitCancellation()
+    }
+
+    /**
+     * Classify gestures every few frames (or on a pose change) and only track
+     * landmarks in between, to save inference CPU. Failures leave every frame
+     * fully recognized.
+     */
+    private fun enableGestureSchedule() {
+        try {
+            MediaPipeJni.setGestureSchedule(
+                nativePtr, ModelExtractor.getModelBuffer(), MediaPipeJni.GestureSchedule(),
+            )
+        } catch (e: Exception) {
+            System.err.println("[Orpheus] Gesture skip-frame schedule unavailable: ${e.message}")
+        }
+    }
+
+    /** Attach the bundled custom ASL classifier, if any; failures leave it off. */
+    private fun loadAslClassifier() {
+        val modelPath = ModelExtractor.getAslClassifierPath() ?: return
+        try {
+            MediaPipeJni.loadAslClassifier(nativePtr, modelPath)
+            aslLabels = ModelExtractor.getAslClassifierLabels()
+        } catch (e: Exception) {
+            System.err.println("[Orpheus] ASL classifier unavailable: ${e.message}")
+        }
+    }
+
+    override fun stats(): HandTrackerStats? {
+        if (!MediaPipeJni.isInitialized || MediaPipeJni.isLegacyBridge) return null
+        return HandTrackerStats.fromPacked(MediaPipeJni.getStats())
+    }
+
+    override fun sampleLandmarks(out: FloatArray): Int = handleLock.read {
+        val ptr = nativePtr
+        // A kept-alive tracker still holds the last session's hands.
+        if (ptr == 0L || captureJob == null) 0 else MediaPipeJni.sampleLandmarks(ptr, out)
+    }
+
+    override fun readLatest(out: FloatArray): Long {
+        require(out.size >= HandTracker.LATEST_FLOATS) {
+            "out must hold ${HandTracker.LATEST_FLOATS} floats"
+        }
+        val lock = handleLock.readLock()
+        if (!lock.tryLock()) return -1
+        try {
+            val ptr = nativePtr
+            if (ptr == 0L || captureJob == null) return 0
+            val buffer = latestBuffers.get()
+            val sequence = MediaPipeJni.readLatest(ptr, buffer)
+            if (sequence > 0) buffer.get(0, out, 0, HandTracker.LATEST_FLOATS)
+            return sequence
+        } finally {
+            lock.unlock()
+        }
+    }
+
+    override fun latestGestureName(id: Int): String? = handleLock.read {
+        val ptr = nativePtr
+        if (ptr == 0L) null else MediaPipeJni.latestGestureName(ptr, id)
+    }
+
     override fun stop() {
         val job = captureJob ?: return
         captureJob = null
@@ -236,107 +485,256 @@ class DesktopHandTracker(
         _cameraFrame.value = null
     }
 
+    /** [stop] and close the native tracker kept open by [keepAlive] or [prepare]. */
+    fun release() {
+        stop()
+        prepareJob?.let { job -> runBlocking { job.join() } }
+        prepareJob = null
+        closeTracker()
+    }
+
+    // Capture size of the running legacy session, for [remapLandmarks].
+    @Volatile
+    private var legacyCaptureWidth: Int = 0
+    @Volatile
+    private var legacyCaptureHeight: Int = 0
+
+    private val legacyResultCallback = object : MediaPipeJni.ResultCallback {
+        override fun onResult(result: FloatArray?, timestampMs: Long) {
+            _results.tryEmit(result?.let { parseLegacyResult(it, timestampMs) })
+        }
+    }
+
+    private val legacyGestureCallback = object : MediaPipeJni.GestureResultCallback {
+        override fun onResult(result: FloatArray?, gestureNames: Array<String?>?, timestampMs: Long) {
+            _results.tryEmit(result?.let { parseLegacyGestureResult(it, gestureNames, timestampMs) })
+        }
+    }
+
     /**
-     * Parse the JNI result float array into a [HandTrackingResult].
-     * Format: [numHands, hand0_handedness, hand0_x0,y0,z0,...x20,y20,z20, hand1_...].
-     * Per hand: 1 handedness + 21*3 landmarks = 64 floats.
+     * Capture loop for a version-0 native library, which has only the baseline
+     * natives: frames are mirrored, letterboxed and converted to RGB in Kotlin and
+     * recognized synchronously. Runs until cancelled and closes its own tracker, so
+     * [nativePtr] stays 0 and the polling calls report nothing.
      */
-    private fun parseResult(data: FloatArray, timestampMs: Long): HandTrackingResult {
-        val numHands = data[0].toInt()
-        val hands = (0 until numHands).map { h ->
-            val base = 1 + h * 64
-            // Invert handedness: the camera image is mirrored horizontally,
-            // so MediaPipe's "Right" is actually the user's left hand.
-            val handedness = if (data[base] >= 0.5f) Handedness.LEFT else Handedness.RIGHT
-            val rawLandmarks = (0 until 21).map { i ->
-                val off = base + 1 + i * 3
-                HandLandmark(
-                    x = data[off],
-                    y = data[off + 1],
-                    z = data[off + 2],
-                )
+    private suspend fun CoroutineScope.runLegacyCapture() {
+        if (nativeCapture) {
+            System.err.println("[Orpheus] Native camera capture needs a rebuilt MediaPipe bridge, using JavaCV")
+        }
+        var grabber: FFmpegFrameGrabber? = null
+        var ptr = 0L
+        val gestureModelPath = try {
+            ModelExtractor.getGestureModelPath()
+        } catch (_: Exception) { null }
+        try {
+            ptr = if (gestureModelPath != null) {
+                MediaPipeJni.createLegacyGestureRecognizer(gestureModelPath, options.numHands, legacyGestureCallback)
+            } else {
+                MediaPipeJni.createLegacyLandmarker(ModelExtractor.getModelPath(), legacyResultCallback)
+            }
+
+            grabber = FFmpegFrameGrabber("$deviceIndex").apply {
+                format = CAMERA_FORMAT
+                imageWidth = CAPTURE_WIDTH
+                imageHeight = CAPTURE_HEIGHT
+                frameRate = CAPTURE_FPS.toDouble()
+                start()
+            }
+            legacyCaptureWidth = grabber.imageWidth
+            legacyCaptureHeight = grabber.imageHeight
+
+            val converter = Java2DFrameConverter()
+            var frameSequence = 0L
+            var consecutiveErrors = 0
+
+            while (isActive) {
+                val frame: Frame? = grabber.grab()
+                if (frame == null || frame.image == null) continue
+                val rawImage = converter.convert(frame) ?: continue
+                val mirrored = mirrorHorizontal(rawImage)
+                _cameraFrame.value = bufferedImageToCameraFrame(mirrored)
+                val squareImage = padToSquare(mirrored)
+                val rgbBytes = bufferedImageToRgb(squareImage)
+                if (gestureModelPath != null) {
+                    val ok = MediaPipeJni.recognizeGesture(
+                        ptr, rgbBytes, squareImage.width, squareImage.height, frameSequence++,
+                    )
+                    if (!ok) {
+                        consecutiveErrors++
+                        if (consecutiveErrors == 1) {
+                            log.warn { "MediaPipe graph error, skipping frames to recover" }
+                        }
+                        delay(100L)
+                        continue
+                    }
+                    consecutiveErrors = 0
+                } else {
+                    MediaPipeJni.detectAsync(ptr, rgbBytes, squareImage.width, squareImage.height, frameSequence++)
+                }
+            }
+        } finally {
+            try {
+                grabber?.stop()
+                grabber?.release()
+            } catch (_: Exception) { /* Ignore cleanup errors. */ }
+            if (ptr != 0L) {
+                try {
+                    if (gestureModelPath != null) {
+                        MediaPipeJni.closeGestureRecognizer(ptr)
+                    } else {
+                        MediaPipeJni.closeLandmarker(ptr)
+                    }
+                } catch (_: Exception) { /* Ignore cleanup errors. */ }
             }
-            TrackedHand(remapLandmarks(rawLandmarks), handedness)
         }
-        return HandTrackingResult(
-            hands = hands,
-            frameSequence = timestampMs,
-        )
     }
 
     /**
-     * Parse the JNI gesture result float array into a [HandTrackingResult].
-     * Format: [numHands, per-hand(handedness, gestureScore, 21*xyz)]
-     * where per-hand = 65 floats. Gesture names come as a separate String[].
+     * Parse a legacy landmarker result: `[numHands, per-hand(handedness, 21*xyz)]`,
+     * 64 floats per hand, in letterboxed-square coordinates.
+     */
+    private fun parseLegacyResult(data: FloatArray, timestampMs: Long): HandTrackingResult {
+        val hands = List(data[0].toInt()) { h ->
+            val base = 1 + h * 64
+            TrackedHand(legacyLandmarks(data, base + 1), legacyHandedness(data[base]))
+        }
+        return HandTrackingResult(hands = hands, frameSequence = timestampMs)
+    }
+
+    /**
+     * Parse a legacy gesture result: `[numHands, per-hand(handedness, gestureScore,
+     * 21*xyz)]`, 65 floats per hand, with names as a separate array.
      */
-    private fun parseGestureResult(
+    private fun parseLegacyGestureResult(
         data: FloatArray,
         names: Array<String?>?,
         timestampMs: Long,
     ): HandTrackingResult {
-        val numHands = data[0].toInt()
-        val hands = (0 until numHands).map { h ->
+        val hands = List(data[0].toInt()) { h ->
             val base = 1 + h * 65
-            // Invert handedness (camera is mirrored)
-            val handedness = if (data[base] < 0.5f) Handedness.RIGHT else Handedness.LEFT
-            val gestureScore = data[base + 1]
-            val rawLandmarks = (0 until 21).map { i ->
-                val off = base + 2 + i * 3
+            TrackedHand(
+                legacyLandmarks(data, base + 2), legacyHandedness(data[base]),
+                names?.getOrNull(h), data[base + 1],
+            )
+        }
+        return HandTrackingResult(hands = hands, frameSequence = timestampMs)
+    }
+
+    // The frames were mirrored, so MediaPipe's "Right" is the user's left hand.
+    private fun legacyHandedness(label: Float): Handedness =
+        if (label >= 0.5f) Handedness.LEFT else Handedness.RIGHT
+
+    /**
+     * 21 landmarks starting at [offset], mapped from the letterboxed square back to
+     * the capture frame so 0-1 spans only the image region.
+     */
+    private fun legacyLandmarks(data: FloatArray, offset: Int): List<HandLandmark> {
+        val w = legacyCaptureWidth
+        val h = legacyCaptureHeight
+        val size = maxOf(w, h)
+        val padX = (size - w) / 2f
+        val padY = (size - h) / 2f
+        return List(21) { i ->
+            val off = offset + i * 3
+            if (w <= 0 || h <= 0 || w == h) {
                 HandLandmark(data[off], data[off + 1], data[off + 2])
+            } else {
+                HandLandmark((data[off] * size - padX) / w, (data[off + 1] * size - padY) / h, data[off + 2])
             }
-            val gestureName = names?.getOrNull(h)
-            if (gestureScore > 0.5f) {
-                log.debug { "GR frame: name=$gestureName score=${"%.2f".format(gestureScore)}" }
-            }
-            TrackedHand(remapLandmarks(rawLandmarks), handedness, gestureName, gestureScore)
         }
-        return HandTrackingResult(
-            hands = hands,
-            frameSequence = timestampMs,
-        )
+    }
+
+    /** Pad to a black-letterboxed square; non-square input aborts in MediaPipe. */
+    private fun padToSquare(image: BufferedImage): BufferedImage {
+        if (image.width == image.height) return image
+        val size = maxOf(image.width, image.height)
+        val padded = BufferedImage(size, size, BufferedImage.TYPE_INT_ARGB)
+        val g = padded.createGraphics()
+        g.color = java.awt.Color.BLACK
+        g.fillRect(0, 0, size, size)
+        g.drawImage(image, (size - image.width) / 2, (size - image.height) / 2, null)
+        g.dispose()
+        return padded
+    }
+
+    /** Packed R, G, B bytes (kMpImageFormatSrgb) of [image]. */
+    private fun bufferedImageToRgb(image: BufferedImage): ByteArray {
+        val intPixels = (ensureArgb(image).raster.dataBuffer as DataBufferInt).data
+        val bytes = ByteArray(intPixels.size * 3)
+        for (i in intPixels.indices) {
+            val pixel = intPixels[i]
+            bytes[i * 3] = (pixel ushr 16).toByte()
+            bytes[i * 3 + 1] = (pixel ushr 8).toByte()
+            bytes[i * 3 + 2] = pixel.toByte()
+        }
+        return bytes
     }
 
     /**
-     * Remap landmarks from the padded-square coordinate space back to the
-     * original camera aspect ratio. MediaPipe normalizes landmarks 0–1 against
-     * the square; this converts them so 0–1 spans only the actual image region.
+     * Publish the mirrored camera preview and write the inference input for [frame]
+     * into [rgbOut]. FFmpeg's BGR24 frames take one native call straight from the
+     * grabber's buffer into a [CameraFramePool] surface; other formats go through
+     * Java2D.
+     *
+     * Mirroring makes the preview feel like a natural mirror and puts MediaPipe
+     * landmarks in mirrored coordinates. The inference frame is cropped around the
+     * last hands or letterboxed, and always square: non-square input aborts in
+     * landmark_projection_calculator with NORM_RECT.
+     *
+     * @return side length of the square frame written into [rgbOut], or 0 if the
+     *   frame couldn't be converted.
      */
-    private fun remapLandmarks(landmarks: List<HandLandmark>): List<HandLandmark> {
-        val w = captureWidth
-        val h = captureHeight
-        if (w <= 0 || h <= 0 || w == h) return landmarks
-
-        val squareSize = maxOf(w, h)
-        val padX = (squareSize - w) / 2f
-        val padY = (squareSize - h) / 2f
-
-        return landmarks.map { lm ->
-            HandLandmark(
-                x = (lm.x * squareSize - padX) / w,
-                y = (lm.y * squareSize - padY) / h,
-                z = lm.z,
+    private fun preprocessFrame(
+        frame: Frame,
+        converter: Java2DFrameConverter,
+        rgbOut: ByteBuffer,
+        timestampMs: Long,
+    ): Int {
+        val bgr = frame.image[0] as? ByteBuffer
+        if (bgr != null && bgr.isDirect && frame.imageDepth == Frame.DEPTH_UBYTE &&
+            frame.imageChannels == 3
+        ) {
+            val width = frame.imageWidth
+            val height = frame.imageHeight
+            val preview = framePool.next(width, height)
+            val squareSize = MediaPipeJni.preprocessBgrFrame(
+                nativePtr, bgr, width, height, frame.imageStride, true, preview, rgbOut, timestampMs,
             )
+            _cameraFrame.value = framePool.publish(width, height)
+            return squareSize
         }
+
+        val rawImage = converter.convert(frame) ?: return 0
+        val argbImage = ensureArgb(rawImage)
+        _cameraFrame.value = bufferedImageToCameraFrame(mirrorHorizontal(argbImage))
+        return preprocessRoi(argbImage, rgbOut, timestampMs)
     }
 
     /**
-     * Convert BufferedImage to RGB byte array (3 bytes per pixel) for MediaPipe.
+     * Mirror and convert an ARGB image to RGB bytes (3 bytes per pixel) for MediaPipe
+     * in a single native pass, cropped around the previous result's hands when the
+     * tracker has them and letterboxed to the full square otherwise.
      * MediaPipe expects kMpImageFormatSrgb = R, G, B byte order.
+     *
+     * @return side length of the square frame written into [rgbOut].
      */
-    private fun bufferedImageToRgb(image: BufferedImage): ByteArray {
-        val argbImage = ensureArgb(image)
+    private fun preprocessRoi(argbImage: BufferedImage, rgbOut: ByteBuffer, timestampMs: Long): Int {
         val intPixels = (argbImage.raster.dataBuffer as DataBufferInt).data
-        val bytes = ByteArray(argbImage.width * argbImage.height * 3)
-
-        for (i in intPixels.indices) {
-            val pixel = intPixels[i]
-            val offset = i * 3
-            bytes[offset] = (pixel ushr 16).toByte()     // R
-            bytes[offset + 1] = (pixel ushr 8).toByte()  // G
-            bytes[offset + 2] = pixel.toByte()            // B
-        }
+        return MediaPipeJni.preprocessArgbRoi(
+            nativePtr, intPixels, argbImage.width, argbImage.height, true, rgbOut, timestampMs,
+        )
+    }
 
-        return bytes
+    /**
+     * Reused direct buffer sized for the full letterboxed square of a [width] x
+     * [height] frame, so no per-frame array is allocated.
+     */
+    private fun reusableRgbBuffer(width: Int, height: Int): ByteBuffer {
+        val size = MediaPipeJni.squareSize(width, height)
+        val bytes = size * size * 3
+        val existing = rgbBuffer
+        if (existing != null && existing.capacity() >= bytes) return existing
+        return ByteBuffer.allocateDirect(bytes).also { rgbBuffer = it }
     }
 
     /**
@@ -368,22 +766,6 @@ class DesktopHandTracker(
         }
     }
 
-    /** Pad to square (letterbox) so MediaPipe landmark projection doesn't abort.
-     *  Preserves full field of view — no hand data lost. */
-    private fun padToSquare(image: BufferedImage): BufferedImage {
-        if (image.width == image.height) return image
-        val size = maxOf(image.width, image.height)
-        val padded = BufferedImage(size, size, BufferedImage.TYPE_INT_ARGB)
-        val g = padded.createGraphics()
-        // Black background (ARGB default is transparent black, fill opaque)
-        g.color = java.awt.Color.BLACK
-        g.fillRect(0, 0, size, size)
-        // Center the original image
-        g.drawImage(image, (size - image.width) / 2, (size - image.height) / 2, null)
-        g.dispose()
-        return padded
-    }
-
     /** Flip image horizontally so the camera acts like a mirror. */
     private fun mirrorHorizontal(image: BufferedImage): BufferedImage {
         val mirrored = BufferedImage(image.width, image.height, BufferedImage.TYPE_INT_ARGB)
@@ -0,0 +1,62 @@
+package org.balch.orpheus.core.mediapipe
+
+import java.util.logging.Logger
+
+private val logger = Logger.getLogger(MediaPipeJni::class.java.name)
+
+/** Extract the library for this os/arch from the jar's `/native` resources and load it. */
+internal actual fun loadMediaPipeLibrary(delegate: InferenceDelegate): MediaPipeLibrary {
+    val arch = System.getProperty("os.arch").let { arch ->
+        when {
+            arch.contains("aarch64") || arch.contains("arm64") -> "aarch64"
+            arch.contains("amd64") || arch.contains("x86_64") -> "x86_64"
+            else -> arch
+        }
+    }
+    val os = System.getProperty("os.name").lowercase().let { os ->
+        when {
+            os.contains("mac") -> "darwin"
+            os.contains("linux") -> "linux"
+            os.contains("win") -> "windows"
+            else -> os
+        }
+    }
+    val platform = "$os-$arch"
+    val extract = { lib: String ->
+        NativeCache.resourceFile("/native/$platform/$lib", lib) { extracted ->
+            // macOS on Apple Silicon requires code-signed binaries.
+            // Ad-hoc sign the extracted dylib once, before it is cached.
+            if (os == "darwin") {
+                ProcessBuilder("codesign", "-s", "-", extracted.absolutePath)
+                    .redirectErrorStream(true)
+                    .start()
+                    .waitFor()
+            }
+        }
+    }
+    val gpuLib = libName("mediapipe_jni_gpu")
+    val gpuFile = if (delegate == InferenceDelegate.GPU) extract(gpuLib) else null
+    if (delegate == InferenceDelegate.GPU && gpuFile == null) {
+        logger.info("No $gpuLib for $platform, GPU requests will run on CPU")
+    }
+    val lib = if (gpuFile != null) gpuLib else libName("mediapipe_jni")
+    // Only darwin-aarch64 ships a binary; other platforms need a local build.
+    val libFile = gpuFile ?: extract(lib)
+        ?: error(
+            "No MediaPipe bridge bundled for $platform (/native/$platform/$lib): " +
+                "build it with build-native-mediapipe.sh",
+        )
+
+    System.load(libFile.absolutePath)
+    return MediaPipeLibrary("$lib for $platform", gpu = gpuFile != null)
+}
+
+private fun libName(baseName: String): String {
+    val os = System.getProperty("os.name").lowercase()
+    return when {
+        os.contains("mac") -> "lib$baseName.dylib"
+        os.contains("linux") -> "lib$baseName.so"
+        os.contains("win") -> "$baseName.dll"
+        else -> "lib$baseName.dylib"
+    }
+}
@@ -1,46 +1,77 @@
 package org.balch.orpheus.core.mediapipe
 
-import java.nio.file.Files
+import java.io.File
+import java.nio.ByteBuffer
+import java.nio.channels.FileChannel
+import java.nio.file.StandardOpenOption
 
 /**
- * Extracts the bundled hand_landmarker.task model from classpath resources
- * to a temp file, so the MediaPipe C API can load it by path.
+ * Loads the bundled MediaPipe `.task` models for
+ * `base_options.model_asset_buffer`, so nothing is written to disk: resources on
+ * the file system (development runs) are memory-mapped, resources inside a JAR
+ * are read once into a direct buffer. Each model is loaded at most once per
+ * process and the buffers are read-only.
+ *
+ * The custom ASL classifier is handed to TFLite by path, so it comes from the
+ * persistent [NativeCache] instead; so do the `.task` models for a version-0 bridge
+ * ([MediaPipeJni.isLegacyBridge]), whose create calls only take paths.
  */
 internal object ModelExtractor {
 
-    private var extractedPath: String? = null
+    private const val HAND_LANDMARKER = "/models/hand_landmarker.task"
+    private const val GESTURE_RECOGNIZER = "/models/gesture_recognizer.task"
 
-    @Synchronized
-    fun getModelPath(): String {
-        extractedPath?.let { return it }
+    private val buffers = HashMap<String, ByteBuffer>()
 
-        val resourcePath = "/models/hand_landmarker.task"
-        val stream = ModelExtractor::class.java.getResourceAsStream(resourcePath)
-            ?: error("Model not found in resources: $resourcePath")
+    /** hand_landmarker.task bytes. */
+    fun getModelBuffer(): ByteBuffer = modelBuffer(HAND_LANDMARKER)
 
-        val tempFile = Files.createTempFile("hand_landmarker", ".task").toFile()
-        tempFile.deleteOnExit()
-        stream.use { input -> tempFile.outputStream().use { output -> input.copyTo(output) } }
+    /** gesture_recognizer.task bytes. */
+    fun getGestureModelBuffer(): ByteBuffer = modelBuffer(GESTURE_RECOGNIZER)
 
-        extractedPath = tempFile.absolutePath
-        return tempFile.absolutePath
-    }
+    /** hand_landmarker.task as a cached file, for [MediaPipeJni.createLegacyLandmarker]. */
+    fun getModelPath(): String = modelPath(HAND_LANDMARKER, "hand_landmarker.task")
 
-    private var gestureModelPath: String? = null
+    /** gesture_recognizer.task as a cached file, for [MediaPipeJni.createLegacyGestureRecognizer]. */
+    fun getGestureModelPath(): String = modelPath(GESTURE_RECOGNIZER, "gesture_recognizer.task")
+
+    private fun modelPath(resourcePath: String, fileName: String): String =
+        (NativeCache.resourceFile(resourcePath, fileName) ?: error("Model not found in resources: $resourcePath"))
+            .absolutePath
 
     @Synchronized
-    fun getGestureModelPath(): String {
-        gestureModelPath?.let { return it }
+    private fun modelBuffer(resourcePath: String): ByteBuffer {
+        buffers[resourcePath]?.let { return it.duplicate() }
 
-        val resourcePath = "/models/gesture_recognizer.task"
-        val stream = ModelExtractor::class.java.getResourceAsStream(resourcePath)
-            ?: error("Gesture recognizer model not found: $resourcePath")
+        val url = ModelExtractor::class.java.getResource(resourcePath)
+            ?: error("Model not found in resources: $resourcePath")
+        val buffer = if (url.protocol == "file") {
+            FileChannel.open(File(url.toURI()).toPath(), StandardOpenOption.READ).use { channel ->
+                channel.map(FileChannel.MapMode.READ_ONLY, 0, channel.size())
+            }
+        } else {
+            val bytes = url.openStream().use { it.readBytes() }
+            ByteBuffer.allocateDirect(bytes.size).apply { put(bytes); flip() }
+        }
+        val readOnly = buffer.asReadOnlyBuffer()
+        buffers[resourcePath] = readOnly
+        return readOnly.duplicate()
+    }
 
-        val tempFile = Files.createTempFile("gesture_recognizer", ".task").toFile()
-        tempFile.deleteOnExit()
-        stream.use { input -> tempFile.outputStream().use { output -> input.copyTo(output) } }
+    /**
+     * Custom ASL classifier trained by tools/train-asl-model, or null when the
+     * build doesn't bundle one.
+     */
+    fun getAslClassifierPath(): String? =
+        NativeCache.resourceFile("/models/asl_classifier.tflite", "asl_classifier.tflite")
+            ?.absolutePath
 
-        gestureModelPath = tempFile.absolutePath
-        return tempFile.absolutePath
+    /** Class labels of the custom ASL classifier, indexed by class ID. */
+    fun getAslClassifierLabels(): List<String> {
+        val stream = ModelExtractor::class.java.getResourceAsStream("/models/asl_classifier_labels.txt")
+            ?: return emptyList()
+        return stream.bufferedReader().use { reader ->
+            reader.readLines().map { it.trim() }.filter { it.isNotEmpty() }
+        }
     }
 }
@@ -0,0 +1,166 @@
+package org.balch.orpheus.core.mediapipe
+
+import java.io.File
+import java.io.IOException
+import java.io.InputStream
+import java.nio.file.Files
+import java.nio.file.StandardCopyOption
+import java.security.MessageDigest
+import java.util.logging.Logger
+
+/**
+ * Persistent, content-addressed copies of bundled resources (the native library, the
+ * ASL classifier) that have to exist as files.
+ *
+ * Each resource is stored once as `name-<hash>.ext` under the per-user cache directory
+ * and reused on every later launch, so a cold start no longer rewrites — or, on macOS,
+ * re-signs — 14 MB per camera toggle. A changed resource gets a new hash and a new file;
+ * stale versions of the same name are pruned.
+ *
+ * The hash comes from a `<resource>.sha256` sidecar (`<hex> <bytes>`, written by
+ * build-native-mediapipe.sh) when its size matches the resource, so a hit doesn't even
+ * read the resource; otherwise from hashing the resource stream.
+ *
+ * Each cached copy has its own `.sha256` sidecar in the same format, taken after
+ * `prepare` (codesigning changes the bytes). A hit is only used when the copy still
+ * matches it; a damaged or unverified copy is extracted again.
+ */
+internal object NativeCache {
+
+    private val logger = Logger.getLogger(NativeCache::class.java.name)
+
+    private const val HASH_CHARS = 16
+
+    /**
+     * Cache directory: `-Dorpheus.cache.dir`, else the platform's per-user cache
+     * location, else a temp directory when that isn't writable.
+     */
+    val directory: File by lazy {
+        val preferred = System.getProperty("orpheus.cache.dir")?.let(::File) ?: platformCacheDir()
+        if (preferred.isDirectory || preferred.mkdirs()) {
+            if (preferred.canWrite()) return@lazy preferred
+        }
+        logger.warning("Cache directory $preferred not writable, using a temp directory")
+        Files.createTempDirectory("orpheus-cache").toFile().also { it.deleteOnExit() }
+    }
+
+    private fun platformCacheDir(): File {
+        val home = System.getProperty("user.home")
+        val os = System.getProperty("os.name").lowercase()
+        return when {
+            os.contains("mac") -> File(home, "Library/Caches/Orpheus")
+            os.contains("win") ->
+                File(System.getenv("LOCALAPPDATA") ?: File(home, "AppData/Local").path, "Orpheus/Cache")
+            else -> File(System.getenv("XDG_CACHE_HOME") ?: File(home, ".cache").path, "orpheus")
+        }
+    }
+
+    /**
+     * File holding the bytes of classpath resource [resourcePath], cached as [fileName]
+     * plus content hash, or null if the resource doesn't exist.
+     *
+     * @param prepare runs on a fresh copy before it is published (e.g. codesign), so a
+     *   cached file is always ready to use.
+     */
+    @Synchronized
+    fun resourceFile(resourcePath: String, fileName: String, prepare: (File) -> Unit = {}): File? =
+        resourceFile(resourcePath, fileName, directory, prepare)
+
+    /** [resourceFile] against an explicit cache [directory] (tests). */
+    @Synchronized
+    internal fun resourceFile(
+        resourcePath: String,
+        fileName: String,
+        directory: File,
+        prepare: (File) -> Unit = {},
+    ): File? {
+        val hash = resourceHash(resourcePath) ?: return null
+        val dot = fileName.lastIndexOf('.').takeIf { it > 0 } ?: fileName.length
+        val stem = fileName.substring(0, dot)
+        val extension = fileName.substring(dot)
+        val target = File(directory, "$stem-$hash$extension")
+        if (isIntact(target)) return target
+
+        val stream = NativeCache::class.java.getResourceAsStream(resourcePath) ?: return null
+        val temp = File.createTempFile("$stem-", ".partial", directory)
+        val tempSidecar = File(directory, "${temp.name}.sha256")
+        try {
+            stream.use { input -> temp.outputStream().use { output -> input.copyTo(output) } }
+            prepare(temp)
+            tempSidecar.writeText("${fileHash(temp)} ${temp.length()}\n")
+            Files.move(
+                temp.toPath(), target.toPath(),
+                StandardCopyOption.ATOMIC_MOVE, StandardCopyOption.REPLACE_EXISTING,
+            )
+            // Published after the copy: a copy without a sidecar is never trusted.
+            Files.move(
+                tempSidecar.toPath(), sidecarOf(target).toPath(),
+                StandardCopyOption.ATOMIC_MOVE, StandardCopyOption.REPLACE_EXISTING,
+            )
+        } catch (e: IOException) {
+            // Another process may have published the same content first.
+            if (!isIntact(target)) throw e
+        } finally {
+            temp.delete()
+            tempSidecar.delete()
+        }
+        pruneStale(directory, stem, extension, target)
+        return target
+    }
+
+    private fun sidecarOf(file: File): File = File(file.path + ".sha256")
+
+    /** Whether cached [file] exists and still matches the digest recorded when it was cached. */
+    private fun isIntact(file: File): Boolean {
+        if (!file.isFile) return false
+        val recorded = sidecarOf(file).takeIf { it.isFile }?.readText()?.trim()?.split(Regex("\\s+"))
+        if (recorded == null || recorded.size != 2 || recorded[1].toLongOrNull() != file.length()) {
+            return false
+        }
+        return try {
+            fileHash(file) == recorded[0]
+        } catch (_: IOException) {
+            false
+        }
+    }
+
+    private fun fileHash(file: File): String = file.inputStream().use(::sha256)
+
+    private fun sha256(input: InputStream): String {
+        val digest = MessageDigest.getInstance("SHA-256")
+        val buffer = ByteArray(1 shl 16)
+        while (true) {
+            val read = input.read(buffer)
+            if (read < 0) break
+            digest.update(buffer, 0, read)
+        }
+        return digest.digest().joinToString("") { "%02x".format(it) }
+    }
+
+    private fun resourceHash(resourcePath: String): String? {
+        val resource = NativeCache::class.java.getResource(resourcePath) ?: return null
+        val size = resource.openConnection().contentLengthLong
+        val sidecar = NativeCache::class.java.getResourceAsStream("$resourcePath.sha256")
+            ?.bufferedReader()?.use { it.readLine() }?.trim()?.split(Regex("\\s+"))
+        if (sidecar != null && sidecar.size == 2 && sidecar[1].toLongOrNull() == size &&
+            sidecar[0].length >= HASH_CHARS
+        ) {
+            return sidecar[0].take(HASH_CHARS).lowercase()
+        }
+
+        return resource.openStream().use(::sha256).take(HASH_CHARS)
+    }
+
+    /**
+     * Delete other versions of [stem] and their sidecars; files still loaded elsewhere
+     * may refuse (Windows).
+     */
+    private fun pruneStale(directory: File, stem: String, extension: String, keep: File) {
+        val pattern = Regex(
+            "${Regex.escape(stem)}-[0-9a-f]{$HASH_CHARS}${Regex.escape(extension)}(\\.sha256)?",
+        )
+        val keepSidecar = sidecarOf(keep)
+        directory.listFiles { file -> file != keep && file != keepSidecar && pattern.matches(file.name) }
+            ?.forEach { it.delete() }
+    }
+}
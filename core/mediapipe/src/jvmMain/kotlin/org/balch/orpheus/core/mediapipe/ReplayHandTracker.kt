@@ -0,0 +1,105 @@
+package org.balch.orpheus.core.mediapipe
+
+import kotlinx.coroutines.CoroutineScope
+import kotlinx.coroutines.Dispatchers
+import kotlinx.coroutines.Job
+import kotlinx.coroutines.SupervisorJob
+import kotlinx.coroutines.delay
+import kotlinx.coroutines.flow.Flow
+import kotlinx.coroutines.flow.MutableSharedFlow
+import kotlinx.coroutines.flow.MutableStateFlow
+import kotlinx.coroutines.flow.StateFlow
+import kotlinx.coroutines.flow.asSharedFlow
+import kotlinx.coroutines.flow.asStateFlow
+import kotlinx.coroutines.isActive
+import kotlinx.coroutines.launch
+import kotlinx.coroutines.runBlocking
+import java.io.File
+
+/**
+ * [HandTracker] that replays a result log recorded by [DesktopHandTracker] (see
+ * [MediaPipeJni.setResultLog]) instead of running a camera, for profiling and
+ * load-testing the gesture engines deterministically and reproducing recorded
+ * sessions.
+ *
+ * Results are paced by the logged frame times divided by [speed]; with [speed]
+ * `<= 0` they are emitted back to back and [results] suspends until every
+ * collector has taken each one, so no frame is dropped. Real-time replays drop
+ * like the live tracker does.
+ *
+ * There is no camera preview. [start] replays from the beginning; with [loop] the
+ * log repeats until [stop], with frame sequences continuing across passes.
+ */
+class ReplayHandTracker(
+    private val log: File,
+    private val speed: Double = 1.0,
+    private val loop: Boolean = false,
+) : HandTracker {
+
+    private val scope = CoroutineScope(SupervisorJob() + Dispatchers.Default)
+
+    @Volatile
+    private var replayJob: Job? = null
+
+    private val _results = MutableSharedFlow<HandTrackingResult?>(
+        extraBufferCapacity = if (speed > 0.0) 1 else 0,
+    )
+    override val results: Flow<HandTrackingResult?> = _results.asSharedFlow()
+
+    private val _cameraFrame = MutableStateFlow<CameraFrame?>(null)
+    override val cameraFrame: StateFlow<CameraFrame?> = _cameraFrame.asStateFlow()
+
+    override val isAvailable: Boolean
+        get() = log.isFile
+
+    override fun start() {
+        if (replayJob?.isActive == true) return
+        replayJob = scope.launch {
+            val reader = try {
+                ResultLogReader(log)
+            } catch (e: Exception) {
+                System.err.println("[Orpheus] Cannot replay ${log.path}: ${e.message}")
+                return@launch
+            }
+            if (reader.size == 0) return@launch
+
+            val first = reader.timestampMs(0)
+            val span = reader.timestampMs(reader.size - 1) - first + 1
+            var pass = 0L
+            do {
+                val startNanos = System.nanoTime()
+                val firstFrameNanos = reader.frameNanos(0)
+                for (i in 0 until reader.size) {
+                    if (!isActive) return@launch
+                    if (speed > 0.0) {
+                        val due = dueNanos(reader.frameNanos(i), firstFrameNanos, speed)
+                        val wait = (due - (System.nanoTime() - startNanos)) / 1_000_000
+                        if (wait > 0) delay(wait)
+                    }
+                    val result = reader.result(i)?.let { r ->
+                        if (pass == 0L) r else r.copy(frameSequence = r.frameSequence + pass * span)
+                    }
+                    if (speed > 0.0) _results.tryEmit(result) else _results.emit(result)
+                }
+                pass++
+            } while (loop && isActive)
+            _results.emit(null)
+        }
+    }
+
+    override fun stop() {
+        val job = replayJob ?: return
+        replayJob = null
+        job.cancel()
+        runBlocking { job.join() }
+    }
+
+    internal companion object {
+        /**
+         * When a frame logged at [frameNanos] is due, in nanoseconds after the pass
+         * started at the frame logged at [firstFrameNanos], replaying at [speed] (> 0).
+         */
+        fun dueNanos(frameNanos: Long, firstFrameNanos: Long, speed: Double): Long =
+            ((frameNanos - firstFrameNanos) / speed).toLong()
+    }
+}
@@ -0,0 +1,108 @@
+package org.balch.orpheus.core.mediapipe
+
+import org.balch.orpheus.core.gestures.HandLandmark
+import org.balch.orpheus.core.gestures.Handedness
+import java.io.File
+import java.nio.ByteBuffer
+import java.nio.ByteOrder
+import java.nio.channels.FileChannel
+import java.nio.file.StandardOpenOption
+
+/**
+ * Read-only view of a result log written by the native bridge
+ * ([MediaPipeJni.setResultLog]), memory-mapped so records are decoded on demand.
+ *
+ * Layout (little-endian, see result_log.h): a [HEADER_SIZE]-byte header with the
+ * record count and the interned gesture names, then fixed [RECORD_SIZE]-byte records
+ * of `timestamp_ms, frameNanos, numHands, per-hand(handedness, gestureId,
+ * gestureScore, 21*xyz)` for [ResultRing.MAX_HANDS] hands. Coordinates and
+ * handedness are final, as in a [ResultRing] slot; features and ASL labels are not
+ * logged.
+ *
+ * A log still being written (or cut short by a crash) reads up to the records
+ * counted when it was opened.
+ */
+class ResultLogReader(file: File) {
+
+    companion object {
+        const val HEADER_SIZE = 4096
+        private const val HAND_SIZE = 12 + ResultRing.LANDMARK_COUNT * 3 * 4
+        const val RECORD_SIZE = 24 + ResultRing.MAX_HANDS * HAND_SIZE
+        private const val VERSION = 1
+        private const val NAMES_OFFSET = 64
+        private const val MAX_GESTURES = 32
+        private const val NAME_LEN = 48
+        private val MAGIC = "ORPHLOG1".toByteArray(Charsets.US_ASCII)
+    }
+
+    private val buffer: ByteBuffer =
+        FileChannel.open(file.toPath(), StandardOpenOption.READ).use { channel ->
+            channel.map(FileChannel.MapMode.READ_ONLY, 0, channel.size())
+        }.order(ByteOrder.LITTLE_ENDIAN)
+
+    /** Number of results in the log. */
+    val size: Int
+
+    /** Results the native side dropped because the log was full. */
+    val dropped: Int
+
+    private val gestureNames: Array<String>
+
+    init {
+        require(buffer.capacity() >= HEADER_SIZE) { "$file is too short for a result log" }
+        val magic = ByteArray(MAGIC.size).also { buffer.get(0, it) }
+        require(magic.contentEquals(MAGIC)) { "$file is not a result log" }
+        require(buffer.getInt(8) == VERSION) { "$file has unsupported result log version ${buffer.getInt(8)}" }
+        require(buffer.getInt(12) == HEADER_SIZE && buffer.getInt(16) == RECORD_SIZE) {
+            "$file has an unexpected result log layout"
+        }
+        val recorded = buffer.getInt(24)
+        size = minOf(recorded, (buffer.capacity() - HEADER_SIZE) / RECORD_SIZE)
+        dropped = buffer.getInt(28)
+        val gestureCount = buffer.getInt(32).coerceIn(0, MAX_GESTURES)
+        gestureNames = Array(gestureCount) { id ->
+            val bytes = ByteArray(NAME_LEN).also { buffer.get(NAMES_OFFSET + id * NAME_LEN, it) }
+            val end = bytes.indexOf(0).takeIf { it >= 0 } ?: NAME_LEN
+            String(bytes, 0, end, Charsets.UTF_8)
+        }
+    }
+
+    /** Timestamp the frame was submitted with (a frame counter on desktop). */
+    fun timestampMs(index: Int): Long = buffer.getLong(recordBase(index))
+
+    /** When the frame entered the native bridge, on [MediaPipeJni.nanoTime]'s clock. */
+    fun frameNanos(index: Int): Long = buffer.getLong(recordBase(index) + 8)
+
+    fun numHands(index: Int): Int = buffer.getInt(recordBase(index) + 16)
+
+    /** Name for a logged gesture ID, or null for -1 / unknown IDs. */
+    fun gestureName(id: Int): String? = gestureNames.getOrNull(id)
+
+    /**
+     * Result [index] as [HandTracker.results] emitted it: null for a frame without
+     * hands. [HandTrackingResult.frameSequence] is the logged timestamp.
+     */
+    fun result(index: Int): HandTrackingResult? {
+        val numHands = numHands(index).coerceIn(0, ResultRing.MAX_HANDS)
+        if (numHands == 0) return null
+        val hands = List(numHands) { h ->
+            val base = recordBase(index) + 24 + h * HAND_SIZE
+            val handedness = if (buffer.getFloat(base) >= 0.5f) Handedness.RIGHT else Handedness.LEFT
+            val landmarks = List(ResultRing.LANDMARK_COUNT) { i ->
+                val at = base + 12 + i * 12
+                HandLandmark(buffer.getFloat(at), buffer.getFloat(at + 4), buffer.getFloat(at + 8))
+            }
+            TrackedHand(
+                landmarks, handedness,
+                gestureName = gestureName(buffer.getInt(base + 4)),
+                gestureConfidence = buffer.getFloat(base + 8),
+            )
+        }
+        return HandTrackingResult(hands = hands, frameSequence = timestampMs(index))
+    }
+
+    private fun recordBase(index: Int): Int {
+        if (index !in 0 until size) throw IndexOutOfBoundsException("record $index of $size")
+        return HEADER_SIZE + index * RECORD_SIZE
+    }
+}
@@ -0,0 +1,125 @@
+package org.balch.orpheus.core.mediapipe
+
+import java.io.File
+import java.nio.file.Files
+import java.security.MessageDigest
+import kotlin.test.AfterTest
+import kotlin.test.Test
+import kotlin.test.assertContentEquals
+import kotlin.test.assertEquals
+import kotlin.test.assertFalse
+import kotlin.test.assertNotNull
+import kotlin.test.assertNull
+import kotlin.test.assertTrue
+
+class NativeCacheTest {
+
+    private val directory: File = Files.createTempDirectory("native-cache-test").toFile()
+    private var prepared = 0
+
+    @AfterTest
+    fun cleanUp() {
+        directory.deleteRecursively()
+    }
+
+    private fun resourceBytes(name: String): ByteArray =
+        checkNotNull(NativeCacheTest::class.java.getResourceAsStream("/cache-test/$name")).use { it.readBytes() }
+
+    private fun sha256(bytes: ByteArray): String =
+        MessageDigest.getInstance("SHA-256").digest(bytes).joinToString("") { "%02x".format(it) }
+
+    private fun cache(name: String, prepare: (File) -> Unit = {}): File? =
+        NativeCache.resourceFile("/cache-test/$name", name, directory) {
+            prepared++
+            prepare(it)
+        }
+
+    @Test
+    fun `a miss extracts the resource under its content hash`() {
+        val file = assertNotNull(cache("blob.bin"))
+
+        assertEquals("blob-${sha256(resourceBytes("blob.bin")).take(16)}.bin", file.name)
+        assertEquals(directory, file.parentFile)
+        assertContentEquals(resourceBytes("blob.bin"), file.readBytes())
+        assertEquals(1, prepared)
+    }
+
+    @Test
+    fun `a hit reuses the cached copy without extracting again`() {
+        val first = assertNotNull(cache("blob.bin"))
+        val second = assertNotNull(cache("blob.bin"))
+
+        assertEquals(first, second)
+        assertEquals(1, prepared)
+    }
+
+    @Test
+    fun `a hit is verified against the prepared copy`() {
+        // Like codesign: prepare changes the bytes, and the hit must still count.
+        val signature = "signature".toByteArray()
+        val first = assertNotNull(cache("blob.bin") { it.appendBytes(signature) })
+        val second = assertNotNull(cache("blob.bin"))
+
+        assertEquals(first, second)
+        assertEquals(1, prepared)
+        assertContentEquals(resourceBytes("blob.bin") + signature, second.readBytes())
+    }
+
+    @Test
+    fun `a corrupted cached copy is extracted again`() {
+        val file = assertNotNull(cache("blob.bin"))
+        file.writeBytes(ByteArray(file.length().toInt()) { 0x5a })
+
+        val again = assertNotNull(cache("blob.bin"))
+
+        assertEquals(file, again)
+        assertEquals(2, prepared)
+        assertContentEquals(resourceBytes("blob.bin"), again.readBytes())
+    }
+
+    @Test
+    fun `a cached copy without its digest is extracted again`() {
+        val file = assertNotNull(cache("blob.bin"))
+        assertTrue(File(file.path + ".sha256").delete())
+
+        assertNotNull(cache("blob.bin"))
+
+        assertEquals(2, prepared)
+        assertTrue(File(file.path + ".sha256").isFile)
+    }
+
+    @Test
+    fun `a resource sidecar of the right size names the copy`() {
+        val file = assertNotNull(cache("signed.bin"))
+        assertEquals("signed-0123456789abcdef.bin", file.name)
+    }
+
+    @Test
+    fun `a resource sidecar of the wrong size is ignored`() {
+        val file = assertNotNull(cache("badsize.bin"))
+        assertEquals("badsize-${sha256(resourceBytes("badsize.bin")).take(16)}.bin", file.name)
+    }
+
+    @Test
+    fun `older versions of the same resource are pruned`() {
+        val stale = File(directory, "blob-aaaaaaaaaaaaaaaa.bin").apply { writeText("old") }
+        val staleSidecar = File(directory, "blob-aaaaaaaaaaaaaaaa.bin.sha256").apply { writeText("x 3") }
+        val otherResource = File(directory, "other-aaaaaaaaaaaaaaaa.bin").apply { writeText("keep") }
+        val notAVersion = File(directory, "blob-notahash.bin").apply { writeText("keep") }
+
+        val file = assertNotNull(cache("blob.bin"))
+
+        assertFalse(stale.exists())
+        assertFalse(staleSidecar.exists())
+        assertTrue(otherResource.exists())
+        assertTrue(notAVersion.exists())
+        assertTrue(file.exists())
+        assertTrue(File(file.path + ".sha256").exists())
+    }
+
+    @Test
+    fun `a missing resource is null`() {
+        assertNull(cache("missing.bin"))
+        assertEquals(0, prepared)
+    }
+}
@@ -0,0 +1,73 @@
+package org.balch.orpheus.core.mediapipe
+
+import kotlinx.coroutines.CoroutineStart
+import kotlinx.coroutines.async
+import kotlinx.coroutines.flow.take
+import kotlinx.coroutines.flow.toList
+import kotlinx.coroutines.runBlocking
+import kotlinx.coroutines.withTimeout
+import kotlin.test.Test
+import kotlin.test.assertEquals
+import kotlin.test.assertNull
+import kotlin.test.assertTrue
+
+class ReplayHandTrackerTest {
+
+    private fun hand(seed: Int) = LoggedHand(1f, -1, 0f, ResultLogFixture.landmarks(seed))
+
+    private fun log(vararg frameMs: Long) = ResultLogFixture.write(
+        frameMs.mapIndexed { i, ms ->
+            LoggedResult(timestampMs = i.toLong(), frameNanos = ms * 1_000_000, hands = listOf(hand(i)))
+        },
+    )
+
+    @Test
+    fun `frames are due at their logged offset divided by speed`() {
+        assertEquals(0L, ReplayHandTracker.dueNanos(5_000, 5_000, 1.0))
+        assertEquals(100_000_000L, ReplayHandTracker.dueNanos(1_100_000_000, 1_000_000_000, 1.0))
+        assertEquals(50_000_000L, ReplayHandTracker.dueNanos(1_100_000_000, 1_000_000_000, 2.0))
+        assertEquals(400_000_000L, ReplayHandTracker.dueNanos(1_100_000_000, 1_000_000_000, 0.25))
+    }
+
+    @Test
+    fun `back to back replay delivers every result in order, then null`() = runBlocking {
+        val tracker = ReplayHandTracker(log(0, 1_000, 2_000), speed = 0.0)
+        val results = async(start = CoroutineStart.UNDISPATCHED) { tracker.results.take(4).toList() }
+        tracker.start()
+
+        val received = withTimeout(5_000) { results.await() }
+        tracker.stop()
+
+        assertEquals(listOf(0L, 1L, 2L), received.take(3).map { it?.frameSequence })
+        assertEquals(listOf(0f, 1f, 2f), received.take(3).map { it?.hands?.single()?.landmarks?.get(0)?.x })
+        assertNull(received[3])
+    }
+
+    @Test
+    fun `looped replay continues frame sequences across passes`() = runBlocking {
+        val tracker = ReplayHandTracker(log(0, 10), speed = 0.0, loop = true)
+        val results = async(start = CoroutineStart.UNDISPATCHED) { tracker.results.take(5).toList() }
+        tracker.start()
+
+        val received = withTimeout(5_000) { results.await() }
+        tracker.stop()
+
+        assertEquals(listOf(0L, 1L, 2L, 3L, 4L), received.map { it?.frameSequence })
+    }
+
+    @Test
+    fun `real-time replay is paced by the logged frame times`() = runBlocking {
+        // 60 ms of log at half speed: the last result can't arrive before ~120 ms.
+        val tracker = ReplayHandTracker(log(0, 30, 60), speed = 0.5)
+        val results = async(start = CoroutineStart.UNDISPATCHED) { tracker.results.take(3).toList() }
+        val started = System.nanoTime()
+        tracker.start()
+
+        val received = withTimeout(5_000) { results.await() }
+        val elapsedMs = (System.nanoTime() - started) / 1_000_000
+        tracker.stop()
+
+        assertEquals(listOf(0L, 1L, 2L), received.map { it?.frameSequence })
+        assertTrue(elapsedMs >= 110, "replayed 60 ms of log at speed 0.5 in $elapsedMs ms")
+    }
+}
@@ -0,0 +1,85 @@
+package org.balch.orpheus.core.mediapipe
+
+import java.io.File
+import java.nio.ByteBuffer
+import java.nio.ByteOrder
+
+/** One hand of a [ResultLogFixture] record. */
+internal data class LoggedHand(
+    val handedness: Float,
+    val gestureId: Int,
+    val gestureScore: Float,
+    /** 21 * xyz. */
+    val xyz: FloatArray,
+)
+
+/** One record of a [ResultLogFixture]. */
+internal data class LoggedResult(
+    val timestampMs: Long,
+    val frameNanos: Long,
+    val hands: List<LoggedHand> = emptyList(),
+)
+
+/**
+ * Writes result logs byte for byte as result_log.cc does (little-endian header of
+ * [ResultLogReader.HEADER_SIZE] bytes, then fixed records), so the reader is tested
+ * against the native layout rather than against itself.
+ */
+internal object ResultLogFixture {
+
+    private const val VERSION = 1
+    private const val NAMES_OFFSET = 64
+    private const val NAME_LEN = 48
+    private const val HAND_SIZE = 12 + ResultRing.LANDMARK_COUNT * 3 * 4
+
+    /** Landmarks where every coordinate of hand [seed] is distinct and recognizable. */
+    fun landmarks(seed: Int): FloatArray =
+        FloatArray(ResultRing.LANDMARK_COUNT * 3) { seed + it / 1000f }
+
+    /**
+     * Write [results] to a temp file. The header counts [recordCount] records (all of
+     * them by default), and the file is then cut to [truncateTo] bytes when given,
+     * the way a crash mid-record leaves it.
+     */
+    fun write(
+        results: List<LoggedResult>,
+        gestureNames: List<String> = emptyList(),
+        recordCount: Int = results.size,
+        dropped: Int = 0,
+        truncateTo: Int? = null,
+    ): File {
+        val size = ResultLogReader.HEADER_SIZE + results.size * ResultLogReader.RECORD_SIZE
+        val buffer = ByteBuffer.allocate(size).order(ByteOrder.LITTLE_ENDIAN)
+        buffer.put(0, "ORPHLOG1".toByteArray(Charsets.US_ASCII))
+        buffer.putInt(8, VERSION)
+        buffer.putInt(12, ResultLogReader.HEADER_SIZE)
+        buffer.putInt(16, ResultLogReader.RECORD_SIZE)
+        buffer.putInt(20, results.size)          // capacity
+        buffer.putInt(24, recordCount)
+        buffer.putInt(28, dropped)
+        buffer.putInt(32, gestureNames.size)
+        gestureNames.forEachIndexed { id, name ->
+            buffer.put(NAMES_OFFSET + id * NAME_LEN, name.toByteArray(Charsets.UTF_8))
+        }
+
+        results.forEachIndexed { index, result ->
+            val record = ResultLogReader.HEADER_SIZE + index * ResultLogReader.RECORD_SIZE
+            buffer.putLong(record, result.timestampMs)
+            buffer.putLong(record + 8, result.frameNanos)
+            buffer.putInt(record + 16, result.hands.size)
+            result.hands.forEachIndexed { h, hand ->
+                val base = record + 24 + h * HAND_SIZE
+                buffer.putFloat(base, hand.handedness)
+                buffer.putInt(base + 4, hand.gestureId)
+                buffer.putFloat(base + 8, hand.gestureScore)
+                hand.xyz.forEachIndexed { i, v -> buffer.putFloat(base + 12 + i * 4, v) }
+            }
+        }
+
+        val bytes = buffer.array()
+        return File.createTempFile("result-log", ".bin").apply {
+            deleteOnExit()
+            writeBytes(if (truncateTo != null) bytes.copyOf(truncateTo) else bytes)
+        }
+    }
+}
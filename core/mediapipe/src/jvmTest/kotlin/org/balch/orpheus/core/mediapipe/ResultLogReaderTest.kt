@@ -0,0 +1,99 @@
+package org.balch.orpheus.core.mediapipe
+
+import org.balch.orpheus.core.gestures.Handedness
+import kotlin.test.Test
+import kotlin.test.assertEquals
+import kotlin.test.assertFailsWith
+import kotlin.test.assertNotNull
+import kotlin.test.assertNull
+
+class ResultLogReaderTest {
+
+    private val twoHands = LoggedResult(
+        timestampMs = 7,
+        frameNanos = 1_000_000_000,
+        hands = listOf(
+            LoggedHand(1f, 1, 0.9f, ResultLogFixture.landmarks(1)),
+            LoggedHand(0f, -1, 0f, ResultLogFixture.landmarks(2)),
+        ),
+    )
+    private val noHands = LoggedResult(timestampMs = 8, frameNanos = 1_033_000_000)
+    private val oneHand = LoggedResult(
+        timestampMs = 9,
+        frameNanos = 1_066_000_000,
+        hands = listOf(LoggedHand(0f, 0, 0.75f, ResultLogFixture.landmarks(3))),
+    )
+
+    @Test
+    fun `record layout matches result_log h`() {
+        // RESULT_LOG_HEADER_SIZE and RESULT_LOG_RECORD_SIZE (24 + 2 * (12 + 63 * 4)).
+        assertEquals(4096, ResultLogReader.HEADER_SIZE)
+        assertEquals(552, ResultLogReader.RECORD_SIZE)
+    }
+
+    @Test
+    fun `decodes timestamps, hands and gesture names`() {
+        val reader = ResultLogReader(
+            ResultLogFixture.write(listOf(twoHands, noHands, oneHand), listOf("Open_Palm", "Victory")),
+        )
+
+        assertEquals(3, reader.size)
+        assertEquals(listOf(7L, 8L, 9L), List(3) { reader.timestampMs(it) })
+        assertEquals(listOf(1_000_000_000L, 1_033_000_000L, 1_066_000_000L), List(3) { reader.frameNanos(it) })
+
+        val first = assertNotNull(reader.result(0))
+        assertEquals(7L, first.frameSequence)
+        assertEquals(2, first.hands.size)
+        val right = first.hands[0]
+        assertEquals(Handedness.RIGHT, right.handedness)
+        assertEquals("Victory", right.gestureName)
+        assertEquals(0.9f, right.gestureConfidence)
+        assertEquals(ResultRing.LANDMARK_COUNT, right.landmarks.size)
+        val xyz = ResultLogFixture.landmarks(1)
+        assertEquals(xyz[3], right.landmarks[1].x)
+        assertEquals(xyz[4], right.landmarks[1].y)
+        assertEquals(xyz[62], right.landmarks[20].z)
+        val left = first.hands[1]
+        assertEquals(Handedness.LEFT, left.handedness)
+        assertNull(left.gestureName)
+        assertEquals(2f, left.landmarks[0].x)
+
+        assertNull(reader.result(1))
+
+        val last = assertNotNull(reader.result(2))
+        assertEquals("Open_Palm", last.hands.single().gestureName)
+        assertEquals(0.75f, last.hands.single().gestureConfidence)
+    }
+
+    @Test
+    fun `truncated trailing record is not read`() {
+        val complete = ResultLogReader.HEADER_SIZE + 2 * ResultLogReader.RECORD_SIZE
+        val reader = ResultLogReader(
+            ResultLogFixture.write(
+                listOf(twoHands, noHands, oneHand),
+                truncateTo = complete + ResultLogReader.RECORD_SIZE / 2,
+            ),
+        )
+
+        assertEquals(2, reader.size)
+        assertEquals(8L, reader.timestampMs(1))
+        assertFailsWith<IndexOutOfBoundsException> { reader.result(2) }
+    }
+
+    @Test
+    fun `reads only the records counted in the header`() {
+        val reader = ResultLogReader(
+            ResultLogFixture.write(listOf(twoHands, noHands, oneHand), recordCount = 1, dropped = 4),
+        )
+
+        assertEquals(1, reader.size)
+        assertEquals(4, reader.dropped)
+    }
+
+    @Test
+    fun `rejects files that are not result logs`() {
+        val file = ResultLogFixture.write(listOf(twoHands))
+        file.writeBytes(file.readBytes().also { it[0] = 'X'.code.toByte() })
+        assertFailsWith<IllegalArgumentException> { ResultLogReader(file) }
+    }
+}
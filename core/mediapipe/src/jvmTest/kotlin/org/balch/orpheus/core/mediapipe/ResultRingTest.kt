@@ -0,0 +1,89 @@
+package org.balch.orpheus.core.mediapipe
+
+import org.balch.orpheus.core.gestures.HandFeatures
+import org.balch.orpheus.core.gestures.Handedness
+import kotlin.test.Test
+import kotlin.test.assertContentEquals
+import kotlin.test.assertEquals
+import kotlin.test.assertNotNull
+import kotlin.test.assertNull
+
+/**
+ * Pins the ring slot layout — also the [HandTracker.readLatest] snapshot layout — to
+ * pack_slot in mediapipe_jni.cc: `[numHands, per-hand(handedness, gestureId,
+ * gestureScore, 21*xyz, features, aslClassId, aslScore)]`.
+ */
+class ResultRingTest {
+
+    private val ring = ResultRing()
+    private val floats = ring.byteBuffer.asFloatBuffer()
+
+    /** Write hand [h] of [slot] the way pack_slot does; values derive from [seed]. */
+    private fun packHand(slot: Int, h: Int, seed: Float, handedness: Float, gestureId: Int, aslClassId: Int) {
+        val hand = slot * ResultRing.SLOT_FLOATS + 1 + h * ResultRing.HAND_FLOATS
+        floats.put(hand, handedness)
+        floats.put(hand + 1, gestureId.toFloat())
+        floats.put(hand + 2, seed + 0.5f)
+        for (i in 0 until 63) floats.put(hand + 3 + i, seed + i)
+        for (i in 0 until HandFeatures.SIZE) floats.put(hand + 3 + 63 + i, seed + 100 + i)
+        floats.put(hand + 3 + 63 + HandFeatures.SIZE, aslClassId.toFloat())
+        floats.put(hand + 4 + 63 + HandFeatures.SIZE, seed + 0.25f)
+    }
+
+    @Test
+    fun `sizes match the native defines`() {
+        assertEquals(2, ResultRing.MAX_HANDS)                 // RING_MAX_HANDS
+        assertEquals(86, ResultRing.HAND_FLOATS)              // RING_HAND_FLOATS
+        assertEquals(173, ResultRing.SLOT_FLOATS)             // RING_SLOT_FLOATS
+        assertEquals(18, HandFeatures.SIZE)                   // HAND_FEATURE_COUNT
+        assertEquals(ResultRing.HAND_FLOATS, HandTracker.LATEST_HAND_FLOATS)
+        assertEquals(ResultRing.SLOT_FLOATS, HandTracker.LATEST_FLOATS)
+        assertEquals(1 + 2 * 64, HandTracker.SAMPLE_FLOATS)   // nativeSampleLandmarks
+        assertEquals(HandTracker.SAMPLE_FLOATS, MediaPipeJni.SAMPLE_FLOATS)
+        assertEquals(ring.slotCount * ResultRing.SLOT_FLOATS * 4, ring.byteBuffer.capacity())
+    }
+
+    @Test
+    fun `accessors read pack_slot offsets`() {
+        floats.put(ResultRing.SLOT_FLOATS, 2f)
+        packHand(slot = 1, h = 0, seed = 10f, handedness = 1f, gestureId = 3, aslClassId = -1)
+        packHand(slot = 1, h = 1, seed = 20f, handedness = 0f, gestureId = -1, aslClassId = 4)
+
+        assertEquals(0, ring.numHands(0))
+        assertEquals(2, ring.numHands(1))
+        assertEquals(1f, ring.handedness(1, 0))
+        assertEquals(3, ring.gestureId(1, 0))
+        assertEquals(10.5f, ring.gestureScore(1, 0))
+        assertEquals(10f, ring.landmarkX(1, 0, 0))
+        assertEquals(11f, ring.landmarkY(1, 0, 0))
+        assertEquals(72f, ring.landmarkZ(1, 0, 20))
+        assertEquals(120f, ring.feature(1, 0, 10))
+        assertEquals(-1, ring.aslClassId(1, 0))
+        assertEquals(-1, ring.gestureId(1, 1))
+        assertEquals(20f, ring.landmarkX(1, 1, 0))
+        assertEquals(4, ring.aslClassId(1, 1))
+        assertEquals(20.25f, ring.aslScore(1, 1))
+    }
+
+    @Test
+    fun `result decodes a slot`() {
+        floats.put(0, 1f)
+        packHand(slot = 0, h = 0, seed = 10f, handedness = 0f, gestureId = 0, aslClassId = 1)
+        ring.setGestureName(0, "Open_Palm")
+
+        val result = assertNotNull(ring.result(0, frameSequence = 42, aslLabels = listOf("A", "B")))
+        assertEquals(42L, result.frameSequence)
+        val hand = result.hands.single()
+        assertEquals(Handedness.LEFT, hand.handedness)
+        assertEquals("Open_Palm", hand.gestureName)
+        assertEquals(10.5f, hand.gestureConfidence)
+        assertEquals(ResultRing.LANDMARK_COUNT, hand.landmarks.size)
+        assertEquals(13f, hand.landmarks[1].x)
+        assertContentEquals(FloatArray(HandFeatures.SIZE) { 110f + it }, assertNotNull(hand.features).values)
+        assertEquals("B", hand.aslLabel)
+        assertEquals(10.25f, hand.aslConfidence)
+
+        floats.put(0, 0f)
+        assertNull(ring.result(0, frameSequence = 43))
+    }
+}
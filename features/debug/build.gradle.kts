@@ -19,6 +19,7 @@ kotlin {
     sourceSets {
         commonMain.dependencies {
             implementation(project(":features:visualizations")) // For LiquidPreview
+            implementation(project(":core:mediapipe")) // For HandTrackerStats
         }
     }
 }
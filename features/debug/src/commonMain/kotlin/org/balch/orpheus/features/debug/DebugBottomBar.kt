@@ -39,6 +39,8 @@ import androidx.compose.ui.tooling.preview.Preview
 import androidx.compose.ui.tooling.preview.PreviewParameter
 import androidx.compose.ui.unit.dp
 import androidx.compose.ui.unit.sp
+import org.balch.orpheus.core.mediapipe.HandTrackerStats
+import org.balch.orpheus.core.mediapipe.StageLatency
 import org.balch.orpheus.features.visualizations.preview.LiquidEffectsProvider
 import org.balch.orpheus.ui.infrastructure.LocalLiquidEffects
 import org.balch.orpheus.ui.infrastructure.LocalLiquidState
@@ -159,6 +161,24 @@ fun DebugBottomBar(
                     )
                 }
 
+                // HAND Display (inference p95, only while a tracker has run)
+                val inference = state.handTracking?.inference
+                if (inference != null && inference.count > 0) {
+                    Spacer(modifier = Modifier.width(12.dp))
+                    Row(verticalAlignment = Alignment.CenterVertically) {
+                        Text("HAND:", fontSize = 10.sp, color = Color.Gray)
+                        Spacer(modifier = Modifier.width(4.dp))
+                        Text(
+                            text = "${formatMillis(inference.p95Nanos)}ms",
+                            fontSize = 10.sp,
+                            fontFamily = FontFamily.Monospace,
+                            color =
+                                if (inference.p95Nanos > HAND_P95_WARN_NANOS) OrpheusColors.neonMagenta
+                                else OrpheusColors.synthGreen
+                        )
+                    }
+                }
+
                 // Expand Button
                 Box(modifier = Modifier.clickable { isExpanded = !isExpanded }.padding(4.dp)) {
                     Text(text = if (isExpanded) "▼" else "▲", color = Color.Gray, fontSize = 12.sp)
@@ -166,8 +186,9 @@ fun DebugBottomBar(
             }
         }
 
-        // Expanded Content (Logs List)
+        // Expanded Content (Hand tracking stats + Logs List)
         if (isExpanded) {
+            state.handTracking?.let { HandTrackingStatsPanel(it) }
             DebugLogsPanel(
                 logs = state.logs,
                 onClearLogs = debugFeature.actions.onClearLogs
@@ -176,6 +197,48 @@ fun DebugBottomBar(
     }
 }
 
+/** One frame at 30 fps — beyond this the tracker can't keep up with the camera. */
+private const val HAND_P95_WARN_NANOS = 33_000_000L
+
+private fun formatMillis(nanos: Long): String {
+    val tenths = nanos / 100_000
+    return "${tenths / 10}.${tenths % 10}"
+}
+
+@Composable
+private fun HandTrackingStatsPanel(stats: HandTrackerStats) {
+    Column(
+        modifier =
+            Modifier.fillMaxWidth()
+                .background(OrpheusColors.darkVoid)
+                .padding(horizontal = 8.dp, vertical = 4.dp)
+    ) {
+        Text(
+            text = "Hand tracking  frames ${stats.framesSubmitted}  " +
+                "results ${stats.resultsDelivered}  dropped ${stats.framesDropped}  " +
+                "classified ${(stats.recognitionRate * 100).toInt()}%",
+            fontSize = 10.sp,
+            color = Color.Gray
+        )
+        StageLatencyRow("image", stats.imageCreate)
+        StageLatencyRow("infer", stats.inference)
+        StageLatencyRow("pack", stats.resultPacking)
+        StageLatencyRow("jni", stats.jniCallback)
+    }
+}
+
+@Composable
+private fun StageLatencyRow(label: String, latency: StageLatency) {
+    Text(
+        text = "${label.padEnd(6)} p50 ${formatMillis(latency.p50Nanos)}  " +
+            "p95 ${formatMillis(latency.p95Nanos)}  p99 ${formatMillis(latency.p99Nanos)}  " +
+            "max ${formatMillis(latency.maxNanos)} ms",
+        color = OrpheusColors.electricBlue,
+        fontFamily = FontFamily.Monospace,
+        fontSize = 11.sp,
+    )
+}
+
 @Composable
 private fun DebugLogsPanel(
     logs: List<LogEntry>,
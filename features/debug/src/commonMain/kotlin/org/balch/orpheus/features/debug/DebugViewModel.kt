@@ -6,14 +6,18 @@ import dev.zacsweers.metro.ClassKey
 import dev.zacsweers.metro.ContributesIntoMap
 import dev.zacsweers.metro.Inject
 import dev.zacsweers.metro.binding
+import kotlinx.coroutines.delay
 import kotlinx.coroutines.flow.MutableStateFlow
 import kotlinx.coroutines.flow.StateFlow
 import kotlinx.coroutines.flow.combine
+import kotlinx.coroutines.flow.flow
 import kotlinx.coroutines.flow.stateIn
 import org.balch.orpheus.core.features.SynthFeature
 import org.balch.orpheus.core.audio.SynthEngine
 import org.balch.orpheus.core.features.FeatureCoroutineScope
 import org.balch.orpheus.core.features.synthFeature
+import org.balch.orpheus.core.mediapipe.HandTracker
+import org.balch.orpheus.core.mediapipe.HandTrackerStats
 import org.balch.orpheus.util.ConsoleLogger
 import org.balch.orpheus.util.LogEntry
 
@@ -21,7 +25,8 @@ import org.balch.orpheus.util.LogEntry
 data class DebugUiState(
     val peak: Float,
     val cpuLoad: Float,
-    val logs: List<LogEntry> = emptyList()
+    val logs: List<LogEntry> = emptyList(),
+    val handTracking: HandTrackerStats? = null,
 )
 
 /** Actions for the Debug bottom bar. */
@@ -43,7 +48,8 @@ interface DebugFeature : SynthFeature<DebugUiState, DebugPanelActions> {
 /**
  * ViewModel for the Debug bottom bar.
  *
- * Combines engine monitoring flows with console logs into a unified UI state.
+ * Combines engine monitoring flows, hand-tracker latency stats and console logs
+ * into a unified UI state.
  */
 @Inject
 @ClassKey(DebugViewModel::class)
@@ -51,6 +57,7 @@ interface DebugFeature : SynthFeature<DebugUiState, DebugPanelActions> {
 class DebugViewModel(
     private val engine: SynthEngine,
     private val consoleLogger: ConsoleLogger,
+    handTracker: HandTracker,
     scope: FeatureCoroutineScope,
 ) : DebugFeature {
 
@@ -58,15 +65,24 @@ class DebugViewModel(
         onClearLogs = ::onClearLogs
     )
 
+    private val handTrackingFlow = flow {
+        while (true) {
+            emit(handTracker.stats())
+            delay(HAND_STATS_POLL_INTERVAL_MS)
+        }
+    }
+
     override val stateFlow: StateFlow<DebugUiState> = combine(
         engine.peakFlow,
         engine.cpuLoadFlow,
-        consoleLogger.logsFlow
-    ) { peak, cpuLoad, logs ->
+        consoleLogger.logsFlow,
+        handTrackingFlow,
+    ) { peak, cpuLoad, logs, handTracking ->
         DebugUiState(
             peak = peak,
             cpuLoad = cpuLoad,
-            logs = logs
+            logs = logs,
+            handTracking = handTracking,
         )
     }.stateIn(
         scope = scope,
@@ -80,6 +96,7 @@ class DebugViewModel(
 
     companion object {
         const val POLL_INTERVAL_MS = 200L
+        private const val HAND_STATS_POLL_INTERVAL_MS = 1000L
 
         fun previewFeature(state: DebugUiState = DebugUiState(peak = 0.5f, cpuLoad = 12.5f)): DebugFeature =
             object : DebugFeature {
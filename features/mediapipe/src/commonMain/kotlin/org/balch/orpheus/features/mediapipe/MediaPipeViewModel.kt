@@ -231,9 +231,14 @@ class MediaPipeViewModel(
 
                 // Interpret each hand independently and cache for stateFlow reuse
                 val gestures = result.hands.map { hand ->
+                    // The custom ASL classifier, when the tracker runs one, is the
+                    // better-informed ML opinion unless the built-in model is surer.
+                    val useAsl = hand.aslLabel != null && hand.aslConfidence >= hand.gestureConfidence
                     gestureInterpreter.interpret(
                         hand.landmarks, hand.handedness,
-                        hand.gestureName, hand.gestureConfidence,
+                        if (useAsl) hand.aslLabel else hand.gestureName,
+                        if (useAsl) hand.aslConfidence else hand.gestureConfidence,
+                        hand.features,
                     )
                 }
                 _cachedGestures.value = gestures
@@ -5,11 +5,17 @@ import androidx.compose.ui.graphics.toComposeImageBitmap
 import org.balch.orpheus.core.mediapipe.CameraFrame
 import org.jetbrains.skia.ColorAlphaType
 import org.jetbrains.skia.ColorType
+import org.jetbrains.skia.Data
 import org.jetbrains.skia.ImageInfo
 import org.jetbrains.skia.Image
 
 actual fun CameraFrame.toImageBitmap(): ImageBitmap {
     val imageInfo = ImageInfo(width, height, ColorType.BGRA_8888, ColorAlphaType.PREMUL)
-    val image = Image.makeRaster(imageInfo, pixels, width * 4)
+    val image = if (pixelAddress != 0L) {
+        // Pooled native surface: wrap it in place; the frame keeps it alive.
+        Image.makeRaster(imageInfo, Data.makeWithoutCopy(pixelAddress, width * height * 4), width * 4)
+    } else {
+        Image.makeRaster(imageInfo, pixels, width * 4)
+    }
     return image.toComposeImageBitmap()
 }
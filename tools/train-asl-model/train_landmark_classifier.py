@@ -0,0 +1,140 @@
+#!/usr/bin/env python3
+"""
+Train the custom ASL classifier that the native bridge runs on landmarks.
+
+Unlike train.py (a Model Maker gesture_recognizer.task bundle), this produces
+a plain TFLite model over one canonical landmark vector per hand, loaded by
+libmediapipe_jni via MediaPipeJni.loadAslClassifier and run inside the result
+packer — no JVM-side inference.
+
+Usage:
+    python train_landmark_classifier.py --data_dir ./data --output_dir ./output
+
+Uses the same data directory layout as train.py. Outputs:
+    asl_classifier.tflite       float32 [1, 68] -> float32 [1, num_classes]
+    asl_classifier_labels.txt   one label per line, in class ID order
+"""
+import argparse
+import math
+import os
+import shutil
+
+import numpy as np
+import tensorflow as tf
+import mediapipe as mp
+from mediapipe.tasks.python import vision
+from mediapipe.tasks.python.core.base_options import BaseOptions
+
+INPUT_SIZE = 68
+FINGER_BASE = [1, 5, 9, 13, 17]
+
+REPO_ROOT = os.path.join(os.path.dirname(__file__), "..", "..")
+MODELS_DIR = os.path.join(REPO_ROOT, "core", "mediapipe", "src", "jvmMain", "resources", "models")
+
+
+def bone_angle(v, a0, a1, b0, b1):
+    a = v[a1] - v[a0]
+    b = v[b1] - v[b0]
+    denom = math.sqrt(float(np.dot(a, a) * np.dot(b, b)))
+    if denom <= 1e-12:
+        return 0.0
+    return math.acos(max(-1.0, min(1.0, float(np.dot(a, b)) / denom)))
+
+
+def canonical_input(xyz, right, kx=1.0, ky=1.0):
+    """Mirror of asl_classifier_input() in build-scripts/mediapipe-patches/asl_classifier.cc."""
+    sx = kx if right else -kx
+    v = np.zeros((21, 3), dtype=np.float32)
+    v[:, 0] = (xyz[:, 0] - xyz[0, 0]) * sx
+    v[:, 1] = (xyz[:, 1] - xyz[0, 1]) * ky
+    v[:, 2] = xyz[:, 2] - xyz[0, 2]
+    extent = float(np.max(np.sqrt(v[:, 0] ** 2 + v[:, 1] ** 2)))
+    v *= 1.0 / extent if extent > 1e-6 else 1.0
+    curls = [bone_angle(v, b, b + 1, b + 2, b + 3) for b in FINGER_BASE]
+    return np.concatenate([v.reshape(-1), np.asarray(curls, dtype=np.float32)])
+
+
+def extract_samples(data_dir, landmarker_path):
+    labels = sorted(d for d in os.listdir(data_dir) if os.path.isdir(os.path.join(data_dir, d)))
+    options = vision.HandLandmarkerOptions(
+        base_options=BaseOptions(model_asset_path=landmarker_path),
+        running_mode=vision.RunningMode.IMAGE,
+        num_hands=1,
+    )
+    inputs, targets = [], []
+    with vision.HandLandmarker.create_from_options(options) as landmarker:
+        for class_id, label in enumerate(labels):
+            class_dir = os.path.join(data_dir, label)
+            found = 0
+            for name in sorted(os.listdir(class_dir)):
+                image = mp.Image.create_from_file(os.path.join(class_dir, name))
+                result = landmarker.detect(image)
+                if not result.hand_landmarks:
+                    continue
+                lms = result.hand_landmarks[0]
+                xyz = np.array([[p.x, p.y, p.z] for p in lms], dtype=np.float32)
+                # Training images are not mirrored, so MediaPipe's label is the user's hand.
+                right = result.handedness[0][0].category_name == "Right"
+                size = max(image.width, image.height)
+                inputs.append(canonical_input(xyz, right, image.width / size, image.height / size))
+                targets.append(class_id)
+                found += 1
+            print(f"  {label}: {found} hands")
+    return labels, np.stack(inputs), np.asarray(targets, dtype=np.int32)
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Train the native ASL landmark classifier")
+    parser.add_argument("--data_dir", required=True, help="Path to training data directory")
+    parser.add_argument("--output_dir", default="./output", help="Output directory")
+    parser.add_argument("--landmarker", default=os.path.join(MODELS_DIR, "hand_landmarker.task"),
+                        help="hand_landmarker.task used to extract landmarks")
+    parser.add_argument("--epochs", type=int, default=60, help="Training epochs")
+    parser.add_argument("--batch_size", type=int, default=32, help="Batch size")
+    parser.add_argument("--lr", type=float, default=0.002, help="Learning rate")
+    args = parser.parse_args()
+
+    os.makedirs(args.output_dir, exist_ok=True)
+
+    labels, x, y = extract_samples(args.data_dir, args.landmarker)
+    rng = np.random.default_rng(42)
+    order = rng.permutation(len(x))
+    x, y = x[order], y[order]
+    split = int(len(x) * 0.9)
+    print(f"Train: {split}, Test: {len(x) - split}")
+
+    model = tf.keras.Sequential([
+        tf.keras.layers.Input(shape=(INPUT_SIZE,), batch_size=1, name="landmarks"),
+        tf.keras.layers.Dense(64, activation="relu"),
+        tf.keras.layers.Dropout(0.2),
+        tf.keras.layers.Dense(32, activation="relu"),
+        tf.keras.layers.Dense(len(labels), activation="softmax"),
+    ])
+    model.compile(
+        optimizer=tf.keras.optimizers.Adam(args.lr),
+        loss="sparse_categorical_crossentropy",
+        metrics=["accuracy"],
+    )
+    model.fit(x[:split], y[:split], epochs=args.epochs, batch_size=args.batch_size,
+              validation_data=(x[split:], y[split:]), verbose=2)
+    loss, accuracy = model.evaluate(x[split:], y[split:], verbose=0)
+    print(f"Test loss: {loss:.4f}, Test accuracy: {accuracy:.4f}")
+
+    # Fixed batch of 1 so the native side can check the input by element count.
+    converter = tf.lite.TFLiteConverter.from_keras_model(model)
+    model_path = os.path.join(args.output_dir, "asl_classifier.tflite")
+    with open(model_path, "wb") as f:
+        f.write(converter.convert())
+    labels_path = os.path.join(args.output_dir, "asl_classifier_labels.txt")
+    with open(labels_path, "w") as f:
+        f.write("\n".join(labels) + "\n")
+    print(f"Model exported to: {model_path}")
+
+    if os.path.isdir(MODELS_DIR):
+        shutil.copy2(model_path, MODELS_DIR)
+        shutil.copy2(labels_path, MODELS_DIR)
+        print(f"Copied to project resources: {MODELS_DIR}")
+
+
+if __name__ == "__main__":
+    main()